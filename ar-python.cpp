@@ -7,6 +7,7 @@
 #include <Python.h>
 #include <numpy/arrayobject.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <string>
 #include <vector>
@@ -47,6 +48,9 @@ static const char ar_arsel_docstring[] =
 "    returned where each key either contains a result indexable by the\n"
 "    signal number (i.e. the row indices of input matrix data) or it contains\n"
 "    a single scalar applicable to all signals.\n"
+"    Signals are processed in lockstep by ar::arsel_batch_lockstep, which\n"
+"    employs as many threads as OpenMP permits, and the GIL is released\n"
+"    meanwhile.\n"
 "\n"
 "    The model order will be selected using the specified criterion.\n"
 "    Criteria are specified using the following abbreviations:\n"
@@ -66,7 +70,13 @@ static const char ar_arsel_docstring[] =
 "    \\sigma^2_\\x and process gain are returned in keys 'sigma2x' and\n"
 "    'gain', respectively.  Autocorrelations for lags zero through the\n"
 "    model order, inclusive, are returned in key 'autocor'.  The raw\n"
-"    signals are made available for later use in field 'data'.\n"
+"    signals are made available for later use in field 'data'.  Aligned,\n"
+"    native float64 data is used in place rather than copied.\n"
+"\n"
+"    Fields 'AR' and 'autocor' are matrices holding one row per signal.\n"
+"    Each row has one more column than the largest model order selected\n"
+"    and is zero-padded beyond its own signal's model order 'order'.\n"
+"    Padding leaves filter() and lfiltic() results unchanged.\n"
 "\n"
 "    Given the observed autocorrelation structure, a decorrelation time\n"
 "    'T0' is computed by ar::decorrelation_time and used to estimate\n"
@@ -77,6 +87,11 @@ static const char ar_arsel_docstring[] =
 "    autocorrelation function will be used in computing the decorrelation\n"
 "    times whenever absrho is true.\n"
 "\n"
+"    Field 'timing' maps phase names 'read', 'load', 'penalty', 'burg', and\n"
+"    'T0' to per-signal arrays of seconds spent.  Suffixes '_iterations' and\n"
+"    '_bytes' name the iterations performed and nominal bytes touched.  As\n"
+"    signals are processed in lockstep, loading is included within 'burg'.\n"
+"\n"
 "    For example, given a sequence or *row-vector* of samples 'd', one can fit\n"
 "    a process, obtain its poles, and simulate a realization of length M using\n"
 "\n"
@@ -109,7 +124,15 @@ static PyTypeObject *ar_ArselType = NULL;
 
 extern "C" PyObject *ar_arsel(PyObject *self, PyObject *args)
 {
-    PyObject *ret_args = NULL, *ret = NULL;
+    // Every owned reference is released at 'cleanup' whether or not
+    // construction of 'ret' succeeds so each must be declared here
+    PyObject *ret = NULL, *ret_args = NULL, *data = NULL;
+    PyObject *_absrho = NULL, *_criterion = NULL, *_maxorder = NULL,
+             *_minorder = NULL, *_N = NULL, *_submean = NULL;
+    PyObject *_AR = NULL, *_autocor = NULL, *_eff_N = NULL, *_eff_var = NULL,
+             *_gain = NULL, *_mu = NULL, *_mu_sigma = NULL, *_order = NULL,
+             *_sigma2eps = NULL, *_sigma2x = NULL, *_T0 = NULL,
+             *_timing = NULL;
 
     // Sanity check that initar could build ar_ArselType
     if (!PyType_Check(ar_ArselType)) {
@@ -151,16 +174,17 @@ extern "C" PyObject *ar_arsel(PyObject *self, PyObject *args)
     }
 
     // Incoming data may be noncontiguous but should otherwise be well-behaved
-    // On success, 'data' is returned so Py_DECREF is applied only on failure
-    PyObject *data = PyArray_FROMANY(data_obj, NPY_DOUBLE, 1, 2,
+    // Aligned, native float64 input is used in place rather than copied
+    const double read_begin = ar::arsel_timing::now();
+    data = PyArray_FROMANY(data_obj, NPY_DOUBLE, 1, 2,
             NPY_ALIGNED | NPY_ELEMENTSTRIDES | NPY_NOTSWAPPED);
     if (!data) {
-        Py_DECREF(data);
         return NULL;
     }
 
     // Reshape any 1D ndarray into a 2D ndarray organized as a row vector.
     // Permits the remainder of the routine to uniformly worry about 2D only.
+    // Such a reshape is always possible as a view so nothing is copied.
     if (1 == ((PyArrayObject *)(data))->nd) {
         npy_intp dim[2] = { 1, PyArray_DIM(data, 0) };
         PyArray_Dims newshape = { dim, sizeof(dim)/sizeof(dim[0]) };
@@ -169,156 +193,233 @@ extern "C" PyObject *ar_arsel(PyObject *self, PyObject *args)
                                 &newshape, NPY_ANYORDER);
         Py_DECREF(olddata);
         if (!data) {
-            Py_DECREF(data);
             PyErr_SetString(PyExc_RuntimeError,
                 "Unable to reorganize data into matrix-like row vector.");
             return NULL;
         }
     }
 
+    // Rows traversed backwards, for example d[:, ::-1], are copied forwards
+    // so that every signal may be read with a nonnegative stride
+    if (PyArray_STRIDES(data)[1] < 0) {
+        PyObject *olddata = data;
+        data = (PyObject *) PyArray_GETCONTIGUOUS((PyArrayObject *)olddata);
+        Py_DECREF(olddata);
+        if (!data) {
+            return NULL;
+        }
+    }
+
     // How many data points are there?
     npy_intp M = PyArray_DIM(data, 0);
     npy_intp N = PyArray_DIM(data, 1);
+    const double read_seconds = ar::arsel_timing::now() - read_begin;
+
+    // Describe each equal-length row of data as one signal.  Contiguous rows
+    // are read through plain pointers.  Strided rows, for example those of
+    // Fortran-ordered arrays, are gathered by ar::burg_method_lockstep in
+    // blocks so consecutive rows share every cache line read.
+    typedef ar::strided_adaptor<const double*> signal_iterator;
+    const npy_intp stride = PyArray_STRIDES(data)[1]
+                          / static_cast<npy_intp>(sizeof(double));
+    const bool contiguous = (stride == 1);
+    std::vector<const double*> row_begin;
+    std::vector<signal_iterator> signal_begin;
+    if (contiguous) row_begin.reserve(M); else signal_begin.reserve(M);
+    for (npy_intp i = 0; i < M; ++i) {
+        const double* row = (const double*) PyArray_GETPTR2(data, i, 0);
+        if (contiguous) {
+            row_begin.push_back(row);
+        } else {
+            signal_begin.push_back(signal_iterator(row, stride));
+        }
+    }
+
+    // Fit all signals across threads without holding the GIL
+    // Every signal records the time spent converting the input as a whole
+    typedef ar::arsel_result<double, ar::arsel_timing> result_type;
+    std::vector<result_type> results(M);
+    for (npy_intp i = 0; i < M; ++i) {
+        results[i].timing.record(ar::arsel_read, read_seconds, M*N,
+                                 double(M*N) * sizeof(double));
+    }
+    std::string error;
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        if (contiguous) {
+            ar::arsel_batch_lockstep(M, N, row_begin.begin(),
+                                     results.begin(), std::string(criterion),
+                                     submean, absrho, minorder, maxorder);
+        } else {
+            ar::arsel_batch_lockstep(M, N, signal_begin.begin(),
+                                     results.begin(), std::string(criterion),
+                                     submean, absrho, minorder, maxorder);
+        }
+    }
+    catch (std::exception &e)
+    {
+        error = e.what();
+        if (error.empty()) error = "Unknown error within ar::arsel_batch_lockstep";
+    }
+    Py_END_ALLOW_THREADS
+    if (!error.empty()) {
+        PyErr_SetString(PyExc_RuntimeError, error.c_str());
+        goto cleanup;
+    }
+
+    // Field 'maxorder' reports the largest order actually considered
+    // Fields 'AR' and 'autocor' hold one zero-padded row per signal
+    npy_intp P;
+    P = 0;
+    for (npy_intp i = 0; i < M; ++i) {
+        P = std::max(P, static_cast<npy_intp>(results[i].AR.size()));
+    }
+    if (M) maxorder = results[0].maxorder;
 
     // Prepare per-signal storage locations to return to caller
-    // TODO Ensure these invocations all worked as expected
-    PyObject *_AR        = PyList_New(M);
-    PyObject *_autocor   = PyList_New(M);
-    PyObject *_eff_N     = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
-    PyObject *_eff_var   = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
-    PyObject *_gain      = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
-    PyObject *_mu        = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
-    PyObject *_mu_sigma  = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
-    PyObject *_sigma2eps = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
-    PyObject *_sigma2x   = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
-    PyObject *_T0        = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
-
-    // Prepare vectors to capture burg_method() output
-    std::vector<double> params, sigma2e, gain, autocor;
-    params .reserve(maxorder*(maxorder + 1)/2);
-    sigma2e.reserve(maxorder + 1);
-    gain   .reserve(maxorder + 1);
-    autocor.reserve(maxorder + 1);
-
-    // Prepare repeatedly-used working storage for burg_method()
-    std::vector<double> f, b, Ak, ac;
-
-    // Process each signal in turn...
+    npy_intp dims[2];
+    dims[0] = M;
+    dims[1] = P + 1;
+    _AR        = PyArray_ZEROS(2, dims, NPY_DOUBLE, 0);
+    _autocor   = PyArray_ZEROS(2, dims, NPY_DOUBLE, 0);
+    _eff_N     = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
+    _eff_var   = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
+    _gain      = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
+    _mu        = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
+    _mu_sigma  = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
+    _order     = PyArray_ZEROS(1, &M, NPY_INTP,   0);
+    _sigma2eps = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
+    _sigma2x   = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
+    _T0        = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
+    _timing    = PyDict_New();
+    if (   !_AR || !_autocor || !_eff_N || !_eff_var || !_gain || !_mu
+        || !_mu_sigma || !_order || !_sigma2eps || !_sigma2x || !_T0
+        || !_timing) {
+        goto cleanup;
+    }
+
+    // Process each signal's results in turn writing directly into arrays
     for (npy_intp i = 0; i < M; ++i)
     {
-        // Use burg_method to estimate a hierarchy of AR models from input data
-        params .clear();
-        sigma2e.clear();
-        gain   .clear();
-        autocor.clear();
-        ar::strided_adaptor<const double*> signal_begin(
-                (const double*) PyArray_GETPTR2(data, i, 0),
-                PyArray_STRIDES(data)[1] / sizeof(double));
-        ar::strided_adaptor<const double*> signal_end  (
-                (const double*) PyArray_GETPTR2(data, i, N),
-                PyArray_STRIDES(data)[1] / sizeof(double));
-        ar::burg_method(signal_begin, signal_end,
-                        *(double*)PyArray_GETPTR1(_mu, i),
-                        maxorder,
-                        std::back_inserter(params),
-                        std::back_inserter(sigma2e),
-                        std::back_inserter(gain),
-                        std::back_inserter(autocor),
-                        submean, /* output hierarchy? */ true, f, b, Ak, ac);
-
-        // Keep only best model per chosen criterion via function pointer
-        try {
-            best_model(N, minorder, params, sigma2e, gain, autocor);
-        }
-        catch (std::exception &e)
-        {
-            PyErr_SetString(PyExc_RuntimeError, e.what());
-            goto fail;
-        }
+        const result_type& r = results[i];
+
+        // Field 'mu'
+        *(double*)PyArray_GETPTR1(_mu, i) = r.mu;
 
-        // Compute decorrelation time from the estimated autocorrelation model
-        ar::predictor<double> p = ar::autocorrelation(
-                params.begin(), params.end(), gain[0], autocor.begin());
-        *(double*)PyArray_GETPTR1(_T0, i)
-            = ar::decorrelation_time(N, p, absrho);
+        // Field 'T0'
+        *(double*)PyArray_GETPTR1(_T0, i) = r.T0;
+
+        // Field 'order'
+        *(npy_intp*)PyArray_GETPTR1(_order, i) = r.AR.size();
 
         // Filter()-ready process parameters in field 'AR' with leading one
-        PyObject *_ARi = PyList_New(params.size() + 1);
-        PyList_SET_ITEM(_AR, i, _ARi);
-        PyList_SET_ITEM(_ARi, 0, PyFloat_FromDouble(1));
-        for (std::size_t k = 0; k < params.size(); ++k) {
-            PyList_SET_ITEM(_ARi, k+1, PyFloat_FromDouble(params[k]));
-        }
+        double *ARi = (double*)PyArray_GETPTR2(_AR, i, 0);
+        ARi[0] = 1;
+        std::copy(r.AR.begin(), r.AR.end(), ARi + 1);
 
         // Field 'sigma2eps'
-        *(double*)PyArray_GETPTR1(_sigma2eps, i) = sigma2e[0];
+        *(double*)PyArray_GETPTR1(_sigma2eps, i) = r.sigma2eps;
 
         // Field 'gain'
-        *(double*)PyArray_GETPTR1(_gain, i) = gain[0];
+        *(double*)PyArray_GETPTR1(_gain, i) = r.gain;
 
         // Field 'sigma2x'
-        *(double*)PyArray_GETPTR1(_sigma2x, i) = gain[0]*sigma2e[0];
+        *(double*)PyArray_GETPTR1(_sigma2x, i) = r.sigma2x;
 
         // Field 'autocor'
-        PyObject *_autocori = PyList_New(autocor.size());
-        PyList_SET_ITEM(_autocor, i, _autocori);
-        for (std::size_t k = 0; k < autocor.size(); ++k) {
-            PyList_SET_ITEM(_autocori, k, PyFloat_FromDouble(autocor[k]));
-        }
+        std::copy(r.autocor.begin(), r.autocor.end(),
+                  (double*)PyArray_GETPTR2(_autocor, i, 0));
 
         // Field 'eff_var'
         // Unbiased effective variance expression from [Trenberth1984]
-        *(double*)PyArray_GETPTR1(_eff_var, i)
-            = (N*gain[0]*sigma2e[0]) / (N - *(double*)PyArray_GETPTR1(_T0, i));
+        *(double*)PyArray_GETPTR1(_eff_var, i) = r.eff_var;
 
         // Field 'eff_N'
-        *(double*)PyArray_GETPTR1(_eff_N, i)
-            = N / *(double*)PyArray_GETPTR1(_T0, i);
+        *(double*)PyArray_GETPTR1(_eff_N, i) = r.eff_N;
 
         // Field 'mu_sigma'
         // Variance of the sample mean using effective quantities
-        *(double*)PyArray_GETPTR1(_mu_sigma, i)
-            = std::sqrt(   *(double*)PyArray_GETPTR1(_eff_var, i)
-                         / *(double*)PyArray_GETPTR1(_eff_N,   i));
+        *(double*)PyArray_GETPTR1(_mu_sigma, i) = r.mu_sigma;
+    }
+
+    // Field 'timing' maps names like those of 'arsel --timing' to arrays
+    for (int k = 0; k < ar::arsel_phases; ++k) {
+        const ar::arsel_phase phase = static_cast<ar::arsel_phase>(k);
+        const std::string name = ar::arsel_timing::name(phase);
+        PyObject *seconds    = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
+        PyObject *iterations = PyArray_ZEROS(1, &M, NPY_INTP,   0);
+        PyObject *bytes      = PyArray_ZEROS(1, &M, NPY_DOUBLE, 0);
+        bool ok = seconds && iterations && bytes;
+        for (npy_intp i = 0; ok && i < M; ++i) {
+            const ar::arsel_timing& t = results[i].timing;
+            *(double*)  PyArray_GETPTR1(seconds,    i) = t.seconds(phase);
+            *(npy_intp*)PyArray_GETPTR1(iterations, i) = t.iterations(phase);
+            *(double*)  PyArray_GETPTR1(bytes,      i) = t.bytes(phase);
+        }
+        ok = ok
+          && 0 == PyDict_SetItemString(_timing, name.c_str(), seconds)
+          && 0 == PyDict_SetItemString(_timing, (name + "_iterations").c_str(),
+                                       iterations)
+          && 0 == PyDict_SetItemString(_timing, (name + "_bytes").c_str(),
+                                       bytes);
+        Py_XDECREF(seconds);
+        Py_XDECREF(iterations);
+        Py_XDECREF(bytes);
+        if (!ok) goto cleanup;
     }
 
     // Prepare build and return an ar_ArselType via tuple constructor
     // See initar(...) method for the collections.namedtuple-based definition
-    ret_args = PyTuple_Pack(17, PyBool_FromLong(absrho),
+    // The tuple holds its own references so all of ours are later released
+    _absrho    = PyBool_FromLong(absrho);
+    _criterion = PyUnicode_FromString(criterion);
+    _maxorder  = PyLong_FromSize_t(maxorder);
+    _minorder  = PyLong_FromSize_t(minorder);
+    _N         = PyLong_FromLong(N);
+    _submean   = PyBool_FromLong(submean);
+    if (   !_absrho || !_criterion || !_maxorder || !_minorder || !_N
+        || !_submean) {
+        goto cleanup;
+    }
+    ret_args = PyTuple_Pack(19, _absrho,
                                 _AR,
                                 _autocor,
-                                PyUnicode_FromString(criterion),
+                                _criterion,
                                 data,
                                 _eff_N,
                                 _eff_var,
                                 _gain,
-                                PyLong_FromSize_t(maxorder),
-                                PyLong_FromSize_t(minorder),
+                                _maxorder,
+                                _minorder,
                                 _mu,
                                 _mu_sigma,
-                                PyLong_FromLong(N),
+                                _N,
+                                _order,
                                 _sigma2eps,
                                 _sigma2x,
-                                PyBool_FromLong(submean),
-                                _T0);
+                                _submean,
+                                _T0,
+                                _timing);
     if (!ret_args) {
         PyErr_SetString(PyExc_RuntimeError,
             "Unable to prepare arguments used to build return value.");
-        goto fail;
+        goto cleanup;
     }
     ret = PyObject_CallObject((PyObject *)ar_ArselType, ret_args);
     if (!ret) {
         PyErr_SetString(PyExc_RuntimeError,
             "Unable to construct return value.");
-        goto fail;
     }
 
-    return ret;
-
-fail:
+cleanup:
     Py_XDECREF(ret_args);
-    Py_XDECREF(ret);
     Py_XDECREF(data);
+    Py_XDECREF(_absrho);
+    Py_XDECREF(_criterion);
+    Py_XDECREF(_maxorder);
+    Py_XDECREF(_minorder);
+    Py_XDECREF(_N);
+    Py_XDECREF(_submean);
     Py_XDECREF(_AR);
     Py_XDECREF(_autocor);
     Py_XDECREF(_eff_N);
@@ -326,15 +427,161 @@ fail:
     Py_XDECREF(_gain);
     Py_XDECREF(_mu);
     Py_XDECREF(_mu_sigma);
+    Py_XDECREF(_order);
     Py_XDECREF(_sigma2eps);
     Py_XDECREF(_sigma2x);
     Py_XDECREF(_T0);
-    return NULL;
+    Py_XDECREF(_timing);
+    return ret;
+}
+
+static const char ar_spectrum_docstring[] =
+"    Usage: S = spectrum (AR, sigma2eps, frequencies)\n"
+"\n"
+"    Evaluate autoregressive model power spectral densities.\n"
+"\n"
+"    Use ar::spectrum_uniform_batch or ar::spectrum_batch to evaluate\n"
+"    S(omega) = sigma2eps / |AR[0] + AR[1] exp(-i omega) + ...|^2 for each\n"
+"    model held in a row of AR, where each row is filter()-ready with a\n"
+"    leading one as returned in field 'AR' by arsel.  Trailing zero padding\n"
+"    is harmless.  Innovation variances sigma2eps may be one scalar shared\n"
+"    by all models or one value per row.  The mean of S over [-pi, pi] is\n"
+"    the process variance sigma2x.\n"
+"\n"
+"    When frequencies is an integer K, whether a Python int or a NumPy\n"
+"    integer scalar, densities are evaluated at angular frequencies\n"
+"    pi*j/(K-1) for j = 0, ..., K-1 spanning zero through the Nyquist\n"
+"    frequency.  Otherwise frequencies is a sequence of angular frequencies\n"
+"    in radians per sample.  A matrix with one row per model and one column\n"
+"    per frequency is returned, or a vector when AR is a vector.  Models\n"
+"    are processed across as many threads as OpenMP permits and the GIL is\n"
+"    released meanwhile.\n"
+"\n"
+"    For example, densities on 513 frequencies for models fit by arsel are\n"
+"\n"
+"        from ar import arsel, spectrum\n"
+"        a = arsel(d)\n"
+"        S = spectrum(a.AR, a.sigma2eps, 513)\n"
+;
+
+extern "C" PyObject *ar_spectrum(PyObject *self, PyObject *args)
+{
+    // Every owned reference is released at 'cleanup' whether or not
+    // construction of 'ret' succeeds so each must be declared here
+    PyObject *ret = NULL, *AR = NULL, *sigma2eps = NULL, *omega = NULL;
+    PyObject *AR_obj = NULL, *sigma2eps_obj = NULL, *freq_obj = NULL;
+    (void) self;
+
+    if (!PyArg_ParseTuple(args, "OOO", &AR_obj, &sigma2eps_obj, &freq_obj)) {
+        return NULL;
+    }
+
+    // An integer requests a uniform grid while anything else lists omega
+    // Integers include NumPy integer scalars and zero dimensional arrays
+    const bool uniform = PyArray_Check(freq_obj)
+                       ? (   0 == PyArray_NDIM((PyArrayObject *) freq_obj)
+                          && PyArray_ISINTEGER((PyArrayObject *) freq_obj))
+                       : PyIndex_Check(freq_obj);
+    npy_intp K = 0, M = 0, P = 0;
+    bool vector = false;
+    std::vector<double> coeffs, s2;
+    std::vector<const double*> firsts, lasts;
+    std::vector<double*> outs;
+    std::string error;
+    if (uniform) {
+        K = PyNumber_AsSsize_t(freq_obj, NULL);
+        if (K < 0) {
+            if (!PyErr_Occurred()) {
+                PyErr_SetString(PyExc_ValueError,
+                    "Number of frequencies must be nonnegative.");
+            }
+            goto cleanup;
+        }
+    } else {
+        omega = PyArray_FROMANY(freq_obj, NPY_DOUBLE, 1, 1, NPY_ARRAY_CARRAY);
+        if (!omega) goto cleanup;
+        K = PyArray_DIM(omega, 0);
+    }
+
+    // Gather coefficients after each leading one into contiguous storage
+    AR = PyArray_FROMANY(AR_obj, NPY_DOUBLE, 1, 2,
+            NPY_ALIGNED | NPY_ELEMENTSTRIDES | NPY_NOTSWAPPED);
+    if (!AR) goto cleanup;
+    vector = (1 == PyArray_NDIM(AR));
+    M = vector ? 1 : PyArray_DIM(AR, 0);
+    P = PyArray_DIM(AR, vector ? 0 : 1);
+    P = P ? P - 1 : 0;
+    coeffs.resize(M*P);
+    for (npy_intp i = 0; i < M; ++i) {
+        for (npy_intp k = 0; k < P; ++k) {
+            coeffs[i*P + k] = vector
+                            ? *(const double*) PyArray_GETPTR1(AR, k + 1)
+                            : *(const double*) PyArray_GETPTR2(AR, i, k + 1);
+        }
+    }
+
+    // Broadcast any scalar innovation variance across all models
+    sigma2eps = PyArray_FROMANY(sigma2eps_obj, NPY_DOUBLE, 0, 1,
+            NPY_ALIGNED | NPY_ELEMENTSTRIDES | NPY_NOTSWAPPED);
+    if (!sigma2eps) goto cleanup;
+    if (0 == PyArray_NDIM(sigma2eps)) {
+        s2.assign(M, *(const double*) PyArray_DATA(sigma2eps));
+    } else if (PyArray_DIM(sigma2eps, 0) == M) {
+        for (npy_intp i = 0; i < M; ++i) {
+            s2.push_back(*(const double*) PyArray_GETPTR1(sigma2eps, i));
+        }
+    } else {
+        PyErr_SetString(PyExc_ValueError,
+            "sigma2eps must be a scalar or hold one value per model.");
+        goto cleanup;
+    }
+
+    // Densities are written directly into the rows of the result
+    {
+        npy_intp dims[2] = { M, K };
+        ret = vector ? PyArray_ZEROS(1, &dims[1], NPY_DOUBLE, 0)
+                     : PyArray_ZEROS(2, dims,     NPY_DOUBLE, 0);
+    }
+    if (!ret) goto cleanup;
+    for (npy_intp i = 0; i < M; ++i) {
+        firsts.push_back(coeffs.empty() ? NULL : &coeffs[i*P]);
+        lasts.push_back(firsts.back() + P);
+        outs.push_back((double*) PyArray_DATA(ret) + i*K);
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        if (uniform) {
+            ar::spectrum_uniform_batch(M, firsts.begin(), lasts.begin(),
+                                       s2.begin(), K, outs.begin());
+        } else {
+            const double *omega_first = (const double*) PyArray_DATA(omega);
+            ar::spectrum_batch(M, firsts.begin(), lasts.begin(), s2.begin(),
+                               omega_first, omega_first + K, outs.begin());
+        }
+    }
+    catch (std::exception &e)
+    {
+        error = e.what();
+        if (error.empty()) error = "Unknown error within ar::spectrum_batch";
+    }
+    Py_END_ALLOW_THREADS
+    if (!error.empty()) {
+        PyErr_SetString(PyExc_RuntimeError, error.c_str());
+        Py_CLEAR(ret);
+    }
+
+cleanup:
+    Py_XDECREF(AR);
+    Py_XDECREF(sigma2eps);
+    Py_XDECREF(omega);
+    return ret;
 }
 
 // Specification of methods available in the module
 static PyMethodDef ar_methods[] = {
     {"arsel", ar_arsel, METH_VARARGS, ar_arsel_docstring},
+    {"spectrum", ar_spectrum, METH_VARARGS, ar_spectrum_docstring},
     {NULL, NULL, 0, NULL}
 };
 
@@ -363,10 +610,12 @@ static void init_namedtuple(void)
                                                                    " mu"
                                                                    " mu_sigma"
                                                                    " N"
+                                                                   " order"
                                                                    " sigma2eps"
                                                                    " sigma2x"
                                                                    " submean"
-                                                                   " T0"));
+                                                                   " T0"
+                                                                   " timing"));
     ar_ArselType = (PyTypeObject *) PyObject_CallObject(func, args);
     Py_DECREF(args);
     Py_DECREF(func);
@@ -35,6 +35,9 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstring>
+#include <ctime>
+#include <deque>
 #include <functional>
 #include <iterator>
 #include <limits>
@@ -43,6 +46,10 @@
 #include <string>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /**
  * Autoregressive process modeling tools in header-only C++.
  *
@@ -249,6 +256,49 @@ std::size_t welford_variance_sample(InputIterator first,
     return N;
 }
 
+/**
+ * Combine the mean and centered sum of squares of one sample, as computed by
+ * \ref welford_nvariance, with those of a disjoint second sample to obtain
+ * the same quantities for their union.  The pairwise update is due to Chan,
+ * Golub, and LeVeque, "Algorithms for Computing the Sample Variance: Analysis
+ * and Recommendations", The American Statistician 37 (1983).  Merging
+ * partial results pairwise, as in a tree, retains the stability of Welford's
+ * algorithm and permits disjoint samples to be processed concurrently.
+ *
+ * @param[in]     N1    Number of samples in the first sample.
+ * @param[in,out] mean1 Mean of the first sample on input and of the union
+ *                      on output.
+ * @param[in,out] nvar1 Centered sum of squares of the first sample on input
+ *                      and of the union on output.
+ * @param[in]     N2    Number of samples in the second sample.
+ * @param[in]     mean2 Mean of the second sample.
+ * @param[in]     nvar2 Centered sum of squares of the second sample.
+ *
+ * @returns the number of samples in the union.
+ */
+template <typename Value>
+std::size_t welford_nvariance_merge(const std::size_t N1,
+                                    Value&            mean1,
+                                    Value&            nvar1,
+                                    const std::size_t N2,
+                                    const Value       mean2,
+                                    const Value       nvar2)
+{
+    const std::size_t N = N1 + N2;
+    if (N2 == 0) return N;
+    if (N1 == 0)
+    {
+        mean1 = mean2;
+        nvar1 = nvar2;
+        return N;
+    }
+
+    const Value d = mean2 - mean1;
+    mean1 += d * (Value(N2) / Value(N));
+    nvar1 += nvar2 + d * d * (Value(N1) * Value(N2) / Value(N));
+    return N;
+}
+
 /**
  * Compute means and the number of samples, N, times the population covariance
  * using Welford's algorithm.  The implementation follows the covariance
@@ -457,6 +507,11 @@ ValueType welford_inner_product(InputIterator1 first1,
  *                 {\vec{a}\cdot\vec{a} + \vec{b}\cdot\vec{b}}\f$
  *         when that numerator is nonzero, else zero.
  *
+ * The accumulation precision \c ValueType need not match the iterators'
+ * storage precision.  For example, <tt>float</tt> prediction errors may be
+ * summed in <tt>double</tt> or, when <tt>float</tt> is also requested, the
+ * compensated sums still retain nearly twice the storage precision.
+ *
  * @see Wikipedia's article on <a href="">Kahan summation</a> for
  *      background on how the accumulation error is reduced in the result.
  */
@@ -524,2123 +579,9715 @@ negative_half_reflection_coefficient(InputIterator1 a_first,
 #endif
 
 /**
- * Fit an autoregressive model to stationary time series data using %Burg's
- * method.  That is, find coefficients \f$a_i\f$ such that the sum of the
- * squared errors in the forward predictions \f$x_n = -a_1 x_{n-1} - \dots -
- * a_p x_{n-p}\f$ and backward predictions \f$x_n = -a_1 x_{n+1} - \dots - a_p
- * x_{n+p}\f$ are both minimized.  Either a single model of given order or a
- * hierarchy of models up to and including a maximum order may fit.
- *
- * The input data \f$\vec{x}\f$ are read from <tt>[data_first, data_last)</tt>
- * in a single pass.  The mean is computed, returned in \c mean, and \e
- * removed from further consideration whenever \c subtract_mean is true.
- * The estimated model parameters \f$a_i\f$ are output using \c params_first
- * with the behavior determined by the amount of data read, <tt>maxorder</tt>,
- * and the \c hierarchy flag:
- * <ul>
- *     <li>If \c hierarchy is \c false, only the \f$a_1, \dots,
- *         a_\text{maxorder}\f$ parameters for an AR(<tt>maxorder</tt>) process
- *         are output.</li>
- *     <li>If \c hierarchy is \c true, the <tt>maxorder*(maxorder+1)/2</tt>
- *         parameters \f$a_1, \dots, a_m\f$ for models AR(0), AR(1), AR(2),
- *         ..., AR(maxorder) are output.  Notice AR(0) has no parameters.
- *         </li>
- * </ul>
- * Note that the latter case is \e always computed; the \c hierarchy flag
- * merely controls what is output.  In both cases, the maximum order is limited
- * by the number of data samples provided and is output to \c maxorder.
- *
- * One mean squared discrepancy \f$\sigma^2_\epsilon\f$, also called the
- * innovation variance, and gain, defined as \f$\sigma^2_x /
- * \sigma^2_\epsilon\f$, are output for each model, including the trivial
- * zeroth order model when \c maxorder is zero or \c hierarchy is \c true,
- * using \c sigma2e_first and \c gain_first.  The autocorrelations for lags
- * <tt>[0,k]</tt> are output using \c autocor_first.  When \c hierarchy is \c
- * true, only lags <tt>[0,m]</tt> should be applied for some AR(<tt>m</tt>)
- * model.  Outputting the lag \c k autocorrelation is technically redundant as
- * it may be computed from \f$a_i\f$ and lags <tt>0, ..., k-1</tt>.
- * Autocovariances may be computed by multiplying the autocorrelations by the
- * gain times \f$\sigma^2_\epsilon\f$.
- *
- * The software aspects of the implementation differs from many other sources.
- * In particular,
- * <ul>
- *     <li>iterators are employed,</li>
- *     <li>the working precision is selectable using \c mean,</li>
- *     <li>the mean squared discrepancy calculation has been added,</li>
- *     <li>some loop index transformations have been performed,</li>
- *     <li>working storage may be passed into the method to reduce allocations
- *     across many invocations, and</li>
- *     <li>and all lower order models may be output during the recursion using
- *     \c hierarchy.</li>
- * </ul>
- * Gain and autocorrelation calculations have been added based on sections 5.2
- * and 5.3 of Broersen, P.  M.  T. Automatic autocorrelation and spectral
- * analysis.  Springer, 2006.  http://dx.doi.org/10.1007/1-84628-329-9.  The
- * classical algorithm, rather than the variant using denominator recursion due
- * to Andersen (http://dx.doi.org/10.1109/PROC.1978.11160), has been chosen as
- * the latter can be numerically unstable.
- *
- * @param[in]     data_first    Beginning of the input data range.
- * @param[in]     data_last     Exclusive end of the input data range.
- * @param[out]    mean          Mean of data.
- * @param[in,out] maxorder      On input, the maximum model order desired.
- *                              On output, the maximum model order computed.
- * @param[out]    params_first  Model parameters for a single model or
- *                              for an entire hierarchy of models.  At most
- *                              <tt>!hierarchy ? maxorder :
- *                              maxorder*(maxorder+1)/2</tt> values will be
- *                              output.
- * @param[out]    sigma2e_first The mean squared discrepancy for only
- *                              AR(<tt>maxorder</tt>) or for an entire
- *                              hierarchy.  Either one or at most
- *                              <tt>maxorder + 1</tt> values will be output.
- * @param[out]    gain_first    The model gain for only AR(<tt>maxorder</tt>)
- *                              or an entire hierarchy.  Either one or at most
- *                              <tt>maxorder + 1</tt> values will be output.
- * @param[out]    autocor_first Lag one through lag maxorder autocorrelations.
- *                              At most <tt>maxorder + 1</tt> values will be
- *                              output.
- * @param[in]     subtract_mean Should \c mean be subtracted from the data?
- * @param[in]     hierarchy     Should the entire hierarchy of estimated
- *                              models be output?
- * @param[in]     f             Working storage.  Reuse across invocations
- *                              may speed execution by avoiding allocations.
- * @param[in]     b             Working storage similar to \c f.
- * @param[in]     Ak            Working storage similar to \c f.
- * @param[in]     ac            Working storage similar to \c f.
- *
- * @returns the number data values processed within
- *          <tt>[data_first, data_last)</tt>.
+ * Should explicitly vectorized x86 %Burg kernels be compiled and selected at
+ * runtime by CPU dispatch?  Defaults to true for GCC 4.9 and later targeting
+ * x86 or x86_64.  Define as zero before including this header to disable.
  */
-template <class InputIterator,
-          class Value,
-          class OutputIterator1,
-          class OutputIterator2,
-          class OutputIterator3,
-          class OutputIterator4,
-          class Vector>
-std::size_t burg_method(InputIterator   data_first,
-                        InputIterator   data_last,
-                        Value&          mean,
-                        std::size_t&    maxorder,
-                        OutputIterator1 params_first,
-                        OutputIterator2 sigma2e_first,
-                        OutputIterator3 gain_first,
-                        OutputIterator4 autocor_first,
-                        const bool      subtract_mean,
-                        const bool      hierarchy,
-                        Vector&         f,
-                        Vector&         b,
-                        Vector&         Ak,
-                        Vector&         ac)
+#ifndef AR_SIMD_X86
+# if defined(__GNUC__) && !defined(__clang__) && (AR_GCC_VERSION >= 40900) \
+  && (defined(__x86_64__) || defined(__i386__))
+#  define AR_SIMD_X86 1
+# else
+#  define AR_SIMD_X86 0
+# endif
+#endif
+
+/**
+ * Should explicitly vectorized NEON %Burg kernels be compiled?  Defaults to
+ * true for GCC-compatible compilers targeting AArch64, where NEON is always
+ * present.  Define as zero before including this header to disable.
+ */
+#ifndef AR_SIMD_NEON
+# if defined(__GNUC__) && defined(__aarch64__) && defined(__ARM_NEON)
+#  define AR_SIMD_NEON 1
+# else
+#  define AR_SIMD_NEON 0
+# endif
+#endif
+
+/** Width in bytes of the logical lanes used by \ref burg_simd_kernel. */
+#define AR_SIMD_BYTES 64
+
+// Helpers for burg_simd_kernel.  Each kernel is written once against a GCC
+// vector type and instantiated for SSE2, AVX2, AVX-512, and NEON widths or
+// against a plain scalar as a portable fallback.  Every instantiation uses
+// the same AR_SIMD_BYTES of logical lanes so results are independent of the
+// instruction set selected at runtime.
+namespace
 {
-    using std::bind2nd;
-    using std::copy;
-    using std::distance;
-    using std::fill;
-    using std::inner_product;
-    using std::min;
-    using std::minus;
+
+#if defined(__GNUC__)
+# define AR_ALWAYS_INLINE __attribute__((__always_inline__))
+#else
+# define AR_ALWAYS_INLINE
+#endif
+
+#if (AR_GCC_VERSION > 40305)
+# define AR_NO_ASSOCIATIVE_MATH __attribute__((__optimize__("no-associative-math")))
+#else
+# define AR_NO_ASSOCIATIVE_MATH
+#endif
+
+// Every instantiation additionally forbids contracting products and sums
+// into fused multiply-adds.  GCC otherwise permits contraction within
+// optimize attributes on instruction sets like AVX2 and AVX-512, which would
+// break both bit-for-bit updates and results independent of instruction set
+#if (AR_GCC_VERSION > 40600)
+# define AR_EXACT_MATH __attribute__((__optimize__("no-associative-math", \
+                                                   "fp-contract=off")))
+#else
+# define AR_EXACT_MATH AR_NO_ASSOCIATIVE_MATH
+#endif
+
+/** One Kahan-compensated accumulation of \c x into sum \c s with error \c c. */
+template <typename T>
+inline AR_ALWAYS_INLINE void kahan_add(T& s, T& c, const T& x)
+{
+    T y = x - c;
+    T t = s + y;
+    c   = (t - s) - y;
+    s   = t;
+}
+
+/**
+ * Negative one half the reflection coefficient computed with one Kahan
+ * accumulator per logical lane where \c Vector is either \c Value or a GCC
+ * vector of \c Value.  The lanes are combined with compensation at the end.
+ */
+template <typename Value, typename Vector>
+inline AR_ALWAYS_INLINE
+Value lanes_nhrc(const Value* a, const Value* a_last, const Value* b)
+{
+    using std::memcpy;
     using std::size_t;
 
-    // Initialize f from [data_first, data_last) and fix number of samples
-    f.assign(data_first, data_last);
-    const size_t N = f.size();
+    enum {
+        W = sizeof(Vector) / sizeof(Value),  // Values per Vector
+        L = AR_SIMD_BYTES  / sizeof(Value),  // Logical lanes
+        R = L / W                            // Vectors per block of lanes
+    };
 
-    // Stably compute the incoming data's mean and population variance
-    mean = 0;
-    Value sigma2e = 0;
-    welford_variance_population(f.begin(), f.end(), mean, sigma2e);
+    Vector ns[R], nc[R], ds[R], dc[R];
+    for (int r = 0; r < R; ++r)
+        ns[r] = nc[r] = ds[r] = dc[r] = Vector();
 
-    // When requested, subtract the just-computed mean from the data.
-    // Adjust, if necessary, to make sigma2e the second moment.
-    if (subtract_mean)
+    // Accumulate complete blocks entirely within registers
+    const size_t n = a_last - a;
+    for (const Value* const end = a + n / L * L; a != end; a += L, b += L)
     {
-        transform(f.begin(), f.end(), f.begin(), bind2nd(minus<Value>(), mean));
+        for (int r = 0; r < R; ++r)
+        {
+            Vector xa, xb;
+            memcpy(&xa, a + r*W, sizeof(Vector));
+            memcpy(&xb, b + r*W, sizeof(Vector));
+            kahan_add(ds[r], dc[r], xa * xa);  // Denominator: a.a
+            kahan_add(ds[r], dc[r], xb * xb);  // Denominator: b.b
+            kahan_add(ns[r], nc[r], xa * xb);  // Numerator:   a.b
+        }
     }
-    else
+
+    // Spill lanes so any partial trailing block can be handled lane-wise
+    Value lns[L], lnc[L], lds[L], ldc[L];
+    memcpy(lns, ns, sizeof(lns));
+    memcpy(lnc, nc, sizeof(lnc));
+    memcpy(lds, ds, sizeof(lds));
+    memcpy(ldc, dc, sizeof(ldc));
+    for (size_t j = 0; a != a_last; ++j, ++a, ++b)
     {
-        sigma2e += mean*mean;
+        const Value xa = *a, xb = *b;
+        kahan_add(lds[j], ldc[j], xa * xa);
+        kahan_add(lds[j], ldc[j], xb * xb);
+        kahan_add(lns[j], lnc[j], xa * xb);
     }
 
-    // At most maxorder N-1 can be fit from N samples.  Beware N is unsigned.
-    maxorder = (N == 0) ? 0 : min(static_cast<size_t>(maxorder), N-1);
-
-    // Output sigma2e and gain for a zeroth order model, if requested.
-    Value gain = 1;
-    if (hierarchy || maxorder == 0)
+    // Combine the lanes, including their compensations, in a fixed order
+    Value num = 0, numc = 0, den = 0, denc = 0;
+    for (int j = 0; j < L; ++j)
     {
-        *sigma2e_first++ = sigma2e;
-        *gain_first++    = gain;
+        kahan_add(num, numc,  lns[j]);
+        kahan_add(num, numc, -lnc[j]);
+        kahan_add(den, denc,  lds[j]);
+        kahan_add(den, denc, -ldc[j]);
     }
+    num -= numc;
+    den -= denc;
 
-    // Initialize and perform Burg recursion
-    if (maxorder) b = f;  // Copy iff non-trivial work required
-    Ak.assign(maxorder + 1, Value(0));
-    Ak[0] = 1;
-    ac.clear();
-    ac.reserve(maxorder);
-    for (size_t kp1 = 1; kp1 <= maxorder; ++kp1)
+    return num == 0      // Does special zero case apply?
+        ? 0              // Yes, to avoid NaN from 0 / 0
+        : num / den;     // No, form ratio
+}
+
+/**
+ * Apply the %Burg update \f$f \leftarrow f + \mu b\f$ and \f$b \leftarrow b +
+ * \mu f\f$ where \c Vector is either \c Value or a GCC vector of \c Value.
+ * Results are identical to the scalar update as no operations are reordered.
+ */
+template <typename Value, typename Vector>
+inline AR_ALWAYS_INLINE
+void lanes_update(Value* f, Value* f_last, Value* b, const Value mu)
+{
+    using std::memcpy;
+    using std::size_t;
+
+    enum { W = sizeof(Vector) / sizeof(Value) };
+
+    Vector vmu;
+    for (size_t w = 0; w < W; ++w) ((Value*) &vmu)[w] = mu;
+
+    for (Value* const end = f + (f_last - f) / W * W; f != end; f += W, b += W)
     {
-        // Compute mu from f, b, and Dk and then update sigma2e and Ak using mu
-        // Afterwards, Ak[1:kp1] contains AR(k) coefficients by the recurrence
-        // Must treat mu result of 0 / 0 as 0 to avoid NaNs on constant signals
-        // By the recurrence, Ak[kp1] will also be the reflection coefficient
-        Value mu = -2 * negative_half_reflection_coefficient<Value>(
-                f.begin() + kp1, f.end(), b.begin());
+        Vector xf, xb;
+        memcpy(&xf, f, sizeof(Vector));
+        memcpy(&xb, b, sizeof(Vector));
+        const Vector t1 = xf + vmu*xb;
+        const Vector t2 = xb + vmu*xf;
+        memcpy(f, &t1, sizeof(Vector));
+        memcpy(b, &t2, sizeof(Vector));
+    }
+    for (; f != f_last; ++f, ++b)
+    {
+        const Value t1 = *f + mu * *b;
+        const Value t2 = *b + mu * *f;
+        *f = t1;
+        *b = t2;
+    }
+}
 
-        sigma2e *= (1 - mu*mu);
-        for (size_t n = 0; n <= kp1/2; ++n)
+/**
+ * For \c K interleaved signals whose n-th values are <tt>a[n*K+k]</tt> and
+ * <tt>b[n*K+k]</tt>, accumulate the Kahan-compensated sums of \ref
+ * negative_half_reflection_coefficient into <tt>ns[k]</tt>, <tt>nc[k]</tt>,
+ * <tt>ds[k]</tt>, and <tt>dc[k]</tt> over \c n values.  Work proceeds across
+ * signals using \c Vector, either \c Value or a GCC vector of \c Value, so
+ * each signal sees exactly the arithmetic of the scalar reference.
+ */
+template <typename Value, typename Vector>
+inline AR_ALWAYS_INLINE
+void lanes_lockstep_nhrc(const Value* a, const Value* b,
+                         const std::size_t n, const std::size_t K,
+                         Value* ns, Value* nc, Value* ds, Value* dc)
+{
+    using std::memcpy;
+    using std::size_t;
+
+    enum { W = sizeof(Vector) / sizeof(Value) };
+    const size_t KW = K / W * W;
+
+    for (size_t i = 0; i < n; ++i, a += K, b += K)
+    {
+        size_t k = 0;
+        for (; k < KW; k += W)
         {
-            Value t1 = Ak[n] + mu*Ak[kp1 - n];
-            Value t2 = Ak[kp1 - n] + mu*Ak[n];
-            Ak[n] = t1;
-            Ak[kp1 - n] = t2;
+            Vector xa, xb, vns, vnc, vds, vdc;
+            memcpy(&xa,  a  + k, sizeof(Vector));
+            memcpy(&xb,  b  + k, sizeof(Vector));
+            memcpy(&vns, ns + k, sizeof(Vector));
+            memcpy(&vnc, nc + k, sizeof(Vector));
+            memcpy(&vds, ds + k, sizeof(Vector));
+            memcpy(&vdc, dc + k, sizeof(Vector));
+            kahan_add(vds, vdc, xa * xa);  // Denominator: a.a
+            kahan_add(vds, vdc, xb * xb);  // Denominator: b.b
+            kahan_add(vns, vnc, xa * xb);  // Numerator:   a.b
+            memcpy(ns + k, &vns, sizeof(Vector));
+            memcpy(nc + k, &vnc, sizeof(Vector));
+            memcpy(ds + k, &vds, sizeof(Vector));
+            memcpy(dc + k, &vdc, sizeof(Vector));
+        }
+        for (; k < K; ++k)
+        {
+            const Value xa = a[k], xb = b[k];
+            kahan_add(ds[k], dc[k], xa * xa);
+            kahan_add(ds[k], dc[k], xb * xb);
+            kahan_add(ns[k], nc[k], xa * xb);
         }
+    }
+}
 
-        // Update the gain per Broersen 2006 equation (5.25)
-        gain *= 1 / (1 - Ak[kp1]*Ak[kp1]);
+/**
+ * For \c K interleaved signals per \ref lanes_lockstep_nhrc, apply the %Burg
+ * update given per-signal <tt>mu[k]</tt> to \c n values while accumulating
+ * the next order's sums in the manner of \ref burg_fused_kernel.  The sums
+ * must be zero on entry.
+ */
+template <typename Value, typename Vector>
+inline AR_ALWAYS_INLINE
+void lanes_lockstep_update(Value* f, Value* b,
+                           const std::size_t n, const std::size_t K,
+                           const Value* mu,
+                           Value* ns, Value* nc, Value* ds, Value* dc)
+{
+    using std::memcpy;
+    using std::size_t;
 
-        // Compute and output the next autocorrelation coefficient
-        // See Broersen 2006 equations (5.28) and (5.31) for details
-        ac.push_back(-inner_product(ac.rbegin(), ac.rend(),
-                                    Ak.begin() + 1, Ak[kp1]));
+    enum { W = sizeof(Vector) / sizeof(Value) };
+    const size_t KW = K / W * W;
 
-        // Output parameters and the input and output variances when requested
-        if (hierarchy || kp1 == maxorder)
+    for (size_t k = 0; k < K; ++k)
+    {
+        const Value t1 = f[k] + mu[k] * b[k];
+        const Value t2 = b[k] + mu[k] * f[k];
+        f[k] = t1;
+        b[k] = t2;
+    }
+    for (size_t i = 1; i < n; ++i)
+    {
+        f += K;
+        b += K;
+        size_t k = 0;
+        for (; k < KW; k += W)
         {
-            params_first = copy(Ak.begin() + 1, Ak.begin() + kp1 + 1,
-                                params_first);
-            *sigma2e_first++ = sigma2e;
-            *gain_first++    = gain;
+            Vector xf, xb, xp, vmu, vns, vnc, vds, vdc;
+            memcpy(&xf,  f  + k,     sizeof(Vector));
+            memcpy(&xb,  b  + k,     sizeof(Vector));
+            memcpy(&xp,  b  + k - K, sizeof(Vector));
+            memcpy(&vmu, mu + k,     sizeof(Vector));
+            memcpy(&vns, ns + k,     sizeof(Vector));
+            memcpy(&vnc, nc + k,     sizeof(Vector));
+            memcpy(&vds, ds + k,     sizeof(Vector));
+            memcpy(&vdc, dc + k,     sizeof(Vector));
+            const Vector t1 = xf + vmu*xb;
+            const Vector t2 = xb + vmu*xf;
+            memcpy(f + k, &t1, sizeof(Vector));
+            memcpy(b + k, &t2, sizeof(Vector));
+            kahan_add(vds, vdc, t1 * t1);  // Denominator: a.a
+            kahan_add(vds, vdc, xp * xp);  // Denominator: b.b
+            kahan_add(vns, vnc, t1 * xp);  // Numerator:   a.b
+            memcpy(ns + k, &vns, sizeof(Vector));
+            memcpy(nc + k, &vnc, sizeof(Vector));
+            memcpy(ds + k, &vds, sizeof(Vector));
+            memcpy(dc + k, &vdc, sizeof(Vector));
         }
-
-        // Update f and b for the next iteration if another remains
-        if (kp1 < maxorder)
+        for (; k < K; ++k)
         {
-            for (size_t n = 0; n < N - kp1; ++n)
-            {
-                Value t1 = f[n + kp1] + mu*b[n];
-                Value t2 = b[n] + mu*f[n + kp1];
-                f[n + kp1] = t1;
-                b[n] = t2;
-            }
+            const Value xp = b[k - K];
+            const Value t1 = f[k] + mu[k] * b[k];
+            const Value t2 = b[k] + mu[k] * f[k];
+            f[k] = t1;
+            b[k] = t2;
+            kahan_add(ds[k], dc[k], t1 * t1);
+            kahan_add(ds[k], dc[k], xp * xp);
+            kahan_add(ns[k], nc[k], t1 * xp);
         }
     }
+}
 
-    // Output the lag [0,maxorder] autocorrelation coefficients in single pass
-    *autocor_first++ = 1;
-    copy(ac.begin(), ac.end(), autocor_first);
+// Instantiations of the lane-based kernels for each supported instruction set
+// Names follow {nhrc,update,lockstep_nhrc,lockstep_update}_{isa}_{value}
+// with nhrc abbreviating negative_half_reflection_coefficient.
+
+#define AR_SIMD_INSTANTIATE(isa, attr, value, vector)                      \
+    attr AR_EXACT_MATH inline                                              \
+    value nhrc_ ## isa ## _ ## value(                                      \
+        const value* a, const value* a_last, const value* b)               \
+    { return lanes_nhrc<value, vector>(a, a_last, b); }                    \
+    attr AR_EXACT_MATH inline                                              \
+    void update_ ## isa ## _ ## value(                                     \
+        value* f, value* f_last, value* b, const value mu)                 \
+    { lanes_update<value, vector>(f, f_last, b, mu); }                     \
+    attr AR_EXACT_MATH inline                                              \
+    void lockstep_nhrc_ ## isa ## _ ## value(                              \
+        const value* a, const value* b, std::size_t n, std::size_t K,      \
+        value* ns, value* nc, value* ds, value* dc)                        \
+    { lanes_lockstep_nhrc<value, vector>(a, b, n, K, ns, nc, ds, dc); }    \
+    attr AR_EXACT_MATH inline                                              \
+    void lockstep_update_ ## isa ## _ ## value(                            \
+        value* f, value* b, std::size_t n, std::size_t K, const value* mu, \
+        value* ns, value* nc, value* ds, value* dc)                        \
+    { lanes_lockstep_update<value, vector>(f, b, n, K, mu,                 \
+                                           ns, nc, ds, dc); }
+
+#define AR_SIMD_NO_TARGET
+AR_SIMD_INSTANTIATE(portable, AR_SIMD_NO_TARGET, double, double)
+AR_SIMD_INSTANTIATE(portable, AR_SIMD_NO_TARGET, float,  float )
+
+#if AR_SIMD_X86
+typedef double v2df  __attribute__((__vector_size__(16)));
+typedef double v4df  __attribute__((__vector_size__(32)));
+typedef double v8df  __attribute__((__vector_size__(64)));
+typedef float  v4sf  __attribute__((__vector_size__(16)));
+typedef float  v8sf  __attribute__((__vector_size__(32)));
+typedef float  v16sf __attribute__((__vector_size__(64)));
+AR_SIMD_INSTANTIATE(sse2,   __attribute__((__target__("sse2"))),    double, v2df )
+AR_SIMD_INSTANTIATE(sse2,   __attribute__((__target__("sse2"))),    float,  v4sf )
+AR_SIMD_INSTANTIATE(avx2,   __attribute__((__target__("avx2"))),    double, v4df )
+AR_SIMD_INSTANTIATE(avx2,   __attribute__((__target__("avx2"))),    float,  v8sf )
+AR_SIMD_INSTANTIATE(avx512, __attribute__((__target__("avx512f"))), double, v8df )
+AR_SIMD_INSTANTIATE(avx512, __attribute__((__target__("avx512f"))), float,  v16sf)
+#endif
 
-    // Return the number of values processed in [data_first, data_last)
-    return N;
+#if AR_SIMD_NEON
+typedef double v2df  __attribute__((__vector_size__(16)));
+typedef float  v4sf  __attribute__((__vector_size__(16)));
+AR_SIMD_INSTANTIATE(neon, AR_SIMD_NO_TARGET, double, v2df)
+AR_SIMD_INSTANTIATE(neon, AR_SIMD_NO_TARGET, float,  v4sf)
+#endif
+
+#undef AR_SIMD_INSTANTIATE
+#undef AR_SIMD_NO_TARGET
+
+/**
+ * Select the best kernel supported by the running processor given candidates
+ * for each instruction set, any of which may be null when not compiled.
+ */
+template <typename T>
+T simd_select(T portable, T sse2, T avx2, T avx512, T neon)
+{
+#if AR_SIMD_X86
+    __builtin_cpu_init();
+    if (avx512 && __builtin_cpu_supports("avx512f")) return avx512;
+    if (avx2   && __builtin_cpu_supports("avx2"   )) return avx2;
+    if (sse2   && __builtin_cpu_supports("sse2"   )) return sse2;
+#else
+    (void) sse2; (void) avx2; (void) avx512;
+#endif
+#if AR_SIMD_NEON
+    if (neon) return neon;
+#else
+    (void) neon;
+#endif
+    return portable;
 }
 
-/** \copydoc burg_method(InputIterator,InputIterator,Value&,std::size_t&,OutputIterator1,OutputIterator2,OutputIterator3,OutputIterator4,const bool,const bool,Vector&,Vector&,Vector&,Vector&) */
-template <class InputIterator,
-          class Value,
-          class OutputIterator1,
-          class OutputIterator2,
-          class OutputIterator3,
-          class OutputIterator4>
-std::size_t burg_method(InputIterator     data_first,
-                        InputIterator     data_last,
-                        Value&            mean,
-                        std::size_t&      maxorder,
-                        OutputIterator1   params_first,
-                        OutputIterator2   sigma2e_first,
-                        OutputIterator3   gain_first,
-                        OutputIterator4   autocor_first,
-                        const bool        subtract_mean = false,
-                        const bool        hierarchy     = false)
+#if AR_SIMD_X86
+# define AR_SIMD_CANDIDATES(kernel, value) kernel ## _portable_ ## value, \
+    kernel ## _sse2_ ## value, kernel ## _avx2_ ## value,                 \
+    kernel ## _avx512_ ## value, 0
+#elif AR_SIMD_NEON
+# define AR_SIMD_CANDIDATES(kernel, value) kernel ## _portable_ ## value, \
+    0, 0, 0, kernel ## _neon_ ## value
+#else
+# define AR_SIMD_CANDIDATES(kernel, value) kernel ## _portable_ ## value, \
+    0, 0, 0, 0
+#endif
+
+/** Runtime selection of the best available lane-based kernels. */
+template <typename Value> struct simd_dispatch;
+
+#define AR_SIMD_DISPATCH(value)                                            \
+template <> struct simd_dispatch<value>                                    \
+{                                                                          \
+    typedef value (*nhrc_type  )(const value*, const value*, const value*);\
+    typedef void  (*update_type)(value*, value*, value*, const value);     \
+                                                                           \
+    static nhrc_type nhrc()                                                \
+    {                                                                      \
+        static const nhrc_type p = simd_select<nhrc_type>(                 \
+                AR_SIMD_CANDIDATES(nhrc, value));                          \
+        return p;                                                          \
+    }                                                                      \
+                                                                           \
+    static update_type update()                                            \
+    {                                                                      \
+        static const update_type p = simd_select<update_type>(             \
+                AR_SIMD_CANDIDATES(update, value));                        \
+        return p;                                                          \
+    }                                                                      \
+                                                                           \
+    typedef void (*lockstep_nhrc_type)(const value*, const value*,         \
+                                       std::size_t, std::size_t,           \
+                                       value*, value*, value*, value*);    \
+    typedef void (*lockstep_update_type)(value*, value*,                   \
+                                         std::size_t, std::size_t,         \
+                                         const value*,                     \
+                                         value*, value*, value*, value*);  \
+                                                                           \
+    static lockstep_nhrc_type lockstep_nhrc()                              \
+    {                                                                      \
+        static const lockstep_nhrc_type p                                  \
+            = simd_select<lockstep_nhrc_type>(                             \
+                AR_SIMD_CANDIDATES(lockstep_nhrc, value));                 \
+        return p;                                                          \
+    }                                                                      \
+                                                                           \
+    static lockstep_update_type lockstep_update()                          \
+    {                                                                      \
+        static const lockstep_update_type p                                \
+            = simd_select<lockstep_update_type>(                           \
+                AR_SIMD_CANDIDATES(lockstep_update, value));               \
+        return p;                                                          \
+    }                                                                      \
+};
+
+AR_SIMD_DISPATCH(double)
+AR_SIMD_DISPATCH(float)
+
+#undef AR_SIMD_DISPATCH
+#undef AR_SIMD_CANDIDATES
+
+// Employ the lane-based kernels only for contiguous double or float data
+// while all other iterators and precisions fall back to the reference.
+
+template <typename Value, typename InputIterator1, typename InputIterator2>
+inline Value simd_nhrc(Value, InputIterator1 a_first, InputIterator1 a_last,
+                       InputIterator2 b_first)
 {
-    using std::vector;
-    vector<Value> f, b, Ak, ac; // Working storage
+    return negative_half_reflection_coefficient<Value>(
+            a_first, a_last, b_first);
+}
 
-    return burg_method(data_first, data_last, mean, maxorder,
-                       params_first, sigma2e_first, gain_first,
-                       autocor_first, subtract_mean, hierarchy,
-                       f, b, Ak, ac);
+template <typename Iterator1, typename Iterator2, typename Value>
+inline void simd_update(Iterator1 f_first, Iterator1 f_last,
+                        Iterator2 b_first, const Value mu)
+{
+    for (; f_first != f_last; ++f_first, ++b_first)
+    {
+        Value t1 = *f_first + mu * *b_first;
+        Value t2 = *b_first + mu * *f_first;
+        *f_first = t1;
+        *b_first = t2;
+    }
 }
 
-// Type erasure for NoiseGenerator parameters within predictor.
-// Either std::tr1::function or boost::function would better provide the
-// desired capability but both add additional, undesired dependencies.
-namespace
+#define AR_SIMD_OVERLOADS(value, iterator, const_iterator, address)        \
+inline value simd_nhrc(value, const_iterator a_first,                      \
+                       const_iterator a_last, const_iterator b_first)      \
+{                                                                          \
+    if (a_first == a_last) return 0;                                       \
+    const value* a = address(a_first);                                     \
+    return simd_dispatch<value>::nhrc()(a, a + (a_last - a_first),         \
+                                        address(b_first));                 \
+}                                                                          \
+inline value simd_nhrc(value, iterator a_first,                            \
+                       iterator a_last, iterator b_first)                  \
+{                                                                          \
+    return simd_nhrc(value(), static_cast<const_iterator>(a_first),        \
+                     static_cast<const_iterator>(a_last),                  \
+                     static_cast<const_iterator>(b_first));                \
+}                                                                          \
+inline void simd_update(iterator f_first, iterator f_last,                 \
+                        iterator b_first, const value mu)                  \
+{                                                                          \
+    if (f_first == f_last) return;                                         \
+    value* f = address(f_first);                                           \
+    simd_dispatch<value>::update()(f, f + (f_last - f_first),              \
+                                   address(b_first), mu);                  \
+}
+
+#define AR_SIMD_POINTER(i) (i)
+#define AR_SIMD_ADDRESS(i) (&*(i))
+AR_SIMD_OVERLOADS(double, double*, const double*, AR_SIMD_POINTER)
+AR_SIMD_OVERLOADS(float,  float*,  const float*,  AR_SIMD_POINTER)
+AR_SIMD_OVERLOADS(double, std::vector<double>::iterator,
+                  std::vector<double>::const_iterator, AR_SIMD_ADDRESS)
+AR_SIMD_OVERLOADS(float,  std::vector<float>::iterator,
+                  std::vector<float>::const_iterator,  AR_SIMD_ADDRESS)
+#undef AR_SIMD_POINTER
+#undef AR_SIMD_ADDRESS
+#undef AR_SIMD_OVERLOADS
+
+// Lockstep kernels for burg_method_lockstep given K interleaved signals
+// employ the lane-based kernels for double or float and otherwise use Value.
+// Results for each signal are stored into out.
+
+template <typename Value>
+AR_EXACT_MATH
+void lockstep_finish(const std::size_t K,
+                     const Value* ns, const Value* nc,
+                     const Value* ds, const Value* dc, Value* out)
 {
+    for (std::size_t k = 0; k < K; ++k)
+    {
+        out[k] = ns[k] + nc[k] == 0                 // Special zero case?
+               ? 0                                  // Yes, avoid NaN
+               : (ns[k] + nc[k]) / (ds[k] + dc[k]); // No, form ratio
+    }
+}
 
-/** Abstract base class for NoiseGenerator-related type erasure. */
 template <typename Value>
-struct nullary
+AR_EXACT_MATH
+void lockstep_nhrc(const Value* a, const Value* b,
+                   const std::size_t n, const std::size_t K,
+                   std::vector<Value>& sums, Value* out)
 {
-    virtual ~nullary() {}
-    virtual Value operator()() = 0;
-    virtual nullary* clone()   = 0;
-};
+    sums.assign(4*K, Value(0));
+    Value *ns = &sums[0], *nc = ns + K, *ds = nc + K, *dc = ds + K;
+    lanes_lockstep_nhrc<Value, Value>(a, b, n, K, ns, nc, ds, dc);
+    lockstep_finish(K, ns, nc, ds, dc, out);
+}
 
-/** A nullary function always returning zero. */
-template<typename Value>
-struct nullary_impl0 : public nullary<Value>
+template <typename Value>
+AR_EXACT_MATH
+void lockstep_update(Value* f, Value* b,
+                     const std::size_t n, const std::size_t K,
+                     const Value* mu, std::vector<Value>& sums, Value* out)
 {
-    Value operator()()
-    {
-        return 0;
-    }
-    nullary_impl0* clone()
+    sums.assign(4*K, Value(0));
+    Value *ns = &sums[0], *nc = ns + K, *ds = nc + K, *dc = ds + K;
+    lanes_lockstep_update<Value, Value>(f, b, n, K, mu, ns, nc, ds, dc);
+    lockstep_finish(K, ns, nc, ds, dc, out);
+}
+
+#define AR_SIMD_LOCKSTEP(value)                                            \
+inline void lockstep_nhrc(const value* a, const value* b,                  \
+                          const std::size_t n, const std::size_t K,        \
+                          std::vector<value>& sums, value* out)            \
+{                                                                          \
+    sums.assign(4*K, value(0));                                            \
+    value *ns = &sums[0], *nc = ns + K, *ds = nc + K, *dc = ds + K;        \
+    simd_dispatch<value>::lockstep_nhrc()(a, b, n, K, ns, nc, ds, dc);     \
+    lockstep_finish(K, ns, nc, ds, dc, out);                               \
+}                                                                          \
+inline void lockstep_update(value* f, value* b,                            \
+                            const std::size_t n, const std::size_t K,      \
+                            const value* mu, std::vector<value>& sums,     \
+                            value* out)                                    \
+{                                                                          \
+    sums.assign(4*K, value(0));                                            \
+    value *ns = &sums[0], *nc = ns + K, *ds = nc + K, *dc = ds + K;        \
+    simd_dispatch<value>::lockstep_update()(f, b, n, K, mu,                \
+                                            ns, nc, ds, dc);               \
+    lockstep_finish(K, ns, nc, ds, dc, out);                               \
+}
+
+AR_SIMD_LOCKSTEP(double)
+AR_SIMD_LOCKSTEP(float)
+#undef AR_SIMD_LOCKSTEP
+
+// Interleave N samples from each of K signals into f[n*K + k] visiting
+// blocks of samples across all signals.  When signals are rows of a
+// column-major array each block then reads contiguous memory so that the
+// gather touches every cache line and page once rather than once per signal.
+// Each signal's mean m[k] and centered sum of squares nv[k] are accumulated
+// in sample order exactly as welford_nvariance would compute them.
+template <class RandomAccessIterator, class Value>
+void lockstep_gather(const std::size_t     K,
+                     const std::size_t     N,
+                     RandomAccessIterator  data_firsts,
+                     Value*                f,
+                     Value*                m,
+                     Value*                nv)
+{
+    typedef typename std::iterator_traits<
+            RandomAccessIterator
+        >::value_type iterator;
+    enum { block = 256 };
+
+    std::fill(m,  m  + K, Value(0));
+    std::fill(nv, nv + K, Value(0));
+    for (std::size_t lo = 0; lo < N; lo += block)
     {
-        return new nullary_impl0();
+        const std::size_t hi = std::min<std::size_t>(N, lo + block);
+        for (std::size_t k = 0; k < K; ++k)
+        {
+            iterator i = data_firsts[k] + lo;
+            Value mk = m[k], nvk = nv[k];
+            for (std::size_t n = lo; n < hi; ++n, ++i)
+            {
+                const Value x = *i;
+                const Value d = x - mk;
+                mk  += d / (n + 1);
+                nvk += d*(x - mk);
+                f[n*K + k] = x;
+            }
+            m[k]  = mk;
+            nv[k] = nvk;
+        }
     }
-};
+}
 
-/** A nullary function always invoking t(). */
-template<typename Value, class T>
-struct nullary_impl1 : public nullary<Value>
+}
+
+/**
+ * The reference kernels for the two inner loops of \ref burg_recursion.
+ * Reflection coefficients are computed by \ref
+ * negative_half_reflection_coefficient and the prediction error update is a
+ * straightforward scalar loop.
+ *
+ * A kernel provides
+ * <tt>negative_half_reflection_coefficient<Value>(f_first, f_last,
+ * b_first)</tt> and <tt>update_and_reflect(f_first, f_last, b_first,
+ * mu)</tt>.  The latter replaces \f$f_n\f$ by \f$f_n + \mu b_n\f$ and
+ * \f$b_n\f$ by \f$b_n + \mu f_n\f$ for all \f$n\f$ in <tt>[0,
+ * distance(f_first, f_last))</tt> and then returns the next order's
+ * <tt>negative_half_reflection_coefficient<Value>(f_first + 1, f_last,
+ * b_first)</tt>.  The range <tt>[f_first, f_last)</tt> is never empty.
+ */
+struct burg_scalar_kernel
 {
-    nullary_impl1(T t) : t(t) {}
-    Value operator()()
+    /** Compute negative one half the reflection coefficient. */
+    template <typename Value,
+              typename RandomAccessIterator1,
+              typename RandomAccessIterator2>
+    Value negative_half_reflection_coefficient(
+            RandomAccessIterator1 f_first,
+            RandomAccessIterator1 f_last,
+            RandomAccessIterator2 b_first) const
     {
-        return t();
+        return ar::negative_half_reflection_coefficient<Value>(
+                f_first, f_last, b_first);
     }
-    nullary_impl1* clone()
+
+    /**
+     * Update the forward and backward prediction errors given \c mu and
+     * compute negative one half the next reflection coefficient.
+     */
+    template <typename RandomAccessIterator1,
+              typename RandomAccessIterator2,
+              typename Value>
+    Value update_and_reflect(RandomAccessIterator1 f_first,
+                             RandomAccessIterator1 f_last,
+                             RandomAccessIterator2 b_first,
+                             const Value           mu) const
     {
-        return new nullary_impl1(t);
+        simd_update<RandomAccessIterator1, RandomAccessIterator2, Value>(
+                f_first, f_last, b_first, mu);
+        return ar::negative_half_reflection_coefficient<Value>(
+                f_first + 1, f_last, b_first);
     }
-    T t;
 };
 
-}
-
 /**
- * Simulate an autoregressive model process with an InputIterator interface.
+ * Explicitly vectorized kernels for the two inner loops of \ref
+ * burg_recursion with the instruction set (SSE2, AVX2, or AVX-512 on x86,
+ * NEON on AArch64) selected at runtime.  Contiguous \c float or \c double
+ * data, whether given by pointers or <tt>std::vector</tt> iterators, are
+ * processed using \ref AR_SIMD_BYTES of logical lanes each holding its own
+ * Kahan-compensated sums.  Results are therefore identical regardless of the
+ * instruction set chosen but, because summation order differs, they differ
+ * in the last few bits from those of \ref burg_scalar_kernel.  Prediction
+ * error updates are bit-for-bit identical to the reference.  All other
+ * iterator types and precisions use \ref burg_scalar_kernel.
  */
-template <typename Value, typename Index = std::size_t>
-class predictor
-    : public std::iterator<std::input_iterator_tag, Value,
-      std::ptrdiff_t, const Value*, const Value&>
+struct burg_simd_kernel
 {
-private:
-    typedef std::iterator<std::input_iterator_tag, Value,
-            std::ptrdiff_t, const Value*, const Value&> base;
-
-public:
-    typedef typename base::difference_type   difference_type;
-    typedef typename base::iterator_category iterator_category;
-    typedef typename base::pointer           pointer;
-    typedef typename base::reference         reference;
-    typedef typename base::value_type        value_type;
-
-    /** Singular instance marking prediction index \c n. */
-    explicit predictor(Index n = 0) : n(n), d(), g(0), xn()
+    /** Compute negative one half the reflection coefficient. */
+    template <typename Value,
+              typename RandomAccessIterator1,
+              typename RandomAccessIterator2>
+    Value negative_half_reflection_coefficient(
+            RandomAccessIterator1 f_first,
+            RandomAccessIterator1 f_last,
+            RandomAccessIterator2 b_first) const
     {
-#ifndef NDEBUG
-        using std::numeric_limits;
-        if (numeric_limits<Value>::has_quiet_NaN)
-            xn = numeric_limits<Value>::quiet_NaN();
-#endif
+        return simd_nhrc(Value(), f_first, f_last, b_first);
     }
 
     /**
-     * Iterate on the process \f$x_n + a_1 x_{n - 1} + \dots + a_p x_{n - p} =
-     * 0\f$.  Presumably \ref initial_conditions will be used to specify some
-     * initial state as otherwise the process is identically zero.  The process
-     * order \f$p\f$ is set by <tt>std::distance(params_first,
-     * params_last)</tt>.
-     *
-     * @param params_first  Beginning of the process parameter range
-     *                      starting with \f$a_1\f$.
-     * @param params_last   End of the process parameter range.
+     * Update the forward and backward prediction errors given \c mu and
+     * compute negative one half the next reflection coefficient.
      */
-    template <class RandomAccessIterator>
-    predictor(RandomAccessIterator params_first,
-              RandomAccessIterator params_last)
-        : n(0),
-          d(2*std::distance(params_first, params_last), 0),
-          g(new nullary_impl0<Value>()),
-          xn((*g)())
+    template <typename RandomAccessIterator1,
+              typename RandomAccessIterator2,
+              typename Value>
+    Value update_and_reflect(RandomAccessIterator1 f_first,
+                             RandomAccessIterator1 f_last,
+                             RandomAccessIterator2 b_first,
+                             const Value           mu) const
     {
-        // Finish preparing d = [ a_p, ..., a_1, 0, ..., 0 ]
-        using std::vector;
-        typename vector<Value>::size_type i = d.size() / 2;
-        while (i --> 0) d[i] = *params_first++;
+        simd_update(f_first, f_last, b_first, mu);
+        return simd_nhrc(Value(), f_first + 1, f_last, b_first);
+    }
+};
 
-        // Now x_n = 0 because x_{n-p} = ... = x_{n-1} = 0 by construction.
+#if _MSC_VER > 1400
+# pragma float_control(push)
+# pragma float_control(precise, on)
+#endif
+
+/**
+ * Kernels for \ref burg_recursion making a single pass over the prediction
+ * errors per order.  The loop applying one order's update simultaneously
+ * accumulates the numerator and denominator sums for the next order's
+ * reflection coefficient from the just-updated values, halving memory traffic
+ * relative to \ref burg_scalar_kernel.  Because the accumulation visits
+ * values exactly as \ref negative_half_reflection_coefficient would, results
+ * are bit-for-bit identical to \ref burg_scalar_kernel including the constant
+ * signal zero special case and the propagation of any NaN.
+ */
+struct burg_fused_kernel
+{
+    /** Compute negative one half the reflection coefficient. */
+    template <typename Value,
+              typename RandomAccessIterator1,
+              typename RandomAccessIterator2>
+    Value negative_half_reflection_coefficient(
+            RandomAccessIterator1 f_first,
+            RandomAccessIterator1 f_last,
+            RandomAccessIterator2 b_first) const
+    {
+        return ar::negative_half_reflection_coefficient<Value>(
+                f_first, f_last, b_first);
     }
 
     /**
-     * Iterate on the process \f$x_n + a_1 x_{n - 1} + \dots + a_p x_{n - p} =
-     * \epsilon_n\f$ given zero initial conditions.  The process order \f$p\f$
-     * is set by <tt>std::distance(params_first,params_last)</tt>.  The class
-     * <tt>std::tr1::variate_generator</tt> may be helpful in constructing
-     * normally distributed input.
-     *
-     * @param params_first  Beginning of the process parameter range
-     *                      starting with \f$a_1\f$.
-     * @param params_last   End of the process parameter range.
-     * @param generator     A nullary callback for generating \f$\epsilon_n\f$.
-     *                      For example, a random number generator distributed
-     *                      like \f$N\left(0, \sigma^2_\epsilon\right)\f$.
+     * Update the forward and backward prediction errors given \c mu and
+     * compute negative one half the next reflection coefficient in one pass.
      */
-    template <class RandomAccessIterator,
-              class NoiseGenerator>
-    predictor(RandomAccessIterator params_first,
-              RandomAccessIterator params_last,
-              NoiseGenerator generator)
-        : n(0),
-          d(2*std::distance(params_first, params_last), 0),
-          g(new nullary_impl1<Value,NoiseGenerator>(generator)),
-          xn((*g)())
+    template <typename RandomAccessIterator1,
+              typename RandomAccessIterator2,
+              typename Value>
+    Value
+#if (AR_GCC_VERSION > 40305)
+        __attribute__((__optimize__("no-associative-math")))
+#endif
+    update_and_reflect(RandomAccessIterator1 f_first,
+                       RandomAccessIterator1 f_last,
+                       RandomAccessIterator2 b_first,
+                       const Value           mu) const
     {
-        // Finish preparing d = [ a_p, ..., a_1, 0, ..., 0 ]
-        using std::vector;
-        typename vector<Value>::size_type i = d.size() / 2;
-        while (i --> 0) d[i] = *params_first++;
+        Value ns = 0, nt, nc = 0, ny;  // Kahan numerator accumulation
+        Value ds = 0, dt, dc = 0, dy;  // Kahan denominator accumulation
+
+        // Update the first pair which has no partner for the next order
+        Value t1 = *f_first + mu * *b_first;
+        Value t2 = *b_first + mu * *f_first;
+        *f_first++ = t1;
+        *b_first   = t2;
+
+        // Update each subsequent pair and then pair the new forward error
+        // with the previous new backward error exactly as the next order's
+        // negative_half_reflection_coefficient would
+        while (f_first != f_last)
+        {
+            Value xb = t2;             // Previous updated backward error
+
+            ++b_first;
+            t1 = *f_first + mu * *b_first;
+            t2 = *b_first + mu * *f_first;
+            *f_first++ = t1;
+            *b_first   = t2;
+
+            Value xa = t1;             // Denominator: \vec{a}\cdot\vec{a}
+            dy = (xa * xa) - dc;
+            dt = ds + dy;
+            dc = (dt - ds) - dy;
+            ds = dt;
+
+            dy = (xb * xb) - dc;       // Denominator: \vec{b}\cdot\vec{b}
+            dt = ds + dy;
+            dc = (dt - ds) - dy;
+            ds = dt;
+
+            ny = (xa * xb) - nc;       // Numerator:   \vec{a}\cdot\vec{b}
+            nt = ns + ny;
+            nc = (nt - ns) - ny;
+            ns = nt;
+        }
 
-        // Here x_0 = \epsilon_0 because x_{0-p} = ... = x_{0-1} = 0.
+        return ns + nc == 0            // Does special zero case apply?
+            ? 0                        // Yes, to avoid NaN from 0 / 0
+            : (ns + nc) / (ds + dc);   // No, correct final sums and form ratio
     }
+};
 
-    /** Copy constructor */
-    predictor(const predictor& other)
-        : n(other.n),
-          d(other.d),
-          g(other.g ? other.g->clone() : 0),
-          xn(other.xn)
-    {}
+// Helpers for burg_parallel_kernel each accumulating one chunk, storing the
+// Kahan sums and compensations as {numerator, denominator} in p[0], ..., p[3].
+namespace
+{
 
-    /** Assignment operator */
-    predictor& operator=(const predictor& other)
+template <typename Value,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+AR_NO_ASSOCIATIVE_MATH
+void chunk_nhrc(RandomAccessIterator1 a_first,
+                RandomAccessIterator1 a_last,
+                RandomAccessIterator2 b_first,
+                Value*                p)
+{
+    Value ns = 0, nc = 0, ds = 0, dc = 0;
+    for (; a_first != a_last; ++a_first, ++b_first)
     {
-        if (this != &other)
-        {
-            nullary<Value> *tmp = 0;
-            try
-            {
-                tmp = other.g ? other.g->clone() : 0;
-            }
-            catch (...)
-            {
-                delete tmp;
-                throw;
-            }
-            base::operator=(other);
-            n = other.n;
-            d = other.d;
-            delete g;
-            g = tmp;
-            xn = other.xn;
-        }
-        return *this;
+        const Value xa = *a_first, xb = *b_first;
+        kahan_add(ds, dc, xa * xa);
+        kahan_add(ds, dc, xb * xb);
+        kahan_add(ns, nc, xa * xb);
     }
+    p[0] = ns; p[1] = nc; p[2] = ds; p[3] = dc;
+}
 
-    /** Destructor */
-    ~predictor()
+template <typename Value,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+AR_NO_ASSOCIATIVE_MATH
+void chunk_update_and_reflect(RandomAccessIterator1 f_first,
+                              RandomAccessIterator1 f_last,
+                              RandomAccessIterator2 b_first,
+                              const Value           mu,
+                              Value*                p)
+{
+    Value ns = 0, nc = 0, ds = 0, dc = 0;
+    Value t1 = *f_first + mu * *b_first;
+    Value t2 = *b_first + mu * *f_first;
+    *f_first++ = t1;
+    *b_first   = t2;
+    while (f_first != f_last)
     {
-        delete g;
+        const Value xb = t2;
+        ++b_first;
+        t1 = *f_first + mu * *b_first;
+        t2 = *b_first + mu * *f_first;
+        *f_first++ = t1;
+        *b_first   = t2;
+        kahan_add(ds, dc, t1 * t1);
+        kahan_add(ds, dc, xb * xb);
+        kahan_add(ns, nc, t1 * xb);
     }
+    p[0] = ns; p[1] = nc; p[2] = ds; p[3] = dc;
+}
 
-    /**
-     * Specify process initial conditions \f$x_{n-1}, \dots, x_{n-p}\f$ where
-     * \f$p\f$ is the process order fixed by the constructor.  The simulation
-     * index \f$n\f$ is reset to zero and, optionally, \f$x_0\f$ is additively
-     * adjusted by \c x0adjust.
-     *
-     * @param initial_first Beginning of the initial condition range
-     *                      \f$x_{n-1}, \dots, x_{n-p}\f$
-     *                      which must contain \f$p\f$ values.
-     * @param x0adjust      An additive adjustment made to \f$\epsilon_0\f$.
-     */
-    template <class InputIterator>
-    predictor& initial_conditions(InputIterator initial_first,
-                                  const Value x0adjust = 0)
+// The start of chunk t among T chunks partitioning a range of length n
+inline std::size_t chunk_start(const std::size_t n,
+                               const std::size_t t,
+                               const std::size_t T)
+{
+    return n * t / T;
+}
+
+// Accumulate the products spanning chunk boundaries, that is a[lo[t]] and
+// b[lo[t]-1] for each t in [1, T), in the manner of chunk_nhrc.
+template <typename Value,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+AR_NO_ASSOCIATIVE_MATH
+void chunk_boundaries(const std::size_t     n,
+                      const std::size_t     T,
+                      RandomAccessIterator1 a_first,
+                      RandomAccessIterator2 b_first,
+                      Value*                p)
+{
+    Value ns = 0, nc = 0, ds = 0, dc = 0;
+    for (std::size_t t = 1; t < T; ++t)
     {
-        // Zero the simulation time.
-        n = 0;
+        const std::size_t lo = chunk_start(n, t, T);
+        const Value xa = a_first[lo], xb = b_first[lo - 1];
+        kahan_add(ds, dc, xa * xa);
+        kahan_add(ds, dc, xb * xb);
+        kahan_add(ns, nc, xa * xb);
+    }
+    p[0] = ns; p[1] = nc; p[2] = ds; p[3] = dc;
+}
 
-        // Set d = [ a_p, ..., a_1, x_{n-p}, ..., x_{n-1} ]
-        using std::vector;
-        typename vector<Value>::size_type i = d.size();
-        typename vector<Value>::size_type p = i / 2;
-        while (i --> p) d[i] = *initial_first++;
+// Fold one chunk's partial sums p into running totals s laid out likewise.
+// Chunks must be folded in a fixed order for results to be reproducible.
+template <typename Value>
+AR_NO_ASSOCIATIVE_MATH
+void chunk_fold(Value* s, const Value* p)
+{
+    kahan_add(s[0], s[1],  p[0]);
+    kahan_add(s[0], s[1], -p[1]);
+    kahan_add(s[2], s[3],  p[2]);
+    kahan_add(s[2], s[3], -p[3]);
+}
 
-        // Make x_n := - a_p*x_{n-p} - ... - a_1*x_{n-1} + x_n + x0adjust.
-        // By design, x_n was whatever it happened to be.
-        using std::inner_product;
-        xn += x0adjust;
-        xn  = -inner_product(d.begin(), d.begin() + p, d.begin() + p, -xn);
+// Form negative one half the reflection coefficient from totals folded by
+// chunk_fold including the usual special zero case.
+template <typename Value>
+AR_NO_ASSOCIATIVE_MATH
+Value chunk_ratio(const Value* s)
+{
+    const Value num = s[0] - s[1];
+    const Value den = s[2] - s[3];
 
-        return *this;
-    }
+    return num == 0      // Does special zero case apply?
+        ? 0              // Yes, to avoid NaN from 0 / 0
+        : num / den;     // No, form ratio
+}
 
-    // Concept: InputIterator
+}
 
-    /** Prefix increment. */
-    predictor& operator++()
-    {
-        using std::distance;
-        using std::inner_product;
-        using std::vector;
+/**
+ * Multithreaded kernels for \ref burg_recursion suited to very long signals.
+ * Each order performs one OpenMP parallel region, and hence one barrier, in
+ * which every thread updates a contiguous chunk of the prediction errors
+ * while accumulating Kahan-compensated partial sums for the next order's
+ * reflection coefficient per \ref burg_fused_kernel.  Each thread folds its
+ * partials into the totals in chunk order within an OpenMP ordered region
+ * and the few products spanning chunk boundaries are folded in last.  No
+ * scratch is allocated per order.
+ *
+ * When used by \ref burg_method, random access data is also read across the
+ * same chunks while accumulating per-chunk Welford statistics which are
+ * merged pairwise per \ref welford_nvariance_merge.
+ *
+ * Chunk boundaries depend only upon the range length, \c grain, and the
+ * number of threads so results are reproducible bit-for-bit given the same
+ * thread count regardless of scheduling.  When \c nthreads is positive the
+ * same results are obtained even if OpenMP is unavailable, in which case the
+ * chunks are processed serially.  Results differ in the last few bits from
+ * those of \ref burg_scalar_kernel because summation order differs.
+ */
+struct burg_parallel_kernel
+{
+    /** Number of threads to employ or zero to use the OpenMP default. */
+    int nthreads;
 
-        if (g)
+    /** The minimum number of samples per thread to merit another thread. */
+    std::size_t grain;
+
+    /** Construct an instance with the given settings. */
+    explicit burg_parallel_kernel(const int         nthreads = 0,
+                                  const std::size_t grain    = 32768)
+        : nthreads(nthreads), grain(grain)
+    {}
+
+    /** Compute negative one half the reflection coefficient. */
+    template <typename Value,
+              typename RandomAccessIterator1,
+              typename RandomAccessIterator2>
+    Value negative_half_reflection_coefficient(
+            RandomAccessIterator1 f_first,
+            RandomAccessIterator1 f_last,
+            RandomAccessIterator2 b_first) const
+    {
+        const std::size_t n = f_last - f_first;
+        const int T = threads(n);
+        Value s[4] = { 0, 0, 0, 0 };
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(T) schedule(static, 1) ordered
+#endif
+        for (int t = 0; t < T; ++t)
         {
-            typename vector<Value>::size_type p = d.size() / 2;
-            if (p)
-            {
-                // Make x_n = - a_p*x_{n-p} - ... - a_1*x_{n-1} + \epsilon_n
-                // by (conceptually) storing previously computed x_n into
-                // circular buffer, updating ++n, and computing x_{n+1}.
-                typename vector<Value>::iterator ab = d.begin();
-                typename vector<Value>::iterator xb = ab + p;
-                typename vector<Value>::iterator c  = xb + n % p;
-                typename vector<Value>::iterator xe = d.end();
-                *c++ =  xn;
-                xn   =  inner_product(c,  xe, ab,                   -(*g)());
-                xn   = -inner_product(xb,  c, ab + distance(c, xe),   xn   );
-            }
-            else
-            {
-                xn = (*g)();
-            }
+            const std::size_t lo = chunk_start(n, t, T);
+            Value p[4];
+            chunk_nhrc(f_first + lo, f_first + chunk_start(n, t + 1, T),
+                       b_first + lo, p);
+#ifdef _OPENMP
+#pragma omp ordered
+#endif
+            chunk_fold(s, p);
         }
-        else
+
+        return chunk_ratio(s);
+    }
+
+    /**
+     * Update the forward and backward prediction errors given \c mu and
+     * compute negative one half the next reflection coefficient.
+     */
+    template <typename RandomAccessIterator1,
+              typename RandomAccessIterator2,
+              typename Value>
+    Value update_and_reflect(RandomAccessIterator1 f_first,
+                             RandomAccessIterator1 f_last,
+                             RandomAccessIterator2 b_first,
+                             const Value           mu) const
+    {
+        const std::size_t n = f_last - f_first;
+        const int T = threads(n);
+        Value s[4] = { 0, 0, 0, 0 };
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(T) schedule(static, 1) ordered
+#endif
+        for (int t = 0; t < T; ++t)
         {
-#ifndef NDEBUG
-            using std::numeric_limits;
-            if (numeric_limits<Value>::has_quiet_NaN)
-                xn = numeric_limits<Value>::quiet_NaN();
+            const std::size_t lo = chunk_start(n, t, T);
+            Value p[4];
+            chunk_update_and_reflect(f_first + lo,
+                                     f_first + chunk_start(n, t + 1, T),
+                                     b_first + lo, mu, p);
+#ifdef _OPENMP
+#pragma omp ordered
 #endif
+            chunk_fold(s, p);
         }
+        Value p[4];
+        chunk_boundaries(n, T, f_first, b_first, p);
+        chunk_fold(s, p);
 
-        ++n;
-
-        return *this;
+        return chunk_ratio(s);
     }
 
-    /** Postfix increment. */
-    predictor operator++(int) // Postfix increment
+    /** Find the number of chunks for a range of length \c n. */
+    int threads(const std::size_t n) const
     {
-        predictor t(*this);
-        ++*this;
-        return t;
+        std::size_t T = nthreads > 0 ? nthreads : 0;
+#ifdef _OPENMP
+        if (T == 0) T = omp_get_max_threads();
+#endif
+        if (T == 0) T = 1;
+        if (grain && n / grain < T) T = n / grain ? n / grain : 1;
+        if (n < T) T = n ? n : 1;
+        return static_cast<int>(T);
     }
 
-    /** Obtain the process prediction \f$x_n\f$. */
-    reference operator* () const
+    /** Find the number of chunks for a range of length \c n and their starts. */
+    int chunks(const std::size_t n, std::vector<std::size_t>& lo) const
     {
-        return xn;
+        const int T = threads(n);
+        lo.resize(T);
+        for (int t = 0; t < T; ++t) lo[t] = chunk_start(n, t, T);
+        return T;
     }
+};
 
-    // Concept: EqualityComparable
+#if _MSC_VER > 1400
+# pragma float_control(pop)
+#endif
 
-    /** Check if two iterators represent the same simulation time. */
-    bool operator== (const predictor& other) const
+/**
+ * A stopping policy for \ref burg_recursion which never stops early.
+ */
+struct burg_never_stop
+{
+    /** Never request stopping. */
+    template <typename Value>
+    bool operator()(std::size_t, const Value&, const Value&) const
     {
-        return n == other.n;
+        return false;
     }
+};
 
-    /** Check if two iterators represent different simulation times. */
-    bool operator!= (const predictor& other) const
+/**
+ * A stopping policy for \ref burg_recursion ending the recursion at the
+ * first positive order whose reflection coefficient magnitude falls below
+ * \c threshold.  Such an order barely reduces \f$\sigma^2_\epsilon\f$.
+ */
+template <typename Value>
+struct burg_reflection_stop
+{
+    /** Stop once \f$\left|k\right|\f$ is below \c threshold. */
+    explicit burg_reflection_stop(const Value threshold)
+        : threshold(threshold)
+    {}
+
+    /** Stop at order \c p given its reflection coefficient \c k? */
+    bool operator()(std::size_t p, const Value&, const Value& k) const
     {
-        return !(*this == other);
+        using std::abs;
+        return p > 0 && abs(k) < threshold;
     }
 
-private:
+    /** Reflection coefficient magnitude below which to stop. */
+    Value threshold;
+};
 
-    /** Running prediction index. */
-    Index n;
+/**
+ * A stopping policy for \ref burg_recursion ending the recursion once a
+ * criterion has not improved for \c patience consecutive orders.  The
+ * criterion is given as a function pointer, for example one obtained from
+ * \ref criterion_function, and evaluated for \c N samples at orders no less
+ * than \c minorder.  Provided the stop occurs after the order which \ref
+ * best_model would select from the full hierarchy, the same model is
+ * selected.  As \ref burg_recursion operates on a copy, one instance may
+ * be reused across many recursions.
+ */
+template <typename Value>
+class burg_criterion_stop
+{
+public:
 
-    /**
-     * State vector keeping \f$\tilde{a}\f$ in <tt>[d, d+p)</tt> and
-     * \f$x_{n-p},\dots,x_{n-2},x_{n-1}\f$ in <tt>[d+p,d+p+p)/<tt> in circular
-     * buffer fashion where <tt>p = d.size()/2</tt> is the autoregressive
-     * process order.  The current location in circular buffer is maintained
-     * using <tt>d + p + n % p</tt>.
-     */
-    typename std::vector<Value> d;
+    /** Evaluates a criterion given \f$\sigma^2_\epsilon\f$, N, and p. */
+    typedef Value (*evaluator)(Value sigma2e, std::size_t N, std::size_t p);
 
-    /**
-     * Noise generator used at every step.
-     * An instance is singular whenever <tt>!g</tt>.
-     */
-    nullary<Value> *g;
+    /** Stop after \c patience orders without improving \c crit. */
+    burg_criterion_stop(evaluator         crit,
+                        const std::size_t N,
+                        const std::size_t minorder,
+                        const std::size_t patience)
+        : crit(crit), N(N), minorder(minorder), patience(patience),
+          found(false), best(0), best_order(0)
+    {}
 
-    /**
-     * Prediction at current index \c n.  Computed on advance to permit
-     * repeated inexpensive dereferencing and <tt>*i++</tt> usage.
-     */
-    Value xn;
+    /** Stop at order \c p given its \f$\sigma^2_\epsilon\f$? */
+    bool operator()(std::size_t p, const Value& sigma2e, const Value&)
+    {
+        if (p < minorder) return false;
+        const Value c = crit(sigma2e, N, p);
+        if (!found || c < best)
+        {
+            found      = true;
+            best       = c;
+            best_order = p;
+        }
+        return p - best_order >= patience;
+    }
+
+private:
+    evaluator   crit;
+    std::size_t N, minorder, patience;
+    bool        found;
+    Value       best;
+    std::size_t best_order;
 };
 
 /**
- * Construct an iterator over the autocorrelation function \f$\rho_k\f$ given
- * process parameters and initial conditions.
- *
- * @param params_first  Beginning of range containing \f$a_1,\dots,a_p\f$.
- * @param params_last   Exclusive ending of the parameter range.
- * @param gain          The model gain \f$\sigma^2_x / \sigma^2_\epsilon\f$.
- * @param autocor_first Beginning of range containing \f$\rho_0,...\rho_p\f$.
+ * Perform %Burg's recursion given forward and backward prediction error
+ * sequences already initialized from data.  This is the shared engine behind
+ * \ref burg_method and \ref burg_method_inplace which is exposed so that
+ * callers may manage the storage of the prediction errors themselves.
  *
- * @return An InputIterator across the autocorrelation function starting with
- *         \f$\rho_0\f$.
- */
-template <class RandomAccessIterator,
-          class InputIterator,
-          class Value>
-predictor<typename std::iterator_traits<RandomAccessIterator>::value_type>
-autocorrelation(RandomAccessIterator params_first,
-                RandomAccessIterator params_last,
-                Value                gain,
-                InputIterator        autocor_first)
-{
-    predictor<typename std::iterator_traits<
-            RandomAccessIterator
-        >::value_type> p(params_first, params_last);
-    p.initial_conditions(++autocor_first, 1 / gain);
-    return p;
-}
-
-/**
- * Compute the decorrelation time for variance of the mean given
- * autocorrelation details.  That is, compute
- * \f{align}{
- *     T_0 &= 1 + 2 \sum_{i=1}^{N} \left(1 - \frac{i}{N}\right) \rho_i
- * \f}
- * following Trenberth, K. E. "Some effects of finite sample size and
- * persistence on meteorological statistics. Part I: Autocorrelations." Monthly
- * Weather Review 112 (1984).
- * http://dx.doi.org/10.1175/1520-0493(1984)112%3C2359:SEOFSS%3E2.0.CO;2
+ * On entry, the \c N values beginning at \c f_first must contain the data
+ * from which any mean has already been removed.  Whenever \c maxorder is
+ * nonzero, the \c N values beginning at \c b_first must contain a copy of
+ * the same.  Both ranges are overwritten during the recursion.  Outputs, and
+ * the meaning of \c maxorder and \c hierarchy, follow \ref burg_method.
  *
- * Rather than \f$\rho\f$, \f$\left|\rho\right|\f$ may be used in the
- * definition of \f$T_0\f$ to better approximate the "decay of the correlation
- * envelope" according to section 17.1.5 of Hans von Storch and Francis W.
- * Zwiers.  Statistical analysis in climate research. Cambridge University
- * Press, March 2001. ISBN 978-0521012300.  Doing so is more robust for
- * oscillatory processes and always provides a larger, more conservative
- * estimate of \f$T_0\f$.
+ * After every order \f$p\f$ short of \c maxorder, including zero, the
+ * recursion consults <tt>stop(p, sigma2e, k)</tt> given that order's
+ * \f$\sigma^2_\epsilon\f$ and reflection coefficient \f$k\f$, which is
+ * zero for order zero.  Returning \c true ends the recursion at order \f$p\f$
+ * which is then treated as though it were \c maxorder.  See, for example,
+ * \ref burg_never_stop, \ref burg_reflection_stop, and \ref
+ * burg_criterion_stop.  The remaining orders each cost a pass over the data
+ * so stopping early can dramatically reduce the cost of order selection.
  *
- * @param N        Maximum lag used to compute the autocorrelation.
- * @param rho      A \ref predictor iterating over the \ref autocorrelation.
- * @param abs_rho  Use \f$\left|\rho\right|\f$ when calculating \f$T_0\f$?
+ * @param[in,out] f_first       Beginning of the forward prediction errors.
+ * @param[in,out] b_first       Beginning of the backward prediction errors.
+ * @param[in]     N             Number of samples in both error ranges.
+ * @param[in]     sigma2e       Second moment of the data, that is,
+ *                              the innovation variance of AR(0).
+ * @param[in]     maxorder      Maximum model order, at most <tt>N-1</tt>.
+ * @param[out]    params_first  Per \ref burg_method.
+ * @param[out]    sigma2e_first Per \ref burg_method.
+ * @param[out]    gain_first    Per \ref burg_method.
+ * @param[out]    autocor_first Per \ref burg_method.
+ * @param[in]     hierarchy     Should the entire hierarchy of estimated
+ *                              models be output?
+ * @param[in]     Ak            Working storage.  Reuse across invocations
+ *                              may speed execution by avoiding allocations.
+ * @param[in]     ac            Working storage similar to \c Ak.
+ * @param[in]     kernel        Inner loop kernels, for example
+ *                              \ref burg_scalar_kernel,
+ *                              \ref burg_simd_kernel, or
+ *                              \ref burg_fused_kernel.
+ * @param[in]     stop          Stopping policy invoked with each order.
  *
- * @return The decorrelation time \f$T_0\f$ assuming \f$\Delta{}t=1\f$.
+ * @returns the maximum model order computed, at most \c maxorder.
  */
-template <class Value>
-Value decorrelation_time(const std::size_t N,
-                         predictor<Value> rho,
-                         const bool abs_rho = false)
+template <class RandomAccessIterator1,
+          class RandomAccessIterator2,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class Vector,
+          class Kernel,
+          class Stop>
+std::size_t burg_recursion(RandomAccessIterator1 f_first,
+                           RandomAccessIterator2 b_first,
+                           const std::size_t     N,
+                           Value                 sigma2e,
+                           const std::size_t     maxorder,
+                           OutputIterator1       params_first,
+                           OutputIterator2       sigma2e_first,
+                           OutputIterator3       gain_first,
+                           OutputIterator4       autocor_first,
+                           const bool            hierarchy,
+                           Vector&               Ak,
+                           Vector&               ac,
+                           const Kernel&         kernel,
+                           Stop                  stop)
 {
-    using std::abs;
+    using std::copy;
+    using std::inner_product;
     using std::size_t;
 
-    Value T0 = *rho++;
+    assert(maxorder == 0 || maxorder < N);
 
-    const Value twoinvN = Value(2) / N;
-    if (abs_rho) {
-        for (size_t i = 1; i <= N; ++i, ++rho)
-            T0 += (2 - i*twoinvN) * abs(*rho);
-    } else {
-        for (size_t i = 1; i <= N; ++i, ++rho)
-            T0 += (2 - i*twoinvN) * (*rho);
+    // Output sigma2e and gain for a zeroth order model, if requested.
+    // The recursion is skipped entirely should stop request order zero.
+    size_t reached = maxorder;
+    if (maxorder && stop(size_t(0), sigma2e, Value(0))) reached = 0;
+    Value gain = 1;
+    if (hierarchy || reached == 0)
+    {
+        *sigma2e_first++ = sigma2e;
+        *gain_first++    = gain;
     }
 
-    return T0;
-}
+    // Initialize and perform Burg recursion
+    Ak.assign(maxorder + 1, Value(0));
+    Ak[0] = 1;
+    ac.clear();
+    ac.reserve(maxorder);
+    Value nhrc = reached == 0 ? 0 : kernel.template
+        negative_half_reflection_coefficient<Value>(
+            f_first + 1, f_first + N, b_first);
+    for (size_t kp1 = 1; kp1 <= reached; ++kp1)
+    {
+        // Compute mu from f, b, and Dk and then update sigma2e and Ak using mu
+        // Afterwards, Ak[1:kp1] contains AR(k) coefficients by the recurrence
+        // Must treat mu result of 0 / 0 as 0 to avoid NaNs on constant signals
+        // By the recurrence, Ak[kp1] will also be the reflection coefficient
+        Value mu = -2 * nhrc;
 
-/**
- * Compute the decorrelation time for a covariance given autocorrelation
- * details from two processes.  That is, compute
- * \f{align}{
- *     T_0 &= 1 + 2 \sum_{i=1}^{N} \left(1 - \frac{i}{N}\right)
- *                                 \rho_{1,i} \rho_{2,i}
- * \f}
- * following Trenberth, K. E. "Some effects of finite sample size and
- * persistence on meteorological statistics. Part I: Autocorrelations." Monthly
- * Weather Review 112 (1984).
- * http://dx.doi.org/10.1175/1520-0493(1984)112%3C2359:SEOFSS%3E2.0.CO;2
- *
- * Rather than \f$\rho\f$, \f$\left|\rho\right|\f$ may be used in the
- * definition of \f$T_0\f$ to better approximate the "decay of the correlation
- * envelope" according to section 17.1.5 of Hans von Storch and Francis W.
- * Zwiers.  Statistical analysis in climate research. Cambridge University
- * Press, March 2001. ISBN 978-0521012300.  Doing so is more robust for
- * oscillatory processes and always provides a larger, more conservative
- * estimate of \f$T_0\f$.
- *
- * @param N        Maximum lag used to compute the autocorrelation.
- * @param rho1     A \ref predictor iterating over the \ref autocorrelation
- *                 for the first process.
- * @param rho2     A \ref predictor iterating over the \ref autocorrelation
- *                 for the first process.
- * @param abs_rho  Use \f$\left|\rho\right|\f$ when calculating \f$T_0\f$?
- *
- * @return The decorrelation time \f$T_0\f$ assuming \f$\Delta{}t=1\f$.
- */
-template <class Value>
-Value decorrelation_time(const std::size_t N,
-                         predictor<Value> rho1,
-                         predictor<Value> rho2,
-                         const bool abs_rho = false)
-{
-    using std::abs;
-    using std::size_t;
+        sigma2e *= (1 - mu*mu);
+        for (size_t n = 0; n <= kp1/2; ++n)
+        {
+            Value t1 = Ak[n] + mu*Ak[kp1 - n];
+            Value t2 = Ak[kp1 - n] + mu*Ak[n];
+            Ak[n] = t1;
+            Ak[kp1 - n] = t2;
+        }
 
-    Value T0 = 1;
-    ++rho1;
-    ++rho2;
+        // Update the gain per Broersen 2006 equation (5.25)
+        gain *= 1 / (1 - Ak[kp1]*Ak[kp1]);
 
-    const Value twoinvN = Value(2) / N;
-    if (abs_rho) {
-        for (size_t i = 1; i <= N; ++i, ++rho1, ++rho2)
-            T0 += (2 - i*twoinvN) * abs((*rho1) * (*rho2));
-    } else {
-        for (size_t i = 1; i <= N; ++i, ++rho1, ++rho2)
-            T0 += (2 - i*twoinvN) * ((*rho1) * (*rho2));
+        // Compute and output the next autocorrelation coefficient
+        // See Broersen 2006 equations (5.28) and (5.31) for details
+        ac.push_back(-inner_product(ac.rbegin(), ac.rend(),
+                                    Ak.begin() + 1, Ak[kp1]));
+
+        // Is this the final order either by exhaustion or by request?
+        const bool last = kp1 == maxorder || stop(kp1, sigma2e, Ak[kp1]);
+        if (last) reached = kp1;
+
+        // Output parameters and the input and output variances when requested
+        if (hierarchy || last)
+        {
+            params_first = copy(Ak.begin() + 1, Ak.begin() + kp1 + 1,
+                                params_first);
+            *sigma2e_first++ = sigma2e;
+            *gain_first++    = gain;
+        }
+
+        // Update f and b and find the next mu if another iteration remains
+        if (!last)
+        {
+            nhrc = kernel.update_and_reflect(
+                    f_first + kp1, f_first + N, b_first, mu);
+        }
     }
 
-    return T0;
+    // Output the lag [0,reached] autocorrelation coefficients in single pass
+    *autocor_first++ = 1;
+    copy(ac.begin(), ac.end(), autocor_first);
+
+    return reached;
 }
 
 /**
- * Solve a Toeplitz set of linear equations.  That is, find \f$s_{n+1}\f$
- * satisfying
- * \f[
- *      L_{n+1} s_{n+1} = d_{n+1}
- *      \mbox{ where }
- *      L_{n+1} = \bigl(\begin{smallmatrix}
- *                    1   & \tilde{a}_n \\
- *                    r_n & L_n
- *                \end{smallmatrix}\bigr)
- * \f]
- * given \f$\vec{a}\f$, \f$\vec{r}\f$, and \f$\vec{d}\f$.  The dimension of the
- * problem is fixed by <tt>n = distance(a_first, a_last)</tt>.  A symmetric
- * Toeplitz solve can be performed by having \f$\vec{a}\f$ and \f$\vec{r}\f$
- * iterate over the same data.  The Hermitian case requires two buffers with
- * \f$vec{r}\f$ being the conjugate of \f$\vec{a}\f$.  The working precision
- * is fixed by the \c value_type of \c d_first.
- *
- * The algorithm is from Zohar, Shalhav. "The Solution of a Toeplitz Set of
- * Linear Equations." J. ACM 21 (April 1974): 272-276.
- * http://dx.doi.org/10.1145/321812.321822.  It has complexity like
- * <tt>O(2*(n+1)^2)</tt>.  Zohar improved upon earlier work from Page 1504 from
- * Trench, William F. "Weighting Coefficients for the Prediction of Stationary
- * Time Series from the Finite Past." SIAM Journal on Applied Mathematics 15
- * (November 1967): 1502-1510.  http://www.jstor.org/stable/2099503.See
- * Bunch, James R. "Stability of Methods for Solving Toeplitz Systems of
- * Equations." SIAM Journal on Scientific and Statistical Computing 6 (1985):
- * 349-364. http://dx.doi.org/10.1137/0906025 for a discussion of the
- * algorithm's stability characteristics.
- *
- * @param[in]  a_first Beginning of the range containing \f$\vec{a}\f$.
- * @param[in]  a_last  End of the range containing \f$\vec{a}\f$.
- * @param[in]  r_first Beginning of the range containing \f$\vec{r}\f$.
- * @param[in]  d_first Beginning of the range containing \f$\vec{d}\f$
- *                     which should have <tt>n+1</tt> entries available.
- * @param[out] s_first Beginning of the output range to which
- *                     <tt>n+1</tt> entries will be written.
+ * Perform %Burg's recursion through \c maxorder using \ref burg_never_stop.
+ * @copydetails burg_recursion(RandomAccessIterator1,RandomAccessIterator2,const std::size_t,Value,const std::size_t,OutputIterator1,OutputIterator2,OutputIterator3,OutputIterator4,const bool,Vector&,Vector&,const Kernel&,Stop)
  */
-template<class RandomAccessIterator,
-         class InputIterator,
-         class OutputIterator>
-void zohar_linear_solve(RandomAccessIterator a_first,
-                        RandomAccessIterator a_last,
-                        RandomAccessIterator r_first,
-                        InputIterator        d_first,
-                        OutputIterator       s_first)
+template <class RandomAccessIterator1,
+          class RandomAccessIterator2,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class Vector,
+          class Kernel>
+std::size_t burg_recursion(RandomAccessIterator1 f_first,
+                           RandomAccessIterator2 b_first,
+                           const std::size_t     N,
+                           Value                 sigma2e,
+                           const std::size_t     maxorder,
+                           OutputIterator1       params_first,
+                           OutputIterator2       sigma2e_first,
+                           OutputIterator3       gain_first,
+                           OutputIterator4       autocor_first,
+                           const bool            hierarchy,
+                           Vector&               Ak,
+                           Vector&               ac,
+                           const Kernel&         kernel)
 {
-    using std::copy;
-    using std::distance;
-    using std::inner_product;
-    using std::invalid_argument;
-    using std::iterator_traits;
-    using std::reverse_iterator;
-    using std::vector;
+    return burg_recursion(f_first, b_first, N, sigma2e, maxorder,
+                          params_first, sigma2e_first, gain_first,
+                          autocor_first, hierarchy, Ak, ac, kernel,
+                          burg_never_stop());
+}
 
-    // Tildes indicate transposes while hats indicate reversed vectors.
+/**
+ * Perform %Burg's recursion using \ref burg_scalar_kernel.
+ * @copydetails burg_recursion(RandomAccessIterator1,RandomAccessIterator2,const std::size_t,Value,const std::size_t,OutputIterator1,OutputIterator2,OutputIterator3,OutputIterator4,const bool,Vector&,Vector&,const Kernel&,Stop)
+ */
+template <class RandomAccessIterator1,
+          class RandomAccessIterator2,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class Vector>
+std::size_t burg_recursion(RandomAccessIterator1 f_first,
+                           RandomAccessIterator2 b_first,
+                           const std::size_t     N,
+                           Value                 sigma2e,
+                           const std::size_t     maxorder,
+                           OutputIterator1       params_first,
+                           OutputIterator2       sigma2e_first,
+                           OutputIterator3       gain_first,
+                           OutputIterator4       autocor_first,
+                           const bool            hierarchy,
+                           Vector&               Ak,
+                           Vector&               ac)
+{
+    return burg_recursion(f_first, b_first, N, sigma2e, maxorder,
+                          params_first, sigma2e_first, gain_first,
+                          autocor_first, hierarchy, Ak, ac,
+                          burg_scalar_kernel());
+}
 
-    // InputIterator::value_type determines the working precision
-    typedef typename iterator_traits<InputIterator>::value_type value_type;
-    typedef vector<value_type> vector_type;
-    typedef typename vector_type::size_type size_type;
+// Helpers for burg_method loading data into the forward and backward
+// prediction errors.  One pass reads the data while accumulating its mean and
+// centered sum of squares by Welford's algorithm in sample order and a second
+// pass writes the centered data into both f and, when needed, b.
+namespace
+{
 
-    // Determine problem size using [a_first,a_last) and ensure nontrivial
-    typename iterator_traits<RandomAccessIterator>::difference_type dist
-            = distance(a_first, a_last);
-    if (dist < 1) throw invalid_argument("distance(a_first, a_last) < 1");
-    const size_type n = static_cast<size_type>(dist);
-
-    // Allocate working storage and set initial values for recursion:
-    vector_type s;    s   .reserve(n+1); s   .push_back( *d_first);
-    vector_type ehat; ehat.reserve(n  ); ehat.push_back(-a_first[0]);
-    vector_type g;    g   .reserve(n  ); g   .push_back(-r_first[0]);
-    value_type lambda  = 1 - a_first[0]*r_first[0];
-
-    // Though recursive updates to s and g can be done in-place, updates to
-    // ehat seemingly require one additional vector for storage:
-    //
-    // "This sequence of computations is economical of storage.  It is only
-    // necessary to retain quantities computed at level m - 1 until the
-    // computations at level m are complete." [Trench1967, page 1504]
-    vector_type next_ehat; next_ehat.reserve(n);
+/** Reserve storage for forward ranges whose length is known in advance. */
+template <class Storage, class InputIterator>
+void burg_ingest_reserve(Storage&, InputIterator, InputIterator,
+                         std::input_iterator_tag)
+{}
+
+/** \copydoc burg_ingest_reserve */
+template <class Storage, class ForwardIterator>
+void burg_ingest_reserve(Storage&        f,
+                         ForwardIterator data_first,
+                         ForwardIterator data_last,
+                         std::forward_iterator_tag)
+{
+    f.reserve(std::distance(data_first, data_last));
+}
 
-    // Recursion for i = {1, 2, ..., n - 1}:
-    for (size_type i = 1; i < n; ++i)
+/**
+ * Append <tt>[data_first, data_last)</tt> to an empty \c f while computing
+ * its mean \c m and centered sum of squares \c nv per \ref
+ * welford_nvariance.
+ */
+template <class InputIterator, class Value, class Allocator>
+void burg_ingest_read(InputIterator                  data_first,
+                      InputIterator                  data_last,
+                      std::vector<Value, Allocator>& f,
+                      Value&                         m,
+                      Value&                         nv,
+                      std::input_iterator_tag)
+{
+    f.clear();
+    std::size_t N = 1;
+    m = nv = 0;
+    for (; data_first != data_last; ++data_first)
     {
-
-        reverse_iterator<RandomAccessIterator> rhat_first(r_first + i);
-
-        // \theta_i =  \delta_{i+1}  - \tilde{s}_i \hat{r}_i
-        const value_type neg_theta = inner_product(
-                s.begin(), s.end(), rhat_first, value_type(-(*++d_first)));
-
-        // \eta_i   = -\rho_{-(i+1)} - \tilde{a}_i \hat{e}_i
-        const value_type neg_eta   = inner_product(
-                ehat.begin(), ehat.end(), a_first, value_type(a_first[i]));
-
-        // \gamma_i = -\rho_{i+1}    - \tilde{g}_i \hat{r}_i
-        const value_type neg_gamma = inner_product(
-                g.begin(), g.end(), rhat_first, value_type(r_first[i]));
-
-        /*
-         * s_{i+1} = \bigl(\begin{smallmatrix}
-         *              s_i + (\theta_i/\lambda_i) \hat{e}_i \\
-         *              \theta_i/\lambda_i
-         *          \end{smallmatrix}\bigr)
-         *
-         * \hat{e}_{i+1} = \bigl(\begin{smallmatrix}
-         *                     \eta_i/\lambda_i \\
-         *                     \hat{e}_i + (\eta_i/\lambda_i) g_i
-         *                 \end{smallmatrix}\bigr)
-         *
-         * g_{i+1} = \bigl(\begin{smallmatrix}
-         *               g_i + (\gamma_i/\lambda_i) \hat{e}_i \\
-         *               \gamma_i/\lambda_i
-         *           \end{smallmatrix}\bigr)
-         */
-        const value_type theta_by_lambda = -neg_theta/lambda;
-        const value_type   eta_by_lambda = -neg_eta  /lambda;
-        const value_type gamma_by_lambda = -neg_gamma/lambda;
-        next_ehat.clear();
-        next_ehat.push_back(eta_by_lambda);
-        for (size_type j = 0; j < i; ++j)
-        {
-            s[j] += theta_by_lambda*ehat[j];
-            next_ehat.push_back(ehat[j] + eta_by_lambda*g[j]);
-            g[j] += gamma_by_lambda*ehat[j];
-        }
-        s.push_back(theta_by_lambda);
-        g.push_back(gamma_by_lambda);
-        ehat.swap(next_ehat);
-
-        // \lambda_{i+1} = \lambda_i - \eta_i \gamma_i / \lambda_i
-        lambda -= neg_eta*neg_gamma/lambda;
+        const Value x = *data_first;
+        f.push_back(x);
+        const Value d = x - m;
+        m  += d / N++;
+        nv += d*(x - m);
     }
+}
 
-    // Recursion for i = n differs slightly per Zohar's "Last Computed Values"
-    // Computing g_n above was unnecessary but the incremental expense is small
+/** \copydoc burg_ingest_read */
+template <class ForwardIterator, class Value, class Allocator>
+void burg_ingest_read(ForwardIterator                data_first,
+                      ForwardIterator                data_last,
+                      std::vector<Value, Allocator>& f,
+                      Value&                         m,
+                      Value&                         nv,
+                      std::forward_iterator_tag)
+{
+    // Sizing f first permits plain stores rather than push_back
+    f.resize(std::distance(data_first, data_last));
+    Value * const fp = f.empty() ? 0 : &f[0];
+    const std::size_t n = f.size();
+    Value mk = 0, nvk = 0;
+    for (std::size_t i = 0; i < n; ++i, ++data_first)
     {
-        reverse_iterator<RandomAccessIterator> rhat_first(r_first + n);
+        const Value x = *data_first;
+        fp[i] = x;
+        const Value d = x - mk;
+        mk  += d / (i + 1);
+        nvk += d*(x - mk);
+    }
+    m  = mk;
+    nv = nvk;
+}
 
-        // \theta_n =  \delta_{n+1}  - \tilde{s}_n \hat{r}_n
-        const value_type neg_theta = inner_product(
-                s.begin(), s.end(), rhat_first, value_type(-(*++d_first)));
+/**
+ * Copy <tt>[data_first, data_last)</tt> into \c f storing its \c mean and
+ * either its population variance, when \c subtract_mean is true and the mean
+ * will be removed from \c f, or otherwise its second moment in \c sigma2e.
+ * When \c copy_b is true, \c b receives a copy of the final \c f.  This
+ * general case handles storage whose precision may be lower than that of \c
+ * Value.  Samples are shifted by the first one in the working precision
+ * before being stored so that signals with a large mean relative to their
+ * fluctuations retain the full storage precision.  Welford's algorithm runs
+ * in the working precision over the shifted samples before they are narrowed
+ * into storage, so long signals do not lose accuracy in \c mean or \c
+ * sigma2e to the storage precision.
+ */
+template <class InputIterator, class Value, class Storage>
+void burg_ingest(InputIterator  data_first,
+                 InputIterator  data_last,
+                 Value&         mean,
+                 Value&         sigma2e,
+                 const bool     subtract_mean,
+                 Storage&       f,
+                 Storage&       b,
+                 const bool     copy_b)
+{
+    typedef typename Storage::value_type storage_type;
+
+    f.clear();
+    burg_ingest_reserve(f, data_first, data_last,
+        typename std::iterator_traits<InputIterator>::iterator_category());
+    Value shift = 0;
+    if (subtract_mean && data_first != data_last) shift = *data_first;
+    std::size_t N  = 1;
+    Value       m  = 0;
+    Value       nv = 0;
+    for (; data_first != data_last; ++data_first)
+    {
+        const Value x = Value(*data_first) - shift;
+        f.push_back(static_cast<storage_type>(x));
+        const Value d = x - m;
+        m  += d / N++;
+        nv += d*(x - m);
+    }
+    mean    = m;
+    sigma2e = nv;
+    sigma2e /= N - 1;
 
-        /*
-         * s_{n+1} = \bigl(\begin{smallmatrix}
-         *              s_n + (\theta_n/\lambda_n) \hat{e}_n \\
-         *              \theta_n/\lambda_n
-         *          \end{smallmatrix}\bigr)
-         */
-        const value_type theta_by_lambda = -neg_theta/lambda;
-        for (size_type j = 0; j < n; ++j)
+    if (copy_b) b.resize(f.size());
+    if (subtract_mean)
+    {
+        typename Storage::iterator j = b.begin();
+        for (typename Storage::iterator i = f.begin(); i != f.end(); ++i)
         {
-            s[j] += theta_by_lambda*ehat[j];
+            *i = static_cast<storage_type>(*i - mean);
+            if (copy_b) *j++ = *i;
         }
-        s.push_back(theta_by_lambda);
+        mean += shift;
+    }
+    else
+    {
+        sigma2e += mean*mean;
+        if (copy_b) std::copy(f.begin(), f.end(), b.begin());
     }
-
-    // Output solution
-    copy(s.begin(), s.end(), s_first);
 }
 
 /**
- * Solve a Toeplitz set of linear equations in-place.  That is, compute
- * \f[
- *      L_{n+1}^{-1} d_{n+1}
- *      \mbox{ for }
- *      L_{n+1} = \bigl(\begin{smallmatrix}
- *                    1   & \tilde{a}_n \\
- *                    r_n & L_n
- *                \end{smallmatrix}\bigr)
- * \f]
- * given \f$\vec{a}\f$, \f$\vec{r}\f$, and \f$\vec{d}\f$.  The dimension of the
- * problem is fixed by <tt>n = distance(a_first, a_last)</tt>.  A symmetric
- * Toeplitz solve can be performed by having \f$\vec{a}\f$ and \f$\vec{r}\f$
- * iterate over the same data.  The Hermitian case requires two buffers with
- * \f$vec{r}\f$ being the conjugate of \f$\vec{a}\f$.  The working precision
- * is fixed by the \c value_type of \c d_first.
- *
- * @param[in]     a_first Beginning of the range containing \f$\vec{a}\f$.
- * @param[in]     a_last  End of the range containing \f$\vec{a}\f$.
- * @param[in]     r_first Beginning of the range containing \f$\vec{r}\f$.
- * @param[in,out] d_first Beginning of the range containing \f$\vec{d}\f$.
- *                        Also the beginning of the output range to which
- *                        <strong><tt>n+1</tt></strong> entries will be
- *                        written.
+ * Copy <tt>[data_first, data_last)</tt> into \c f per the general \ref
+ * burg_ingest when storage matches the working precision.  No shift is
+ * required so the mean is subtracted exactly as computed.
  */
-template<class RandomAccessIterator,
-         class ForwardIterator>
-void zohar_linear_solve(RandomAccessIterator a_first,
-                        RandomAccessIterator a_last,
-                        RandomAccessIterator r_first,
-                        ForwardIterator      d_first)
+template <class InputIterator, class Value, class Allocator>
+void burg_ingest(InputIterator                  data_first,
+                 InputIterator                  data_last,
+                 Value&                         mean,
+                 Value&                         sigma2e,
+                 const bool                     subtract_mean,
+                 std::vector<Value, Allocator>& f,
+                 std::vector<Value, Allocator>& b,
+                 const bool                     copy_b)
 {
-    return zohar_linear_solve(a_first, a_last, r_first, d_first, d_first);
-}
+    // Stably compute the incoming data's mean and population variance
+    // while reading it exactly as welford_nvariance would
+    Value m, nv;
+    burg_ingest_read(data_first, data_last, f, m, nv,
+        typename std::iterator_traits<InputIterator>::iterator_category());
+    mean    = m;
+    sigma2e = nv / f.size();
 
+    // When requested, subtract the just-computed mean from the data.
+    // Adjust, if necessary, to make sigma2e the second moment.
+    const std::size_t n = f.size();
+    if (copy_b) b.resize(n);
+    Value * const fp = n ? &f[0] : 0;
+    Value * const bp = n && copy_b ? &b[0] : 0;
+    if (subtract_mean)
+    {
+        if (copy_b) for (std::size_t i = 0; i < n; ++i) bp[i] = fp[i] -= m;
+        else        for (std::size_t i = 0; i < n; ++i) fp[i] -= m;
+    }
+    else
+    {
+        sigma2e += mean*mean;
+        if (copy_b) std::copy(fp, fp + n, bp);
+    }
+}
 
 /**
- * Solve a real-valued, symmetric Toeplitz set of linear equations in-place.
- * That is, compute
- * \f[
- *      L_{n+1}^{-1} d_{n+1}
- *      \mbox{ for }
- *      L_{n+1} = \bigl(\begin{smallmatrix}
- *                    1   & \tilde{a}_n \\
- *                    a_n & L_n
- *                \end{smallmatrix}\bigr)
- * \f]
- * given \f$\vec{a}\f$ and \f$\vec{d}\f$.  The dimension of the problem is
- * fixed by <tt>n = distance(a_first, a_last)</tt>.  The working precision is
- * fixed by the \c value_type of \c d_first.
- *
- * @param[in]     a_first Beginning of the range containing \f$\vec{a}\f$.
- * @param[in]     a_last  End of the range containing \f$\vec{a}\f$.
- * @param[in,out] d_first Beginning of the range containing \f$\vec{d}\f$.
- *                        Also the beginning of the output range to which
- *                        <strong><tt>n+1</tt></strong> entries will be
- *                        written.
+ * Ingest data per \ref burg_ingest for kernels processing one thread's
+ * worth of data at a time.
  */
-template<class RandomAccessIterator,
-         class ForwardIterator>
-void zohar_linear_solve(RandomAccessIterator a_first,
-                        RandomAccessIterator a_last,
-                        ForwardIterator      d_first)
+template <class InputIterator, class Value, class Storage, class Kernel>
+void burg_ingest(InputIterator  data_first,
+                 InputIterator  data_last,
+                 Value&         mean,
+                 Value&         sigma2e,
+                 const bool     subtract_mean,
+                 Storage&       f,
+                 Storage&       b,
+                 const bool     copy_b,
+                 const Kernel&)
 {
-    return zohar_linear_solve(a_first, a_last, a_first, d_first);
+    burg_ingest(data_first, data_last, mean, sigma2e,
+                subtract_mean, f, b, copy_b);
 }
 
-/**
- * @}
- */
-
-/////////////////////////////////////////////////////////////////////////////
-/////////////////////////////////////////////////////////////////////////////
-/////////////////////////////////////////////////////////////////////////////
+/** Sequential fallback for \ref burg_parallel_kernel given input iterators. */
+template <class InputIterator, class Value, class Allocator>
+void burg_ingest_parallel(InputIterator                  data_first,
+                          InputIterator                  data_last,
+                          Value&                         mean,
+                          Value&                         sigma2e,
+                          const bool                     subtract_mean,
+                          std::vector<Value, Allocator>& f,
+                          std::vector<Value, Allocator>& b,
+                          const bool                     copy_b,
+                          const burg_parallel_kernel&,
+                          std::input_iterator_tag)
+{
+    burg_ingest(data_first, data_last, mean, sigma2e,
+                subtract_mean, f, b, copy_b);
+}
 
 /**
- * Method-specific estimation variance routines following Broersen.
- *
- * For details see either the FiniteSampleCriteria.tex write up or Broersen,
- * P. M. T. "Finite sample criteria for autoregressive order selection." IEEE
- * Transactions on Signal Processing 48 (December 2000): 3550-3558.
- * http://dx.doi.org/10.1109/78.887047.
- *
- * The selection criteria routines might be sped up for floating point
- * arguments given an appropriate digamma (psi) or Pochhammer symbol
- * implementation.  To do so with the GNU Scientific Library (GSL), e.g., try
- * @code
- *     #include <gsl/gsl_sf_psi.h>
- *     #define AR_DIGAMMA(x) gsl_sf_psi(x)
- *
- *     #include <gsl/gsl_sf_gamma.h>
- *     #define AR_POCHHAMMER(a,x) gsl_sf_poch(a,x)
- * @endcode
- * before including this header and link the GSL with your binary.
- * @{
+ * Ingest random access data across threads using the chunks of \ref
+ * burg_parallel_kernel.  Each chunk is read once while its Welford mean and
+ * centered sum of squares are accumulated.  Chunks are merged pairwise per
+ * \ref welford_nvariance_merge in a fixed tree order so results depend only
+ * upon the number of chunks.  A second parallel pass centers \c f and fills
+ * \c b.
  */
-
-/** Denotes the sample mean was subtracted from a signal before estimation. */
-struct mean_subtracted
+template <class RandomAccessIterator, class Value, class Allocator>
+void burg_ingest_parallel(RandomAccessIterator           data_first,
+                          RandomAccessIterator           data_last,
+                          Value&                         mean,
+                          Value&                         sigma2e,
+                          const bool                     subtract_mean,
+                          std::vector<Value, Allocator>& f,
+                          std::vector<Value, Allocator>& b,
+                          const bool                     copy_b,
+                          const burg_parallel_kernel&    kernel,
+                          std::random_access_iterator_tag)
 {
-    /** Computes the empirical variance estimate for order zero. */
-    template <typename Result, typename Integer>
-    static Result empirical_variance_zero(Integer N)
-    {
-        assert(N >= 1);
+    using std::size_t;
 
-        Result den = N;
-        return 1 / den;
+    const size_t N = data_last - data_first;
+    std::vector<size_t> lo;
+    const int T = kernel.chunks(N, lo);
+    if (T < 2)
+    {
+        burg_ingest(data_first, data_last, mean, sigma2e,
+                    subtract_mean, f, b, copy_b);
+        return;
     }
-};
+    lo.push_back(N);
+    f.resize(N);
+    if (copy_b) b.resize(N);
+    std::vector<Value> m(T), nv(T);
 
-/** Denotes the sample mean was retained in a signal during estimation. */
-struct mean_retained
-{
-    /** Computes the empirical variance estimate for order zero. */
-    template <typename Result, typename Integer>
-    static Result empirical_variance_zero(Integer)
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(T) schedule(static, 1)
+#endif
+    for (int t = 0; t < T; ++t)
     {
-        return 0;
+        size_t n  = 1;
+        Value  mt = 0, nvt = 0;
+        for (size_t i = lo[t]; i < lo[t + 1]; ++i)
+        {
+            const Value x = data_first[i];
+            f[i] = x;
+            const Value d = x - mt;
+            mt  += d / n++;
+            nvt += d*(x - mt);
+        }
+        m[t]  = mt;
+        nv[t] = nvt;
     }
-};
-
-namespace { // anonymous
-
-// Oh the simultaneous love/hate because -Werror => -Werror=type-limits...
 
-template <typename T, bool> struct is_nonnegative_helper;
+    // Merge neighboring chunks pairwise, doubling the span each sweep
+    for (int s = 1; s < T; s *= 2)
+    {
+        for (int t = 0; t + s < T; t += 2*s)
+        {
+            const int u = std::min(t + 2*s, T);
+            welford_nvariance_merge(lo[t + s] - lo[t], m[t], nv[t],
+                                    lo[u] - lo[t + s], m[t + s], nv[t + s]);
+        }
+    }
+    mean    = m[0];
+    sigma2e = nv[0] / N;
+    if (!subtract_mean) sigma2e += mean*mean;
 
-template <typename T> struct is_nonnegative_helper<T, /*signed?*/ true>
-{
-    static bool check(const T& t) { return t >= 0; }
-};
-
-template <typename T> struct is_nonnegative_helper<T, /*signed?*/ false>
-{
-    static bool check(const T&) { return true; }
-};
+    const Value shift = subtract_mean ? mean : Value(0);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(T) schedule(static, 1)
+#endif
+    for (int t = 0; t < T; ++t)
+    {
+        for (size_t i = lo[t]; i < lo[t + 1]; ++i)
+        {
+            f[i] -= shift;
+            if (copy_b) b[i] = f[i];
+        }
+    }
+}
 
-template <typename T> bool is_nonnegative(const T& t)
+/**
+ * Ingest data per \ref burg_ingest for \ref burg_parallel_kernel, reading
+ * random access data across threads.
+ */
+template <class InputIterator, class Value, class Allocator>
+void burg_ingest(InputIterator                  data_first,
+                 InputIterator                  data_last,
+                 Value&                         mean,
+                 Value&                         sigma2e,
+                 const bool                     subtract_mean,
+                 std::vector<Value, Allocator>& f,
+                 std::vector<Value, Allocator>& b,
+                 const bool                     copy_b,
+                 const burg_parallel_kernel&    kernel)
 {
-    using std::numeric_limits;
-    return is_nonnegative_helper<T,numeric_limits<T>::is_signed>::check(t);
+    burg_ingest_parallel(data_first, data_last, mean, sigma2e,
+        subtract_mean, f, b, copy_b, kernel,
+        typename std::iterator_traits<InputIterator>::iterator_category());
 }
 
 }
 
+// Helpers for burg_method_fixed unrolling the order recursion at compile time
+// and for dispatching small orders to it from burg_method.
+namespace
+{
+
+/** Recursion state for order \c P residing entirely on the stack. */
+template <typename Value, std::size_t P>
+struct burg_fixed_state
+{
+    Value Ak[P + 1];
+    Value ac[P ? P : 1];
+    Value sigma2e;
+    Value gain;
+    Value nhrc;
+};
 
 /**
- * A parent type for autoregressive process parameter estimation techniques.
- *
- * Each subclass should have an <tt>empirical_variance(N, i)</tt> method
- * following Broersen, P. M. and H. E. Wensink. "On Finite Sample Theory for
- * Autoregressive Model Order Selection." IEEE Transactions on Signal
- * Processing 41 (January 1993): 194+.
- * http://dx.doi.org/10.1109/TSP.1993.193138.
+ * Perform order \c K of a fixed order \c P %Burg recursion exactly as \ref
+ * burg_recursion would with \ref burg_scalar_kernel and then instantiate
+ * order <tt>K + 1</tt>.  Every loop bound is a compile-time constant.
  */
-struct estimation_method {};
-
-/** Represents estimation by solving the Yule--Walker equations. */
-template <class MeanHandling>
-class YuleWalker : public estimation_method
+template <std::size_t P, std::size_t K, bool Done = (K > P)>
+struct burg_fixed_order
 {
-public:
-
-    /**
-     * Approximates the empirical variance estimate.
-     * @param N Number of observations.
-     * @param i Variance order.
-     */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result empirical_variance(Integer1 N, Integer2 i)
+    template <class RandomAccessIterator1,
+              class RandomAccessIterator2,
+              class Value,
+              class OutputIterator1,
+              class OutputIterator2,
+              class OutputIterator3>
+    static void apply(RandomAccessIterator1      f_first,
+                      RandomAccessIterator2      b_first,
+                      const std::size_t          N,
+                      burg_fixed_state<Value,P>& s,
+                      OutputIterator1&           params_first,
+                      OutputIterator2&           sigma2e_first,
+                      OutputIterator3&           gain_first,
+                      const bool                 hierarchy)
     {
-        assert(N >= 1);
-        assert(is_nonnegative(i));
-        assert(static_cast<Integer1>(i) <= N);
+        const Value mu = -2 * s.nhrc;
 
-        if (i == 0)
-            return MeanHandling::template empirical_variance_zero<Result>(N);
+        s.sigma2e *= (1 - mu*mu);
+        for (std::size_t n = 0; n <= K/2; ++n)
+        {
+            Value t1 = s.Ak[n] + mu*s.Ak[K - n];
+            Value t2 = s.Ak[K - n] + mu*s.Ak[n];
+            s.Ak[n] = t1;
+            s.Ak[K - n] = t2;
+        }
 
-        Result num = N - i, den = N*(N + 2);
-        return num / den;
-    }
-};
+        s.gain *= 1 / (1 - s.Ak[K]*s.Ak[K]);
 
-/** Represents estimation using %Burg's recursive method. */
-template <class MeanHandling>
-class Burg : public estimation_method
-{
-public:
+        // Summed in the order std::inner_product uses in burg_recursion
+        Value acc = s.Ak[K];
+        for (std::size_t j = 0; j + 1 < K; ++j)
+        {
+            acc = acc + s.ac[K - 2 - j] * s.Ak[1 + j];
+        }
+        s.ac[K - 1] = -acc;
 
-    /**
-     * Approximates the empirical variance estimate.
-     * @param N Number of observations.
-     * @param i Variance order.
-     */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result empirical_variance(Integer1 N, Integer2 i)
-    {
-        assert(N >= 1);
-        assert(is_nonnegative(i));
-        assert(static_cast<Integer1>(i) <= N);
+        if (hierarchy || K == P)
+        {
+            params_first = std::copy(s.Ak + 1, s.Ak + K + 1, params_first);
+            *sigma2e_first++ = s.sigma2e;
+            *gain_first++    = s.gain;
+        }
 
-        if (i == 0)
-            return MeanHandling::template empirical_variance_zero<Result>(N);
+        if (K < P)
+        {
+            s.nhrc = burg_scalar_kernel().update_and_reflect(
+                    f_first + K, f_first + N, b_first, mu);
+        }
 
-        Result den = N + 1 - i;
-        return 1 / den;
+        burg_fixed_order<P, K + 1>::apply(f_first, b_first, N, s,
+                                          params_first, sigma2e_first,
+                                          gain_first, hierarchy);
     }
 };
 
-/** Represents forward and backward prediction least squares minimization. */
-template <class MeanHandling>
-class LSFB : public estimation_method
+/** Terminate the fixed order recursion after order \c P. */
+template <std::size_t P, std::size_t K>
+struct burg_fixed_order<P, K, true>
 {
-public:
-
-    /**
-     * Approximates the empirical variance estimate.
-     * @param N Number of observations.
-     * @param i Variance order.
-     */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result empirical_variance(Integer1 N, Integer2 i)
-    {
-        assert(N >= 1);
-        assert(is_nonnegative(i));
-        assert(static_cast<Integer1>(i) <= N);
-
-        if (i == 0)
-            return MeanHandling::template empirical_variance_zero<Result>(N);
-
-        // Factorizing expression will cause problems in unsigned arithmetic
-        Result den = N + Result(3)/2 - Result(3)/2 * i;
-        return 1 / den;
-    }
+    template <class RandomAccessIterator1,
+              class RandomAccessIterator2,
+              class Value,
+              class OutputIterator1,
+              class OutputIterator2,
+              class OutputIterator3>
+    static void apply(RandomAccessIterator1, RandomAccessIterator2,
+                      const std::size_t, burg_fixed_state<Value,P>&,
+                      OutputIterator1&, OutputIterator2&, OutputIterator3&,
+                      const bool)
+    {}
 };
 
-/** Represents forward prediction least squares minimization. */
-template <class MeanHandling>
-class LSF : public estimation_method
+/**
+ * Perform %Burg's recursion through fixed order \c P per \ref
+ * burg_recursion using \ref burg_scalar_kernel and \ref burg_never_stop.
+ * Results are bit-for-bit identical but no working storage is required.
+ */
+template <std::size_t P,
+          class RandomAccessIterator1,
+          class RandomAccessIterator2,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4>
+void burg_recursion_fixed(RandomAccessIterator1 f_first,
+                          RandomAccessIterator2 b_first,
+                          const std::size_t     N,
+                          const Value           sigma2e,
+                          OutputIterator1       params_first,
+                          OutputIterator2       sigma2e_first,
+                          OutputIterator3       gain_first,
+                          OutputIterator4       autocor_first,
+                          const bool            hierarchy)
 {
-public:
+    assert(P == 0 || P < N);
 
-    /**
-     * Approximates the empirical variance estimate.
-     * @param N Number of observations.
-     * @param i Variance order.
-     */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result empirical_variance(Integer1 N, Integer2 i)
+    burg_fixed_state<Value, P> s;
+    s.sigma2e = sigma2e;
+    s.gain    = 1;
+    if (hierarchy || P == 0)
     {
-        assert(N >= 1);
-        assert(is_nonnegative(i));
-        assert(static_cast<Integer1>(i) <= N);
+        *sigma2e_first++ = s.sigma2e;
+        *gain_first++    = s.gain;
+    }
 
-        if (i == 0)
-            return MeanHandling::template empirical_variance_zero<Result>(N);
+    std::fill(s.Ak, s.Ak + P + 1, Value(0));
+    s.Ak[0] = 1;
+    s.nhrc = P == 0 ? 0 : burg_scalar_kernel().template
+        negative_half_reflection_coefficient<Value>(
+            f_first + 1, f_first + N, b_first);
+    burg_fixed_order<P, 1>::apply(f_first, b_first, N, s, params_first,
+                                  sigma2e_first, gain_first, hierarchy);
 
-        // Factorizing expression will cause problems in unsigned arithmetic
-        Result den = N + 2 - 2*i;
-        return 1 / den;
-    }
-};
+    *autocor_first++ = 1;
+    std::copy(s.ac, s.ac + P, autocor_first);
+}
 
-/** An STL-ready binary_function for a given method's empirical variance. */
-template <class EstimationMethod,
-          typename Result,
-          typename Integer1 = std::size_t,
-          typename Integer2 = Integer1>
-struct empirical_variance_function
-    : public std::binary_function<Result,Integer1,Integer2>
+/** Invoke \ref burg_recursion for general kernels and stopping policies. */
+template <class RandomAccessIterator1,
+          class RandomAccessIterator2,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class Vector,
+          class Kernel,
+          class Stop>
+std::size_t burg_recursion_select(RandomAccessIterator1 f_first,
+                                  RandomAccessIterator2 b_first,
+                                  const std::size_t     N,
+                                  Value                 sigma2e,
+                                  const std::size_t     maxorder,
+                                  OutputIterator1       params_first,
+                                  OutputIterator2       sigma2e_first,
+                                  OutputIterator3       gain_first,
+                                  OutputIterator4       autocor_first,
+                                  const bool            hierarchy,
+                                  Vector&               Ak,
+                                  Vector&               ac,
+                                  const Kernel&         kernel,
+                                  Stop                  stop)
 {
-    Result operator() (Integer1 N, Integer2 i) const
-    {
-        return EstimationMethod::template empirical_variance<Result>(N, i);
-    }
-};
+    return burg_recursion(f_first, b_first, N, sigma2e, maxorder,
+                          params_first, sigma2e_first, gain_first,
+                          autocor_first, hierarchy, Ak, ac, kernel, stop);
+}
 
 /**
- * An STL AdaptableGenerator for a given method's empirical variance.
- *
- * On each <tt>operator()</tt> invocation the method's empirical variance is
- * returned for the current model order.  The first invocation returns the
- * result for model order zero.
+ * Invoke \ref burg_recursion_fixed for small orders given the reference
+ * kernel and no stopping policy, as results are then identical, and
+ * otherwise \ref burg_recursion.
  */
-template <class EstimationMethod,
-          typename Result,
-          typename Integer1 = std::size_t,
-          typename Integer2 = Integer1>
-class empirical_variance_generator
+template <class RandomAccessIterator1,
+          class RandomAccessIterator2,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class Vector>
+std::size_t burg_recursion_select(RandomAccessIterator1     f_first,
+                                  RandomAccessIterator2     b_first,
+                                  const std::size_t         N,
+                                  Value                     sigma2e,
+                                  const std::size_t         maxorder,
+                                  OutputIterator1           params_first,
+                                  OutputIterator2           sigma2e_first,
+                                  OutputIterator3           gain_first,
+                                  OutputIterator4           autocor_first,
+                                  const bool                hierarchy,
+                                  Vector&                   Ak,
+                                  Vector&                   ac,
+                                  const burg_scalar_kernel& kernel,
+                                  burg_never_stop           stop)
 {
-private:
-
-    Integer1 N;
-    Integer2 i;
-
-public:
-
-    typedef Result result_type;
-
-    empirical_variance_generator(Integer1 N) : N(N), i(0) {}
-
-    Result operator() ()
+#define AR_BURG_FIXED_CASE(P)                                              \
+    case P:                                                                \
+        burg_recursion_fixed<P>(f_first, b_first, N, sigma2e,              \
+                                params_first, sigma2e_first, gain_first,  \
+                                autocor_first, hierarchy);                \
+        return P;
+
+    switch (maxorder)
     {
-        return EstimationMethod::template empirical_variance<Result>(N, i++);
+        AR_BURG_FIXED_CASE(1)
+        AR_BURG_FIXED_CASE(2)
+        AR_BURG_FIXED_CASE(3)
+        AR_BURG_FIXED_CASE(4)
+        AR_BURG_FIXED_CASE(5)
+        AR_BURG_FIXED_CASE(6)
+        AR_BURG_FIXED_CASE(7)
+        AR_BURG_FIXED_CASE(8)
     }
-};
+#undef AR_BURG_FIXED_CASE
+
+    return burg_recursion(f_first, b_first, N, sigma2e, maxorder,
+                          params_first, sigma2e_first, gain_first,
+                          autocor_first, hierarchy, Ak, ac, kernel, stop);
+}
+
+}
 
 /**
- * An immutable RandomAccessIterator over a method's empirical variance
- * sequence.
+ * Fit an autoregressive model to stationary time series data using %Burg's
+ * method.  That is, find coefficients \f$a_i\f$ such that the sum of the
+ * squared errors in the forward predictions \f$x_n = -a_1 x_{n-1} - \dots -
+ * a_p x_{n-p}\f$ and backward predictions \f$x_n = -a_1 x_{n+1} - \dots - a_p
+ * x_{n+p}\f$ are both minimized.  Either a single model of given order or a
+ * hierarchy of models up to and including a maximum order may fit.
  *
- * Facilitates using algorithms like <tt>std::copy</tt>,
- * <tt>std::accumulate</tt>, and <tt>std::partial_sum</tt> when comparing a
- * hierarchy of models during model order selection.
+ * The input data \f$\vec{x}\f$ are read from <tt>[data_first, data_last)</tt>
+ * in a single pass.  The mean is computed, returned in \c mean, and \e
+ * removed from further consideration whenever \c subtract_mean is true.
+ * The estimated model parameters \f$a_i\f$ are output using \c params_first
+ * with the behavior determined by the amount of data read, <tt>maxorder</tt>,
+ * and the \c hierarchy flag:
+ * <ul>
+ *     <li>If \c hierarchy is \c false, only the \f$a_1, \dots,
+ *         a_\text{maxorder}\f$ parameters for an AR(<tt>maxorder</tt>) process
+ *         are output.</li>
+ *     <li>If \c hierarchy is \c true, the <tt>maxorder*(maxorder+1)/2</tt>
+ *         parameters \f$a_1, \dots, a_m\f$ for models AR(0), AR(1), AR(2),
+ *         ..., AR(maxorder) are output.  Notice AR(0) has no parameters.
+ *         </li>
+ * </ul>
+ * Note that the latter case is \e always computed; the \c hierarchy flag
+ * merely controls what is output.  In both cases, the maximum order is limited
+ * by the number of data samples provided and is output to \c maxorder.
  *
- * The (N+1)-length sequence of orders 0, 1, ..., N is iterated given sample
- * size N.  Default constructed instances represent past-end iterators.
- */
-template <class EstimationMethod,
-          typename Result,
-          typename Integer1 = std::size_t,
-          typename Integer2 = Integer1>
-class empirical_variance_iterator
-    : public std::iterator<std::random_access_iterator_tag, Result,
-                           std::ptrdiff_t, const Result*, const Result&>
-{
-private:
-    typedef std::iterator<std::random_access_iterator_tag, Result,
-                          std::ptrdiff_t, const Result*, const Result&> base;
-
-    Integer1 N;
-    Integer2 i;
-
-public:
-    typedef typename base::difference_type   difference_type;
-    typedef typename base::iterator_category iterator_category;
-    typedef typename base::pointer           pointer;
-    typedef typename base::reference         reference;
-    typedef typename base::value_type        value_type;
-
-    /** Construct a past-end iterator */
-    empirical_variance_iterator() : N(0), i(1) {}  // Null
-
-    /** Construct an iterator over sequence order 0, 1, ..., N (inclusive). */
-    empirical_variance_iterator(Integer1 N) : N(N), i(0)
-        { assert(N >= 1); }
-
-    /** Construct an iterator over sequence order i, i+1, ..., N (inclusive). */
-    empirical_variance_iterator(Integer1 N, Integer2 i) : N(N), i(i) {}
-
-    // Forward traversal
+ * One mean squared discrepancy \f$\sigma^2_\epsilon\f$, also called the
+ * innovation variance, and gain, defined as \f$\sigma^2_x /
+ * \sigma^2_\epsilon\f$, are output for each model, including the trivial
+ * zeroth order model when \c maxorder is zero or \c hierarchy is \c true,
+ * using \c sigma2e_first and \c gain_first.  The autocorrelations for lags
+ * <tt>[0,k]</tt> are output using \c autocor_first.  When \c hierarchy is \c
+ * true, only lags <tt>[0,m]</tt> should be applied for some AR(<tt>m</tt>)
+ * model.  Outputting the lag \c k autocorrelation is technically redundant as
+ * it may be computed from \f$a_i\f$ and lags <tt>0, ..., k-1</tt>.
+ * Autocovariances may be computed by multiplying the autocorrelations by the
+ * gain times \f$\sigma^2_\epsilon\f$.
+ *
+ * The software aspects of the implementation differs from many other sources.
+ * In particular,
+ * <ul>
+ *     <li>iterators are employed,</li>
+ *     <li>the working precision is selectable using \c mean,</li>
+ *     <li>the storage precision of the prediction errors may be lower than
+ *     the working precision by passing, for example, <tt>float</tt> \c f
+ *     and \c b alongside <tt>double</tt> \c mean, \c Ak, and \c ac,
+ *     halving the memory traffic of the inner loops while every reduction
+ *     is still accumulated in the working precision,</li>
+ *     <li>the mean squared discrepancy calculation has been added,</li>
+ *     <li>some loop index transformations have been performed,</li>
+ *     <li>working storage may be passed into the method to reduce allocations
+ *     across many invocations, and</li>
+ *     <li>and all lower order models may be output during the recursion using
+ *     \c hierarchy.</li>
+ * </ul>
+ * Gain and autocorrelation calculations have been added based on sections 5.2
+ * and 5.3 of Broersen, P.  M.  T. Automatic autocorrelation and spectral
+ * analysis.  Springer, 2006.  http://dx.doi.org/10.1007/1-84628-329-9.  The
+ * classical algorithm, rather than the variant using denominator recursion due
+ * to Andersen (http://dx.doi.org/10.1109/PROC.1978.11160), has been chosen as
+ * the latter can be numerically unstable.
+ *
+ * @param[in]     data_first    Beginning of the input data range.
+ * @param[in]     data_last     Exclusive end of the input data range.
+ * @param[out]    mean          Mean of data.
+ * @param[in,out] maxorder      On input, the maximum model order desired.
+ *                              On output, the maximum model order computed.
+ * @param[out]    params_first  Model parameters for a single model or
+ *                              for an entire hierarchy of models.  At most
+ *                              <tt>!hierarchy ? maxorder :
+ *                              maxorder*(maxorder+1)/2</tt> values will be
+ *                              output.
+ * @param[out]    sigma2e_first The mean squared discrepancy for only
+ *                              AR(<tt>maxorder</tt>) or for an entire
+ *                              hierarchy.  Either one or at most
+ *                              <tt>maxorder + 1</tt> values will be output.
+ * @param[out]    gain_first    The model gain for only AR(<tt>maxorder</tt>)
+ *                              or an entire hierarchy.  Either one or at most
+ *                              <tt>maxorder + 1</tt> values will be output.
+ * @param[out]    autocor_first Lag one through lag maxorder autocorrelations.
+ *                              At most <tt>maxorder + 1</tt> values will be
+ *                              output.
+ * @param[in]     subtract_mean Should \c mean be subtracted from the data?
+ * @param[in]     hierarchy     Should the entire hierarchy of estimated
+ *                              models be output?
+ * @param[in]     f             Working storage.  Reuse across invocations
+ *                              may speed execution by avoiding allocations.
+ *                              Its \c value_type fixes the storage precision
+ *                              of the prediction errors.
+ * @param[in]     b             Working storage similar to \c f.
+ * @param[in]     Ak            Working storage in the working precision.
+ * @param[in]     ac            Working storage similar to \c Ak.
+ * @param[in]     kernel        Inner loop kernels, for example
+ *                              \ref burg_scalar_kernel,
+ *                              \ref burg_simd_kernel, or
+ *                              \ref burg_fused_kernel.
+ * @param[in]     stop          Stopping policy per \ref burg_recursion.
+ *                              When it stops the recursion early,
+ *                              \c maxorder reports the order reached.
+ *
+ * @returns the number data values processed within
+ *          <tt>[data_first, data_last)</tt>.
+ */
+template <class InputIterator,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class Storage,
+          class Vector,
+          class Kernel,
+          class Stop>
+std::size_t burg_method(InputIterator   data_first,
+                        InputIterator   data_last,
+                        Value&          mean,
+                        std::size_t&    maxorder,
+                        OutputIterator1 params_first,
+                        OutputIterator2 sigma2e_first,
+                        OutputIterator3 gain_first,
+                        OutputIterator4 autocor_first,
+                        const bool      subtract_mean,
+                        const bool      hierarchy,
+                        Storage&        f,
+                        Storage&        b,
+                        Vector&         Ak,
+                        Vector&         ac,
+                        const Kernel&   kernel,
+                        Stop            stop)
+{
+    using std::min;
+    using std::size_t;
+
+    // Initialize f from [data_first, data_last) and fix number of samples.
+    // Compute the mean and second moment, subtracting the mean if requested.
+    // Backward errors are copied from f iff non-trivial work is required.
+    Value sigma2e;
+    burg_ingest(data_first, data_last, mean, sigma2e, subtract_mean, f, b,
+                maxorder > 0, kernel);
+    const size_t N = f.size();
+
+    // At most maxorder N-1 can be fit from N samples.  Beware N is unsigned.
+    maxorder = (N == 0) ? 0 : min(static_cast<size_t>(maxorder), N-1);
+
+    // Perform Burg recursion
+    maxorder = burg_recursion_select(f.begin(), b.begin(), N, sigma2e,
+                                     maxorder, params_first, sigma2e_first,
+                                     gain_first, autocor_first, hierarchy,
+                                     Ak, ac, kernel, stop);
+
+    // Return the number of values processed in [data_first, data_last)
+    return N;
+}
+
+/**
+ * Fit an autoregressive model using %Burg's method through \c maxorder.
+ * @copydetails burg_method(InputIterator,InputIterator,Value&,std::size_t&,OutputIterator1,OutputIterator2,OutputIterator3,OutputIterator4,const bool,const bool,Storage&,Storage&,Vector&,Vector&,const Kernel&,Stop)
+ */
+template <class InputIterator,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class Storage,
+          class Vector,
+          class Kernel>
+std::size_t burg_method(InputIterator   data_first,
+                        InputIterator   data_last,
+                        Value&          mean,
+                        std::size_t&    maxorder,
+                        OutputIterator1 params_first,
+                        OutputIterator2 sigma2e_first,
+                        OutputIterator3 gain_first,
+                        OutputIterator4 autocor_first,
+                        const bool      subtract_mean,
+                        const bool      hierarchy,
+                        Storage&        f,
+                        Storage&        b,
+                        Vector&         Ak,
+                        Vector&         ac,
+                        const Kernel&   kernel)
+{
+    return burg_method(data_first, data_last, mean, maxorder,
+                       params_first, sigma2e_first, gain_first, autocor_first,
+                       subtract_mean, hierarchy, f, b, Ak, ac, kernel,
+                       burg_never_stop());
+}
+
+/**
+ * Fit an autoregressive model using %Burg's method and \ref
+ * burg_scalar_kernel.
+ * @copydetails burg_method(InputIterator,InputIterator,Value&,std::size_t&,OutputIterator1,OutputIterator2,OutputIterator3,OutputIterator4,const bool,const bool,Storage&,Storage&,Vector&,Vector&,const Kernel&)
+ */
+template <class InputIterator,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class Storage,
+          class Vector>
+std::size_t burg_method(InputIterator   data_first,
+                        InputIterator   data_last,
+                        Value&          mean,
+                        std::size_t&    maxorder,
+                        OutputIterator1 params_first,
+                        OutputIterator2 sigma2e_first,
+                        OutputIterator3 gain_first,
+                        OutputIterator4 autocor_first,
+                        const bool      subtract_mean,
+                        const bool      hierarchy,
+                        Storage&        f,
+                        Storage&        b,
+                        Vector&         Ak,
+                        Vector&         ac)
+{
+    return burg_method(data_first, data_last, mean, maxorder,
+                       params_first, sigma2e_first, gain_first, autocor_first,
+                       subtract_mean, hierarchy, f, b, Ak, ac,
+                       burg_scalar_kernel());
+}
+
+/**
+ * Fit an autoregressive model to stationary time series data using %Burg's
+ * method while working directly within the caller's buffer.  Behavior and
+ * output are identical to \ref burg_method, bit for bit, but the data in
+ * <tt>[data_first, data_last)</tt> are overwritten by the forward prediction
+ * errors and only one additional buffer of <tt>N</tt> values, beginning at
+ * \c scratch_first, holds the backward prediction errors.  Peak memory is
+ * therefore one working copy of the signal rather than the two held by \ref
+ * burg_method in addition to the caller's data.
+ *
+ * Read-only data, for example a file mapped with <tt>PROT_READ</tt>, may be
+ * processed by mapping it privately (<tt>MAP_PRIVATE</tt>) so that pages are
+ * copied only as they are overwritten.  Whenever \c maxorder is zero on
+ * output, \c scratch_first is never accessed and the data are modified only
+ * when \c subtract_mean is \c true.
+ *
+ * @param[in,out] data_first    Beginning of the input data range which
+ *                              is overwritten during the recursion.
+ * @param[in,out] data_last     Exclusive end of the input data range.
+ * @param[out]    mean          Mean of data.
+ * @param[in,out] maxorder      On input, the maximum model order desired.
+ *                              On output, the maximum model order computed.
+ * @param[out]    params_first  Per \ref burg_method.
+ * @param[out]    sigma2e_first Per \ref burg_method.
+ * @param[out]    gain_first    Per \ref burg_method.
+ * @param[out]    autocor_first Per \ref burg_method.
+ * @param[in]     subtract_mean Should \c mean be subtracted from the data?
+ * @param[in]     hierarchy     Should the entire hierarchy of estimated
+ *                              models be output?
+ * @param[out]    scratch_first Beginning of a writable range holding at least
+ *                              <tt>distance(data_first, data_last)</tt>
+ *                              values.
+ * @param[in]     Ak            Working storage.  Reuse across invocations
+ *                              may speed execution by avoiding allocations.
+ * @param[in]     ac            Working storage similar to \c Ak.
+ * @param[in]     kernel        Inner loop kernels, for example
+ *                              \ref burg_scalar_kernel,
+ *                              \ref burg_simd_kernel, or
+ *                              \ref burg_fused_kernel.
+ * @param[in]     stop          Stopping policy per \ref burg_recursion.
+ *                              When it stops the recursion early,
+ *                              \c maxorder reports the order reached.
+ *
+ * @returns the number data values processed within
+ *          <tt>[data_first, data_last)</tt>.
+ */
+template <class RandomAccessIterator1,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class RandomAccessIterator2,
+          class Vector,
+          class Kernel,
+          class Stop>
+std::size_t burg_method_inplace(RandomAccessIterator1 data_first,
+                                RandomAccessIterator1 data_last,
+                                Value&                mean,
+                                std::size_t&          maxorder,
+                                OutputIterator1       params_first,
+                                OutputIterator2       sigma2e_first,
+                                OutputIterator3       gain_first,
+                                OutputIterator4       autocor_first,
+                                const bool            subtract_mean,
+                                const bool            hierarchy,
+                                RandomAccessIterator2 scratch_first,
+                                Vector&               Ak,
+                                Vector&               ac,
+                                const Kernel&         kernel,
+                                Stop                  stop)
+{
+    using std::bind2nd;
+    using std::copy;
+    using std::distance;
+    using std::min;
+    using std::minus;
+    using std::size_t;
+    using std::transform;
+
+    // The caller's buffer fixes the number of samples
+    const size_t N = distance(data_first, data_last);
+
+    // Stably compute the incoming data's mean and population variance
+    mean = 0;
+    Value sigma2e = 0;
+    welford_variance_population(data_first, data_last, mean, sigma2e);
+
+    // At most maxorder N-1 can be fit from N samples.  Beware N is unsigned.
+    maxorder = (N == 0) ? 0 : min(static_cast<size_t>(maxorder), N-1);
+
+    // When requested, subtract the just-computed mean from the data.
+    // Adjust, if necessary, to make sigma2e the second moment.
+    // Centering and seeding the scratch copy share one pass over the data.
+    if (subtract_mean && maxorder)
+    {
+        RandomAccessIterator2 s = scratch_first;
+        for (RandomAccessIterator1 d = data_first; d != data_last; ++d, ++s)
+        {
+            *s = (*d -= mean);
+        }
+    }
+    else if (subtract_mean)
+    {
+        transform(data_first, data_last, data_first,
+                  bind2nd(minus<Value>(), mean));
+    }
+    else
+    {
+        sigma2e += mean*mean;
+        if (maxorder) copy(data_first, data_last, scratch_first);
+    }
+
+    // Perform Burg recursion
+    maxorder = burg_recursion_select(data_first, scratch_first, N, sigma2e,
+                                     maxorder, params_first, sigma2e_first,
+                                     gain_first, autocor_first, hierarchy,
+                                     Ak, ac, kernel, stop);
+
+    // Return the number of values processed in [data_first, data_last)
+    return N;
+}
+
+/**
+ * Fit an autoregressive model in place through \c maxorder.
+ * @copydetails burg_method_inplace(RandomAccessIterator1,RandomAccessIterator1,Value&,std::size_t&,OutputIterator1,OutputIterator2,OutputIterator3,OutputIterator4,const bool,const bool,RandomAccessIterator2,Vector&,Vector&,const Kernel&,Stop)
+ */
+template <class RandomAccessIterator1,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class RandomAccessIterator2,
+          class Vector,
+          class Kernel>
+std::size_t burg_method_inplace(RandomAccessIterator1 data_first,
+                                RandomAccessIterator1 data_last,
+                                Value&                mean,
+                                std::size_t&          maxorder,
+                                OutputIterator1       params_first,
+                                OutputIterator2       sigma2e_first,
+                                OutputIterator3       gain_first,
+                                OutputIterator4       autocor_first,
+                                const bool            subtract_mean,
+                                const bool            hierarchy,
+                                RandomAccessIterator2 scratch_first,
+                                Vector&               Ak,
+                                Vector&               ac,
+                                const Kernel&         kernel)
+{
+    return burg_method_inplace(data_first, data_last, mean, maxorder,
+                               params_first, sigma2e_first, gain_first,
+                               autocor_first, subtract_mean, hierarchy,
+                               scratch_first, Ak, ac, kernel,
+                               burg_never_stop());
+}
+
+/**
+ * Fit an autoregressive model in place using \ref burg_scalar_kernel.
+ * @copydetails burg_method_inplace(RandomAccessIterator1,RandomAccessIterator1,Value&,std::size_t&,OutputIterator1,OutputIterator2,OutputIterator3,OutputIterator4,const bool,const bool,RandomAccessIterator2,Vector&,Vector&,const Kernel&)
+ */
+template <class RandomAccessIterator1,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class RandomAccessIterator2,
+          class Vector>
+std::size_t burg_method_inplace(RandomAccessIterator1 data_first,
+                                RandomAccessIterator1 data_last,
+                                Value&                mean,
+                                std::size_t&          maxorder,
+                                OutputIterator1       params_first,
+                                OutputIterator2       sigma2e_first,
+                                OutputIterator3       gain_first,
+                                OutputIterator4       autocor_first,
+                                const bool            subtract_mean,
+                                const bool            hierarchy,
+                                RandomAccessIterator2 scratch_first,
+                                Vector&               Ak,
+                                Vector&               ac)
+{
+    return burg_method_inplace(data_first, data_last, mean, maxorder,
+                               params_first, sigma2e_first, gain_first,
+                               autocor_first, subtract_mean, hierarchy,
+                               scratch_first, Ak, ac, burg_scalar_kernel());
+}
+
+/** \copydoc burg_method_inplace(RandomAccessIterator1,RandomAccessIterator1,Value&,std::size_t&,OutputIterator1,OutputIterator2,OutputIterator3,OutputIterator4,const bool,const bool,RandomAccessIterator2,Vector&,Vector&) */
+template <class RandomAccessIterator1,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class RandomAccessIterator2>
+std::size_t burg_method_inplace(RandomAccessIterator1 data_first,
+                                RandomAccessIterator1 data_last,
+                                Value&                mean,
+                                std::size_t&          maxorder,
+                                OutputIterator1       params_first,
+                                OutputIterator2       sigma2e_first,
+                                OutputIterator3       gain_first,
+                                OutputIterator4       autocor_first,
+                                const bool            subtract_mean,
+                                const bool            hierarchy,
+                                RandomAccessIterator2 scratch_first)
+{
+    using std::vector;
+    vector<Value> Ak, ac; // Working storage
+
+    return burg_method_inplace(data_first, data_last, mean, maxorder,
+                               params_first, sigma2e_first, gain_first,
+                               autocor_first, subtract_mean, hierarchy,
+                               scratch_first, Ak, ac);
+}
+
+/** \copydoc burg_method(InputIterator,InputIterator,Value&,std::size_t&,OutputIterator1,OutputIterator2,OutputIterator3,OutputIterator4,const bool,const bool,Storage&,Storage&,Vector&,Vector&) */
+template <class InputIterator,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4>
+std::size_t burg_method(InputIterator     data_first,
+                        InputIterator     data_last,
+                        Value&            mean,
+                        std::size_t&      maxorder,
+                        OutputIterator1   params_first,
+                        OutputIterator2   sigma2e_first,
+                        OutputIterator3   gain_first,
+                        OutputIterator4   autocor_first,
+                        const bool        subtract_mean = false,
+                        const bool        hierarchy     = false)
+{
+    using std::vector;
+    vector<Value> f, b, Ak, ac; // Working storage
+
+    return burg_method(data_first, data_last, mean, maxorder,
+                       params_first, sigma2e_first, gain_first,
+                       autocor_first, subtract_mean, hierarchy,
+                       f, b, Ak, ac);
+}
+
+/**
+ * Fit an autoregressive model of order \c P, fixed at compile time, using
+ * %Burg's method.  Behavior and output are identical, bit for bit, to \ref
+ * burg_method given <tt>maxorder == P</tt> and \ref burg_scalar_kernel.
+ * However, the coefficient and autocorrelation recursions reside on the
+ * stack and their loops are unrolled at compile time so that fitting small
+ * models to many short signals avoids the overhead of the runtime order.
+ * At least <tt>P + 1</tt> samples are required whenever \c P is nonzero.
+ * \ref burg_method itself employs this routine whenever \c maxorder is at
+ * most eight and its default kernel and stopping policy are in use.
+ *
+ * @param[in]  data_first    Beginning of the input data range.
+ * @param[in]  data_last     Exclusive end of the input data range.
+ * @param[out] mean          Mean of data.
+ * @param[out] params_first  Per \ref burg_method.
+ * @param[out] sigma2e_first Per \ref burg_method.
+ * @param[out] gain_first    Per \ref burg_method.
+ * @param[out] autocor_first Per \ref burg_method.
+ * @param[in]  subtract_mean Should \c mean be subtracted from the data?
+ * @param[in]  hierarchy     Should the entire hierarchy of estimated
+ *                           models be output?
+ * @param[in]  f             Working storage per \ref burg_method.
+ * @param[in]  b             Working storage similar to \c f.
+ *
+ * @returns the number data values processed within
+ *          <tt>[data_first, data_last)</tt>.
+ */
+template <std::size_t P,
+          class InputIterator,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class Storage>
+std::size_t burg_method_fixed(InputIterator   data_first,
+                              InputIterator   data_last,
+                              Value&          mean,
+                              OutputIterator1 params_first,
+                              OutputIterator2 sigma2e_first,
+                              OutputIterator3 gain_first,
+                              OutputIterator4 autocor_first,
+                              const bool      subtract_mean,
+                              const bool      hierarchy,
+                              Storage&        f,
+                              Storage&        b)
+{
+    // Backward errors are copied from f iff non-trivial work is required
+    Value sigma2e;
+    burg_ingest(data_first, data_last, mean, sigma2e, subtract_mean, f, b,
+                P > 0);
+    const std::size_t N = f.size();
+    AR_ENSURE_MSGEXCEPT(P == 0 || P < N,
+            "burg_method_fixed requires more than P samples",
+            std::invalid_argument);
+
+    burg_recursion_fixed<P>(f.begin(), b.begin(), N, sigma2e,
+                            params_first, sigma2e_first, gain_first,
+                            autocor_first, hierarchy);
+
+    return N;
+}
+
+/** \copydoc burg_method_fixed(InputIterator,InputIterator,Value&,OutputIterator1,OutputIterator2,OutputIterator3,OutputIterator4,const bool,const bool,Storage&,Storage&) */
+template <std::size_t P,
+          class InputIterator,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4>
+std::size_t burg_method_fixed(InputIterator   data_first,
+                              InputIterator   data_last,
+                              Value&          mean,
+                              OutputIterator1 params_first,
+                              OutputIterator2 sigma2e_first,
+                              OutputIterator3 gain_first,
+                              OutputIterator4 autocor_first,
+                              const bool      subtract_mean = false,
+                              const bool      hierarchy     = false)
+{
+    std::vector<Value> f, b; // Working storage
+
+    return burg_method_fixed<P>(data_first, data_last, mean, params_first,
+                                sigma2e_first, gain_first, autocor_first,
+                                subtract_mean, hierarchy, f, b);
+}
+
+/**
+ * Fit autoregressive models to \c K equal-length signals simultaneously
+ * using %Burg's method.  The signals are interleaved in a
+ * structure-of-arrays layout so that each order's reflection coefficients
+ * for all \c K signals are computed during one sweep over memory, with
+ * the innermost loops running across signals where they may be vectorized.
+ * The recurrence, the \c hierarchy output contract, and the results for each
+ * signal are bit-for-bit identical to those of \ref burg_method.
+ *
+ * Signal \c k is the \c N values beginning at <tt>data_firsts[k]</tt>.  Its
+ * mean is stored to <tt>means[k]</tt> and its outputs are written through
+ * the output iterators <tt>params_firsts[k]</tt>, <tt>sigma2e_firsts[k]</tt>,
+ * <tt>gain_firsts[k]</tt>, and <tt>autocor_firsts[k]</tt> each of which is
+ * advanced in place.  For example, each may be a
+ * <tt>std::vector</tt> holding <tt>std::back_insert_iterator</tt>s.
+ *
+ * @param[in]     K              Number of signals.
+ * @param[in]     data_firsts    Beginning of the input data for each signal.
+ * @param[in]     N              Number of samples in each signal.
+ * @param[out]    means          Mean of each signal.
+ * @param[in,out] maxorder       On input, the maximum model order desired.
+ *                               On output, the maximum model order computed.
+ * @param[in,out] params_firsts  Per \ref burg_method for each signal.
+ * @param[in,out] sigma2e_firsts Per \ref burg_method for each signal.
+ * @param[in,out] gain_firsts    Per \ref burg_method for each signal.
+ * @param[in,out] autocor_firsts Per \ref burg_method for each signal.
+ * @param[in]     subtract_mean  Should each \c mean be subtracted?
+ * @param[in]     hierarchy      Should the entire hierarchy of estimated
+ *                               models be output?
+ * @param[in]     f              Working storage of <tt>K*N</tt> values.
+ *                               Reuse across invocations may speed execution
+ *                               by avoiding allocations.
+ * @param[in]     b              Working storage similar to \c f.
+ * @param[in]     Ak             Working storage similar to \c f.
+ * @param[in]     ac             Working storage similar to \c f.
+ *
+ * @returns the number data values processed for each signal.
+ */
+template <class RandomAccessIterator1,
+          class RandomAccessIterator2,
+          class RandomAccessIterator3,
+          class RandomAccessIterator4,
+          class RandomAccessIterator5,
+          class RandomAccessIterator6,
+          class Vector>
+std::size_t burg_method_lockstep(const std::size_t     K,
+                                 RandomAccessIterator1 data_firsts,
+                                 const std::size_t     N,
+                                 RandomAccessIterator2 means,
+                                 std::size_t&          maxorder,
+                                 RandomAccessIterator3 params_firsts,
+                                 RandomAccessIterator4 sigma2e_firsts,
+                                 RandomAccessIterator5 gain_firsts,
+                                 RandomAccessIterator6 autocor_firsts,
+                                 const bool            subtract_mean,
+                                 const bool            hierarchy,
+                                 Vector&               f,
+                                 Vector&               b,
+                                 Vector&               Ak,
+                                 Vector&               ac)
+{
+    using std::min;
+    using std::size_t;
+
+    typedef typename Vector::value_type Value;
+
+    // At most maxorder N-1 can be fit from N samples.  Beware N is unsigned.
+    maxorder = (N == 0) ? 0 : min(static_cast<size_t>(maxorder), N-1);
+    if (K == 0) return N;
+
+    // Per-signal state where sums provides lockstep working space
+    std::vector<Value> sigma2e(K), gain(K, Value(1)), mu(K), nhrc(K);
+    std::vector<Value> sums, m;
+
+    // Interleave signals into f in blocks while computing means and second
+    // moments exactly as burg_method would compute them for each signal
+    f.resize(K*N);
+    m.resize(K);
+    if (N) lockstep_gather(K, N, data_firsts, &f[0], &m[0], &sigma2e[0]);
+    for (size_t k = 0; k < K; ++k)
+    {
+        sigma2e[k] /= N;
+        if (!subtract_mean) sigma2e[k] += m[k]*m[k];
+        means[k] = m[k];
+    }
+    // Center f and seed b in one pass copying iff non-trivial work required
+    if (maxorder) b.resize(f.size());
+    if (subtract_mean)
+    {
+        Value *fp = N ? &f[0] : NULL, *bp = maxorder ? &b[0] : NULL;
+        for (size_t n = 0; n < N; ++n)
+            for (size_t k = 0; k < K; ++k, ++fp)
+            {
+                *fp -= m[k];
+                if (bp) *bp++ = *fp;
+            }
+    }
+    else if (maxorder)
+    {
+        std::copy(f.begin(), f.end(), b.begin());
+    }
+
+    // Output sigma2e and gain for a zeroth order model, if requested.
+    for (size_t k = 0; k < K && (hierarchy || maxorder == 0); ++k)
+    {
+        *sigma2e_firsts[k]++ = sigma2e[k];
+        *gain_firsts[k]++    = gain[k];
+    }
+
+    // Initialize and perform Burg recursion interleaving Ak and ac as well
+    Ak.assign((maxorder + 1)*K, Value(0));
+    for (size_t k = 0; k < K; ++k) Ak[k] = 1;
+    ac.assign(maxorder*K, Value(0));
+    if (maxorder)
+    {
+        lockstep_nhrc(&f[K], &b[0], N - 1, K, sums, &nhrc[0]);
+    }
+    for (size_t kp1 = 1; kp1 <= maxorder; ++kp1)
+    {
+        for (size_t k = 0; k < K; ++k)
+        {
+            // Compute mu and then update sigma2e and Ak per burg_recursion
+            mu[k] = -2 * nhrc[k];
+            sigma2e[k] *= (1 - mu[k]*mu[k]);
+            for (size_t n = 0; n <= kp1/2; ++n)
+            {
+                Value t1 = Ak[n*K + k] + mu[k]*Ak[(kp1 - n)*K + k];
+                Value t2 = Ak[(kp1 - n)*K + k] + mu[k]*Ak[n*K + k];
+                Ak[n*K + k] = t1;
+                Ak[(kp1 - n)*K + k] = t2;
+            }
+
+            // Update the gain per Broersen 2006 equation (5.25)
+            gain[k] *= 1 / (1 - Ak[kp1*K + k]*Ak[kp1*K + k]);
+
+            // Compute the next autocorrelation coefficient following the
+            // operation order of std::inner_product within burg_recursion
+            Value acc = Ak[kp1*K + k];
+            for (size_t j = 0; j + 1 < kp1; ++j)
+            {
+                acc = acc + ac[(kp1 - 2 - j)*K + k] * Ak[(1 + j)*K + k];
+            }
+            ac[(kp1 - 1)*K + k] = -acc;
+
+            // Output parameters and the input and output variances
+            if (hierarchy || kp1 == maxorder)
+            {
+                for (size_t n = 1; n <= kp1; ++n)
+                {
+                    *params_firsts[k]++ = Ak[n*K + k];
+                }
+                *sigma2e_firsts[k]++ = sigma2e[k];
+                *gain_firsts[k]++    = gain[k];
+            }
+        }
+
+        // Update f and b and find the next mu if another iteration remains
+        if (kp1 < maxorder)
+        {
+            lockstep_update(&f[kp1*K], &b[0], N - kp1, K, &mu[0],
+                            sums, &nhrc[0]);
+        }
+    }
+
+    // Output the lag [0,maxorder] autocorrelation coefficients
+    for (size_t k = 0; k < K; ++k)
+    {
+        *autocor_firsts[k]++ = 1;
+        for (size_t j = 0; j < maxorder; ++j)
+        {
+            *autocor_firsts[k]++ = ac[j*K + k];
+        }
+    }
+
+    return N;
+}
+
+// Helpers for burg_method_chunked streaming the prediction errors through a
+// store one chunk at a time.  Store offsets [0, N) hold the forward errors f
+// and offsets [N, 2N) hold the backward errors b indexed as burg_recursion
+// indexes them.
+namespace
+{
+
+/**
+ * State of an out-of-core %Burg recursion.  After completing order k the
+ * store holds f[j] for j in [k, N) and b[i] for i in [0, N-k) so that the
+ * next order pairs f[k+1+i] with b[i].  Each pass applies every pending
+ * order to one chunk of f, and to the backward errors that chunk touches,
+ * one order after another exactly as burg_recursion would.  The pass then
+ * accumulates the next order's Kahan sums in the manner of burg_fused_kernel.
+ * Backward errors touched by a chunk but still awaiting later orders are
+ * carried into the next chunk rather than written.
+ *
+ * When W orders per pass are requested the final errors are also reduced
+ * into the Gram matrix of windows spanning W+1 successive positions of both
+ * sequences.  The following W-1 reflection coefficients are predicted from
+ * quadratic forms of that matrix while rounding permits.
+ */
+template <class Store, typename Value>
+class burg_chunked_engine
+{
+public:
+
+    burg_chunked_engine(Store&            store,
+                        const std::size_t N,
+                        const std::size_t chunk,
+                        const std::size_t orders_per_pass)
+        : store(store),
+          N(N),
+          W(orders_per_pass ? orders_per_pass : 1),
+          D(2*(W + 1)),
+          n(std::max(chunk, 2*W + 2)),
+          k(0), K(0), nhrc(0)
+    {
+        for (int s = 0; s < 3; ++s)
+        {
+            F[s].resize(n);
+            B[s].resize(n + W + 1);
+        }
+        if (W > 1)
+        {
+            hx.reserve(n + W);
+            hy.reserve(n + W);
+            v.resize(D);
+        }
+    }
+
+    /**
+     * Stream the N samples beginning at \c first into the store centering
+     * them when requested.  Mean and moments follow \ref welford_nvariance
+     * exactly.  When \c write is false only the mean and moments are
+     * computed.
+     */
+    template <class ForwardIterator>
+    void load(ForwardIterator first,
+              const bool      subtract_mean,
+              const bool      write,
+              Value&          mean,
+              Value&          sigma2e)
+    {
+        using std::size_t;
+
+        // Welford's algorithm exactly as welford_nvariance computes it
+        size_t count = 1;
+        Value  m = 0, nv = 0;
+        const bool separate = subtract_mean || !write;
+        if (separate)
+        {
+            ForwardIterator it = first;
+            for (size_t i = 0; i < N; ++i, ++it)
+            {
+                const Value x = *it;
+                const Value d = x - m;
+                m  += d / count++;
+                nv += d*(x - m);
+            }
+        }
+
+        // Copy centered data into both f and b reducing as each chunk fills
+        if (write)
+        {
+            begin(0);
+            const size_t C = (N + n - 1) / n;
+            for (size_t c = 0; c < C; ++c)
+            {
+                const size_t A = c*n, m_c = std::min(n, N - A);
+                Value *f = &F[c % 3][0], *b = &B[c % 3][0];
+                bool failed = false;
+                std::string error;
+#ifdef _OPENMP
+#pragma omp parallel sections num_threads(2)
+#endif
+                {
+#ifdef _OPENMP
+#pragma omp section
+#endif
+                    try
+                    {
+                        for (size_t t = 0; t < m_c; ++t, ++first)
+                        {
+                            Value x = *first;
+                            if (!separate)
+                            {
+                                const Value d = x - m;
+                                m  += d / count++;
+                                nv += d*(x - m);
+                            }
+                            else if (subtract_mean)
+                            {
+                                x -= m;
+                            }
+                            f[t] = x;
+                        }
+                        b[0] = c ? F[(c + 2) % 3][n - 1] : Value(0);
+                        std::copy(f, f + m_c, b + 1);
+                        reduce(A, m_c, f, b);
+                    }
+                    catch (std::exception& e) { note(failed, error, e); }
+#ifdef _OPENMP
+#pragma omp section
+#endif
+                    try
+                    {
+                        if (c) write_load(c - 1);
+                    }
+                    catch (std::exception& e) { note(failed, error, e); }
+                }
+                AR_ENSURE_MSGEXCEPT(!failed, error, std::runtime_error);
+            }
+            if (C) write_load(C - 1);
+            finish();
+        }
+
+        mean    = m;
+        sigma2e = nv / N;
+        if (!subtract_mean) sigma2e += mean*mean;
+    }
+
+    /** Negative one half the reflection coefficient of the next order. */
+    Value reflect() const
+    {
+        return nhrc;
+    }
+
+    /**
+     * Record order \c kp1 used reflection coefficient \c mu and return
+     * negative one half the next one making a pass only when no predicted
+     * coefficient remains.
+     */
+    Value advance(const std::size_t kp1, const Value mu)
+    {
+        pending.push_back(mu);
+        if (kp1 - k <= ahead.size()) return ahead[kp1 - k - 1];
+        pass();
+        return nhrc;
+    }
+
+private:
+
+    Store&                   store;
+    const std::size_t        N, W, D, n;
+    std::size_t              k, K;        // Orders stored and being made
+    std::vector<Value>       F[3], B[3];  // Chunk buffers used in rotation
+    std::vector<Value>       pending;     // Reflection coefficients to apply
+    std::vector<Value>       ahead;       // Predicted next halved negatives
+    Value                    nhrc;        // Exact next halved negative
+    Value                    ns, nc, ds, dc;
+    std::vector<Value>       G, Gc;       // Kahan-summed window products
+    std::vector<Value>       P;           // Plain products for one block
+    std::vector<Value>       hx, hy, v;   // Final positions awaiting windows
+    std::size_t              hq;          // Position of hx[0] and hy[0]
+
+    static void note(bool& failed, std::string& error, std::exception& e)
+    {
+#ifdef _OPENMP
+#pragma omp critical(ar_burg_chunked)
+#endif
+        if (!failed) { failed = true; error = e.what(); }
+    }
+
+    // Prepare to reduce the errors of order K
+    void begin(const std::size_t order)
+    {
+        K  = order;
+        ns = nc = ds = dc = 0;
+        if (W > 1)
+        {
+            G .assign(D*D, Value(0));
+            Gc.assign(D*D, Value(0));
+            P .assign(D*D, Value(0));
+            hx.clear();
+            hy.clear();
+            hq = 0;
+        }
+    }
+
+    // Store chunk c of the load pass into both f and b
+    void write_load(const std::size_t c)
+    {
+        const std::size_t A = c*n, m_c = std::min(n, N - A);
+        store.write(A,     m_c, &F[c % 3][0]);
+        store.write(N + A, m_c, &F[c % 3][0]);
+    }
+
+    // Chunk c of a pass covers f indices [A, A + m_c) where A = k + c*n.
+    // Offset o of its backward buffer holds b[A - K - 1 + o] so that f[t]
+    // pairs with b[t] for the next order on completion.
+    void read(const std::size_t c)
+    {
+        const std::size_t L = K - k, A = k + c*n, m_c = std::min(n, N - A);
+        store.read(A, m_c, &F[c % 3][0]);
+        const std::size_t i0 = A > k ? A - k - 1 : 0, i1 = A + m_c - k - 1;
+        if (i1 > i0)
+        {
+            store.read(N + i0, i1 - i0, &B[c % 3][i0 + L + 1 + k - A]);
+        }
+    }
+
+    // Store the finished forward and backward errors of chunk c
+    void write(const std::size_t c)
+    {
+        const std::size_t L = K - k, A = k + c*n, m_c = std::min(n, N - A);
+        const std::size_t j0 = std::max(A, K);
+        if (A + m_c > j0)
+        {
+            store.write(j0, A + m_c - j0, &F[c % 3][j0 - A]);
+        }
+        const std::size_t i0 = A > K ? A - K : 0;
+        const std::size_t i1 = A + m_c > K ? A + m_c - K : 0;
+        if (i1 > i0)
+        {
+            store.write(N + i0, i1 - i0, &B[c % 3][i0 + L + 1 + k - A]);
+        }
+    }
+
+    // Apply each pending order to forward errors [A, A + m_c)
+    void update(const std::size_t A,
+                const std::size_t m_c,
+                Value*            f,
+                Value*            b) const
+    {
+        const std::size_t L = pending.size();
+        for (std::size_t s = 1; s <= L; ++s)
+        {
+            const Value mu = pending[s - 1];
+            Value *bs = b + L + 1 - s;
+            for (std::size_t t = k + s > A ? k + s - A : 0; t < m_c; ++t)
+            {
+                const Value t1 = f[t] + mu * bs[t];
+                const Value t2 = bs[t] + mu * f[t];
+                f[t]  = t1;
+                bs[t] = t2;
+            }
+        }
+    }
+
+    // Accumulate the next order's sums and any window products
+    AR_NO_ASSOCIATIVE_MATH
+    void reduce(const std::size_t A,
+                const std::size_t m_c,
+                const Value*      f,
+                const Value*      b)
+    {
+        for (std::size_t t = K + 1 > A ? K + 1 - A : 0; t < m_c; ++t)
+        {
+            const Value xa = f[t], xb = b[t];
+            kahan_add(ds, dc, xa * xa);
+            kahan_add(ds, dc, xb * xb);
+            kahan_add(ns, nc, xa * xb);
+        }
+        if (W > 1)
+        {
+            for (std::size_t t = K > A ? K - A : 0; t < m_c; ++t)
+            {
+                hx.push_back(f[t]);
+                hy.push_back(b[t + 1]);
+            }
+            windows();
+        }
+    }
+
+    // Reduce every complete window held by hx and hy into G and then
+    // retain only the W positions which begin incomplete windows
+    AR_NO_ASSOCIATIVE_MATH
+    void windows()
+    {
+        enum { block = 256 };
+        if (hx.size() <= W) return;
+        const std::size_t Q = hx.size() - W;
+        for (std::size_t q0 = 0; q0 < Q; q0 += block)
+        {
+            const std::size_t q1 = std::min<std::size_t>(Q, q0 + block);
+            std::fill(P.begin(), P.end(), Value(0));
+            for (std::size_t q = q0; q < q1; ++q)
+            {
+                std::copy(&hx[q], &hx[q] + W + 1, &v[0]);
+                std::copy(&hy[q], &hy[q] + W + 1, &v[W + 1]);
+                for (std::size_t a = 0; a < D; ++a)
+                {
+                    const Value va = v[a];
+                    Value *Pa = &P[a*D];
+                    for (std::size_t c = 0; c <= a; ++c) Pa[c] += va * v[c];
+                }
+            }
+            for (std::size_t a = 0; a < D; ++a)
+                for (std::size_t c = 0; c <= a; ++c)
+                    kahan_add(G[a*D + c], Gc[a*D + c], P[a*D + c]);
+        }
+        hx.erase(hx.begin(), hx.begin() + Q);
+        hy.erase(hy.begin(), hy.begin() + Q);
+        hq += Q;
+    }
+
+    // Apply every pending order in one pass over the store
+    void pass()
+    {
+        using std::size_t;
+
+        const size_t L = pending.size();
+        begin(k + L);
+        const size_t C = (N - k + n - 1) / n;
+        read(0);
+        for (size_t c = 0; c < C; ++c)
+        {
+            const size_t A = k + c*n, m_c = std::min(n, N - A);
+            Value *f = &F[c % 3][0], *b = &B[c % 3][0];
+            if (c)
+            {
+                const Value* prior = &B[(c + 2) % 3][n];
+                std::copy(prior, prior + L, b);
+            }
+            bool failed = false;
+            std::string error;
+#ifdef _OPENMP
+#pragma omp parallel sections num_threads(2)
+#endif
+            {
+#ifdef _OPENMP
+#pragma omp section
+#endif
+                try
+                {
+                    update(A, m_c, f, b);
+                    reduce(A, m_c, f, b);
+                }
+                catch (std::exception& e) { note(failed, error, e); }
+#ifdef _OPENMP
+#pragma omp section
+#endif
+                try
+                {
+                    if (c) write(c - 1);
+                    if (c + 1 < C) read(c + 1);
+                }
+                catch (std::exception& e) { note(failed, error, e); }
+            }
+            AR_ENSURE_MSGEXCEPT(!failed, error, std::runtime_error);
+        }
+        if (C) write(C - 1);
+        k = K;
+        pending.clear();
+        finish();
+    }
+
+    // Form the exact next coefficient and predict those following it
+    void finish()
+    {
+        nhrc = ns + nc == 0            // Does special zero case apply?
+             ? 0                       // Yes, to avoid NaN from 0 / 0
+             : (ns + nc) / (ds + dc);  // No, as burg_fused_kernel would
+        ahead.clear();
+        if (W > 1) predict();
+    }
+
+    // Represent errors of successive orders as linear combinations of the
+    // window at each position.  Order K+s+2 pairs x(i+1) with y(i) for
+    // positions i in [0, M-s-2).  Windows starting before hq are within G
+    // while the remaining few positions in hx and hy are summed directly.
+    void predict()
+    {
+        using std::abs;
+        using std::size_t;
+        using std::sqrt;
+
+        const size_t M = N - K, T = hx.size();
+        std::vector<Value> S(D*D), x(D, Value(0)), y(D, Value(0)),
+                           a(D), tx(T + W + 1, Value(0)), ty(tx);
+        Value gmax = 0;
+        for (size_t r = 0; r < D; ++r)
+        {
+            for (size_t c = 0; c <= r; ++c)
+            {
+                S[r*D + c] = S[c*D + r] = G[r*D + c] - Gc[r*D + c];
+            }
+            gmax = std::max(gmax, S[r*D + r]);
+        }
+        std::copy(hx.begin(), hx.end(), tx.begin());
+        std::copy(hy.begin(), hy.end(), ty.begin());
+        x[0] = 1;
+        y[W + 1] = 1;
+
+        const Value eps = std::numeric_limits<Value>::epsilon();
+        Value mu = -2 * nhrc;
+        for (size_t s = 0; s + 2 <= W; ++s)
+        {
+            // Advance from order K+s to K+s+1 where x(i) becomes x(i+1) plus
+            // mu times y(i) and y(i) becomes y(i) plus mu times x(i+1).  The
+            // next order pairs a(i) = x(i+1) with y(i).
+            for (size_t h = 0; h <= W + 1; h += W + 1)
+            {
+                for (size_t j = W + 1; j-- > 0;)
+                {
+                    const Value xs = j ? x[h + j - 1] : Value(0);
+                    const Value ys = y[h + j];
+                    x[h + j] = xs + mu * ys;
+                    y[h + j] = ys + mu * xs;
+                }
+                for (size_t j = W + 1; j-- > 0;)
+                {
+                    a[h + j] = j ? x[h + j - 1] : Value(0);
+                }
+            }
+
+            // Quadratic forms over complete windows then the tail directly
+            Value num = 0, den = 0, l1a = 0, l1y = 0;
+            for (size_t r = 0; r < D; ++r)
+            {
+                Value Sa = 0, Sy = 0;
+                for (size_t c = 0; c < D; ++c)
+                {
+                    Sa += S[r*D + c] * a[c];
+                    Sy += S[r*D + c] * y[c];
+                }
+                num += a[r] * Sy;
+                den += a[r] * Sa + y[r] * Sy;
+                l1a += abs(a[r]);
+                l1y += abs(y[r]);
+            }
+            for (size_t i = hq; i + s + 2 < M; ++i)
+            {
+                Value xa = 0, xb = 0;
+                for (size_t j = 0; j <= W; ++j)
+                {
+                    xa += a[j] * tx[i - hq + j] + a[W + 1 + j] * ty[i - hq + j];
+                    xb += y[j] * tx[i - hq + j] + y[W + 1 + j] * ty[i - hq + j];
+                }
+                num += xa * xb;
+                den += xa * xa + xb * xb;
+            }
+
+            // Accept predictions only while cancellation remains modest
+            const Value next = num == 0 ? Value(0) : num / den;
+            if (!(den > 0) || !(abs(2 * next) <= 1)) break;
+            if ((l1a*l1a + l1y*l1y) * gmax * eps > sqrt(eps) * den) break;
+            ahead.push_back(next);
+            mu = -2 * next;
+        }
+    }
+};
+
+/** Adapts burg_chunked_engine to the kernel interface of burg_recursion. */
+template <class Engine>
+struct burg_chunked_kernel
+{
+    Engine* engine;
+
+    template <typename Value,
+              typename RandomAccessIterator1,
+              typename RandomAccessIterator2>
+    Value negative_half_reflection_coefficient(
+            RandomAccessIterator1,
+            RandomAccessIterator1,
+            RandomAccessIterator2) const
+    {
+        return engine->reflect();
+    }
+
+    template <typename RandomAccessIterator1,
+              typename RandomAccessIterator2,
+              typename Value>
+    Value update_and_reflect(RandomAccessIterator1 f_first,
+                             RandomAccessIterator1,
+                             RandomAccessIterator2,
+                             const Value           mu) const
+    {
+        return engine->advance(f_first, mu);
+    }
+};
+
+}
+
+/**
+ * Fit an autoregressive model using %Burg's method while keeping the forward
+ * and backward prediction errors in \c store rather than in memory.  This
+ * permits fitting signals whose prediction errors exceed available memory.
+ * Each pass over \c store covers one or more orders and streams the errors
+ * through memory in chunks of \c chunk samples.  The next chunk is read and
+ * the prior chunk is written while the current chunk is updated and
+ * reduced.  That overlap uses a second OpenMP thread when available.  Data
+ * in <tt>[data_first, data_last)</tt> is traversed once, or twice when
+ * \c subtract_mean is true, and is never retained.
+ *
+ * A \c Store holds <tt>2*N</tt> values in the working precision and provides
+ * <tt>read(first, count, out)</tt> and <tt>write(first, count, in)</tt>
+ * copying \c count values starting at offset \c first to or from a buffer.
+ * Offsets are written before they are read.  Calls on disjoint offsets may
+ * arrive concurrently from two threads.  For example, a file accessed by
+ * POSIX <tt>pread</tt> and <tt>pwrite</tt> suffices.
+ *
+ * When \c orders_per_pass is one, each order costs one read and one write of
+ * both error sequences.  Results are then bit-for-bit identical to those of
+ * \ref burg_method.  Larger values also accumulate the Gram matrix of
+ * <tt>orders_per_pass + 1</tt> successive positions of both sequences.  The
+ * following <tt>orders_per_pass - 1</tt> reflection coefficients are
+ * predicted from that matrix so one pass can apply that many orders.
+ * Forming a coefficient from the Gram matrix loses accuracy in proportion
+ * to how much the prediction errors shrink relative to the data.  Each
+ * predicted coefficient is therefore accepted only while the estimated
+ * relative rounding error stays below the square root of machine epsilon.
+ * After a rejection the next pass resumes computing coefficients exactly.
+ * The first coefficient after each pass is always exact.  Coefficients
+ * from passes applying several orders therefore only approximately match
+ * those of \ref burg_method, typically differing in their last half of
+ * significant digits, and derived quantities like \c sigma2e and \c gain
+ * may differ somewhat more on ill-conditioned data.
+ *
+ * @param[in]     data_first      Beginning of the input data range.
+ * @param[in]     data_last       Exclusive end of the input data range.
+ * @param[out]    mean            Mean of data.
+ * @param[in,out] maxorder        On input, the maximum model order desired.
+ *                                On output, the maximum model order
+ *                                computed.
+ * @param[out]    params_first    Per \ref burg_method.
+ * @param[out]    sigma2e_first   Per \ref burg_method.
+ * @param[out]    gain_first      Per \ref burg_method.
+ * @param[out]    autocor_first   Per \ref burg_method.
+ * @param[in]     subtract_mean   Should \c mean be subtracted from the data?
+ * @param[in]     hierarchy       Should the entire hierarchy of estimated
+ *                                models be output?
+ * @param[in,out] store           Storage for the prediction errors.
+ * @param[in]     chunk           Number of samples per chunk.  The three
+ *                                chunks in flight require roughly
+ *                                <tt>6*chunk</tt> values of memory plus
+ *                                <tt>2*chunk</tt> more whenever
+ *                                \c orders_per_pass exceeds one.
+ * @param[in]     orders_per_pass The maximum number of orders each pass
+ *                                may apply.  Only one reproduces
+ *                                \ref burg_method exactly.
+ * @param[in]     Ak              Working storage in the working precision.
+ * @param[in]     ac              Working storage similar to \c Ak.
+ * @param[in]     stop            Stopping policy per \ref burg_recursion.
+ *                                Stopping early saves every remaining pass.
+ *
+ * @returns the number data values processed within
+ *          <tt>[data_first, data_last)</tt>.
+ * @throws std::runtime_error whenever \c store reports an error by throwing.
+ */
+template <class ForwardIterator,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class Store,
+          class Vector,
+          class Stop>
+std::size_t burg_method_chunked(ForwardIterator   data_first,
+                                ForwardIterator   data_last,
+                                Value&            mean,
+                                std::size_t&      maxorder,
+                                OutputIterator1   params_first,
+                                OutputIterator2   sigma2e_first,
+                                OutputIterator3   gain_first,
+                                OutputIterator4   autocor_first,
+                                const bool        subtract_mean,
+                                const bool        hierarchy,
+                                Store&            store,
+                                const std::size_t chunk,
+                                const std::size_t orders_per_pass,
+                                Vector&           Ak,
+                                Vector&           ac,
+                                Stop              stop)
+{
+    using std::min;
+    using std::size_t;
+
+    typedef burg_chunked_engine<Store, Value> engine_type;
+
+    const size_t N = std::distance(data_first, data_last);
+
+    // At most maxorder N-1 can be fit from N samples.  Beware N is unsigned.
+    maxorder = (N == 0) ? 0 : min(static_cast<size_t>(maxorder), N-1);
+
+    // Stream the data into the store only when recursion is required
+    Value sigma2e;
+    engine_type engine(store, N, chunk, orders_per_pass);
+    engine.load(data_first, subtract_mean, maxorder > 0, mean, sigma2e);
+
+    // Positions stand in for prediction error iterators within the store
+    burg_chunked_kernel<engine_type> kernel;
+    kernel.engine = &engine;
+    maxorder = burg_recursion(size_t(0), size_t(0), N, sigma2e, maxorder,
+                              params_first, sigma2e_first, gain_first,
+                              autocor_first, hierarchy, Ak, ac, kernel, stop);
+
+    return N;
+}
+
+/**
+ * Fit an autoregressive model using %Burg's method through \c maxorder
+ * while keeping the prediction errors in \c store.
+ * @copydetails burg_method_chunked(ForwardIterator,ForwardIterator,Value&,std::size_t&,OutputIterator1,OutputIterator2,OutputIterator3,OutputIterator4,const bool,const bool,Store&,const std::size_t,const std::size_t,Vector&,Vector&,Stop)
+ */
+template <class ForwardIterator,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4,
+          class Store>
+std::size_t burg_method_chunked(ForwardIterator   data_first,
+                                ForwardIterator   data_last,
+                                Value&            mean,
+                                std::size_t&      maxorder,
+                                OutputIterator1   params_first,
+                                OutputIterator2   sigma2e_first,
+                                OutputIterator3   gain_first,
+                                OutputIterator4   autocor_first,
+                                const bool        subtract_mean,
+                                const bool        hierarchy,
+                                Store&            store,
+                                const std::size_t chunk           = 1048576,
+                                const std::size_t orders_per_pass = 1)
+{
+    std::vector<Value> Ak, ac;
+    return burg_method_chunked(data_first, data_last, mean, maxorder,
+                               params_first, sigma2e_first, gain_first,
+                               autocor_first, subtract_mean, hierarchy,
+                               store, chunk, orders_per_pass, Ak, ac,
+                               burg_never_stop());
+}
+
+// Helpers for nuttall_strand_method operating on dense, row-major d-by-d
+// matrices.  Channel counts are modest so simple loops suffice.
+namespace
+{
+
+// C = op(A) op(B) where op transposes whenever requested
+template <typename Value>
+void ns_multiply(const std::size_t d,
+                 const Value* A, const bool transA,
+                 const Value* B, const bool transB,
+                 Value* C)
+{
+    for (std::size_t i = 0; i < d; ++i)
+    {
+        for (std::size_t j = 0; j < d; ++j)
+        {
+            Value s = 0;
+            for (std::size_t k = 0; k < d; ++k)
+            {
+                s += (transA ? A[k*d + i] : A[i*d + k])
+                   * (transB ? B[j*d + k] : B[k*d + j]);
+            }
+            C[i*d + j] = s;
+        }
+    }
+}
+
+// Overwrite symmetric S by its lower Cholesky factor returning false
+// whenever S is not numerically positive definite
+template <typename Value>
+bool ns_cholesky(const std::size_t d, Value* S)
+{
+    using std::sqrt;
+    for (std::size_t j = 0; j < d; ++j)
+    {
+        Value s = S[j*d + j];
+        for (std::size_t k = 0; k < j; ++k) s -= S[j*d + k]*S[j*d + k];
+        if (!(s > 0)) return false;
+        S[j*d + j] = sqrt(s);
+        for (std::size_t i = j + 1; i < d; ++i)
+        {
+            Value t = S[i*d + j];
+            for (std::size_t k = 0; k < j; ++k) t -= S[i*d + k]*S[j*d + k];
+            S[i*d + j] = t / S[j*d + j];
+        }
+        for (std::size_t i = 0; i < j; ++i) S[i*d + j] = 0;
+    }
+    return true;
+}
+
+// M = L M given lower triangular L
+template <typename Value>
+void ns_lower_multiply(const std::size_t d, const Value* L, Value* M)
+{
+    for (std::size_t i = d; i-- > 0;)
+    {
+        for (std::size_t c = 0; c < d; ++c) M[i*d + c] *= L[i*d + i];
+        for (std::size_t k = 0; k < i; ++k)
+            for (std::size_t c = 0; c < d; ++c)
+                M[i*d + c] += L[i*d + k]*M[k*d + c];
+    }
+}
+
+// M = inv(L) M given lower triangular L
+template <typename Value>
+void ns_lower_solve(const std::size_t d, const Value* L, Value* M)
+{
+    for (std::size_t i = 0; i < d; ++i)
+    {
+        for (std::size_t k = 0; k < i; ++k)
+            for (std::size_t c = 0; c < d; ++c)
+                M[i*d + c] -= L[i*d + k]*M[k*d + c];
+        for (std::size_t c = 0; c < d; ++c) M[i*d + c] /= L[i*d + i];
+    }
+}
+
+// M = M inv(L') given lower triangular L
+template <typename Value>
+void ns_solve_transpose(const std::size_t d, const Value* L, Value* M)
+{
+    for (std::size_t r = 0; r < d; ++r)
+    {
+        Value* x = M + r*d;
+        for (std::size_t i = 0; i < d; ++i)
+        {
+            for (std::size_t k = 0; k < i; ++k) x[i] -= L[i*d + k]*x[k];
+            x[i] /= L[i*d + i];
+        }
+    }
+}
+
+// M = M inv(L) given lower triangular L
+template <typename Value>
+void ns_solve(const std::size_t d, const Value* L, Value* M)
+{
+    for (std::size_t r = 0; r < d; ++r)
+    {
+        Value* x = M + r*d;
+        for (std::size_t i = d; i-- > 0;)
+        {
+            for (std::size_t k = i + 1; k < d; ++k) x[i] -= x[k]*L[k*d + i];
+            x[i] /= L[i*d + i];
+        }
+    }
+}
+
+// Diagonalize symmetric S = V diag(w) V' by cyclic Jacobi rotations
+// destroying S in the process
+template <typename Value>
+void ns_eigen(const std::size_t d, Value* S, Value* V, Value* w)
+{
+    using std::abs;
+    using std::sqrt;
+
+    for (std::size_t i = 0; i < d*d; ++i) V[i] = 0;
+    for (std::size_t i = 0; i < d; ++i) V[i*d + i] = 1;
+
+    const Value eps = std::numeric_limits<Value>::epsilon();
+    for (int sweep = 0; sweep < 64; ++sweep)
+    {
+        Value off = 0, diag = 0;
+        for (std::size_t p = 0; p < d; ++p)
+        {
+            diag += S[p*d + p]*S[p*d + p];
+            for (std::size_t q = p + 1; q < d; ++q)
+                off += S[p*d + q]*S[p*d + q];
+        }
+        if (!(off > eps*eps*diag)) break;  // Also catches NaN
+
+        for (std::size_t p = 0; p < d; ++p)
+        {
+            for (std::size_t q = p + 1; q < d; ++q)
+            {
+                const Value spq = S[p*d + q];
+                if (spq == 0) continue;
+                const Value theta = (S[q*d + q] - S[p*d + p]) / (2*spq);
+                Value t = 1 / (abs(theta) + sqrt(theta*theta + 1));
+                if (theta < 0) t = -t;
+                const Value c = 1 / sqrt(t*t + 1), s = t*c;
+                for (std::size_t k = 0; k < d; ++k)
+                {
+                    const Value skp = S[k*d + p], skq = S[k*d + q];
+                    S[k*d + p] = c*skp - s*skq;
+                    S[k*d + q] = s*skp + c*skq;
+                }
+                for (std::size_t k = 0; k < d; ++k)
+                {
+                    const Value spk = S[p*d + k], sqk = S[q*d + k];
+                    S[p*d + k] = c*spk - s*sqk;
+                    S[q*d + k] = s*spk + c*sqk;
+                }
+                for (std::size_t k = 0; k < d; ++k)
+                {
+                    const Value vkp = V[k*d + p], vkq = V[k*d + q];
+                    V[k*d + p] = c*vkp - s*vkq;
+                    V[k*d + q] = s*vkp + c*vkq;
+                }
+            }
+        }
+    }
+    for (std::size_t i = 0; i < d; ++i) w[i] = S[i*d + i];
+}
+
+// Backward errors are stored so that b[n-m] holds order m's error preceding
+// f[n].  Given the order m just computed, optionally update f[n] and b[n-m]
+// for n in [m, N) given reflection matrices A and B and then accumulate the
+// lower triangles of sum f f' and sum b b' and all of sum f b' over pairs
+// (f[n], b[n-m-1]) for n in [m+1, N).  Rows are processed in blocks so each
+// block is updated and reduced while resident in cache.
+template <typename Value>
+void ns_pass(const std::size_t d,
+             Value*            f,
+             Value*            b,
+             const std::size_t m,
+             const std::size_t N,
+             const Value*      A,
+             const Value*      B,
+             Value*            Sff,
+             Value*            Sbb,
+             Value*            Sfb,
+             Value*            tf,
+             Value*            tb)
+{
+    using std::min;
+    using std::size_t;
+    enum { block = 64 };
+
+    std::fill(Sff, Sff + d*d, Value(0));
+    std::fill(Sbb, Sbb + d*d, Value(0));
+    std::fill(Sfb, Sfb + d*d, Value(0));
+    for (size_t n0 = m; n0 < N; n0 += block)
+    {
+        const size_t R = min<size_t>(N - n0, block);
+        Value* fr = f + n0*d;
+        Value* br = b + (n0 - m)*d;
+
+        // f += b A' and b += f B' using the prior f
+        if (A)
+        {
+            for (size_t i = 0; i < d; ++i)
+            {
+                const Value* Ai = A + i*d;
+                const Value* Bi = B + i*d;
+                for (size_t r = 0; r < R; ++r)
+                {
+                    const Value* fn = fr + r*d;
+                    const Value* bn = br + r*d;
+                    Value sf = fn[i], sb = bn[i];
+                    for (size_t j = 0; j < d; ++j)
+                    {
+                        sf += Ai[j]*bn[j];
+                        sb += Bi[j]*fn[j];
+                    }
+                    tf[r*d + i] = sf;
+                    tb[r*d + i] = sb;
+                }
+            }
+            std::copy(tf, tf + R*d, fr);
+            std::copy(tb, tb + R*d, br);
+        }
+
+        // Reduce rows after m into the products where, with b updated
+        // in place, row r pairs with the backward error just prior to br
+        const size_t s = (n0 == m) ? 1 : 0;
+        for (size_t i = 0; i < d; ++i)
+        {
+            for (size_t j = 0; j < d; ++j)
+            {
+                Value ff = 0, bb = 0, fb = 0;
+                for (size_t r = s; r < R; ++r)
+                {
+                    const Value* fn = fr + r*d;
+                    const Value* bn = br + (r - 1)*d;
+                    if (j <= i)
+                    {
+                        ff += fn[i]*fn[j];
+                        bb += bn[i]*bn[j];
+                    }
+                    fb += fn[i]*bn[j];
+                }
+                if (j <= i)
+                {
+                    Sff[i*d + j] += ff;
+                    Sbb[i*d + j] += bb;
+                }
+                Sfb[i*d + j] += fb;
+            }
+        }
+    }
+    for (size_t i = 0; i < d; ++i)
+    {
+        for (size_t j = 0; j < i; ++j)
+        {
+            Sff[j*d + i] = Sff[i*d + j];
+            Sbb[j*d + i] = Sbb[i*d + j];
+        }
+    }
+}
+
+}
+
+/**
+ * Fit a multivariate autoregressive model to \c d coupled channels using the
+ * Nuttall-Strand generalization of %Burg's method.  The model is
+ * \f{align}{
+ *     \vec{x}_n + A_1 \vec{x}_{n-1} + \dots + A_p \vec{x}_{n-p}
+ *     &= \vec{\epsilon}_n
+ *     &
+ *     \vec{\epsilon}_n &\sim{} N\left(0, \Sigma\right)
+ * \f}
+ * where each \f$A_i\f$ is a \c d by \c d matrix.  Following section 15.8 of
+ * Marple, S. L. Digital spectral analysis with applications. Prentice-Hall,
+ * 1987, each order's reflection matrices minimize the sum of forward and
+ * backward prediction errors weighted by inverse error covariances.  The
+ * resulting Sylvester equation is solved after whitening by the Cholesky
+ * factors of both error covariances and diagonalizing the two whitened
+ * products by Jacobi rotations.  When \c d is one, the recursion reduces to
+ * that of \ref burg_method up to rounding.
+ *
+ * Each order requires one pass over the prediction errors which updates a
+ * block of rows and immediately accumulates the next order's products from
+ * that block.  Matrix work per order costs \f$O(pd^3)\f$ while each pass costs
+ * \f$O(Nd^2)\f$.  The recursion stops early should either error covariance
+ * cease to be numerically positive definite.
+ *
+ * @param[in]     data_first    Beginning of the input data range holding
+ *                              samples in row-major order.  That is, the
+ *                              \c d channels of sample zero come first.
+ * @param[in]     data_last     Exclusive end of the input data range.
+ * @param[in]     d             Number of channels.
+ * @param[out]    mean_first    Mean of each channel.  Exactly \c d values
+ *                              will be output.
+ * @param[in,out] maxorder      On input, the maximum model order desired.
+ *                              On output, the maximum model order computed.
+ * @param[out]    params_first  Row-major \f$A_1, \dots, A_p\f$ for a single
+ *                              model or for an entire hierarchy of models.
+ *                              At most <tt>d*d*(!hierarchy ? maxorder :
+ *                              maxorder*(maxorder+1)/2)</tt> values will be
+ *                              output.
+ * @param[out]    sigma2e_first Row-major innovation covariance \f$\Sigma\f$
+ *                              for only AR(<tt>maxorder</tt>) or for an
+ *                              entire hierarchy.  Either <tt>d*d</tt> or at
+ *                              most <tt>d*d*(maxorder + 1)</tt> values will
+ *                              be output.
+ * @param[in]     subtract_mean Should each channel's mean be subtracted?
+ * @param[in]     hierarchy     Should the entire hierarchy of estimated
+ *                              models be output?
+ * @param[in]     f             Working storage.  Reuse across invocations
+ *                              may speed execution by avoiding allocations.
+ * @param[in]     b             Working storage similar to \c f.
+ *
+ * @returns the number of samples per channel within
+ *          <tt>[data_first, data_last)</tt>.
+ * @throws std::invalid_argument if \c d is zero, if the data does not hold
+ *         a whole number of samples, or if the channel covariance is not
+ *         positive definite.
+ */
+template <class InputIterator,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class Vector>
+std::size_t nuttall_strand_method(InputIterator    data_first,
+                                  InputIterator    data_last,
+                                  const std::size_t d,
+                                  OutputIterator1  mean_first,
+                                  std::size_t&     maxorder,
+                                  OutputIterator2  params_first,
+                                  OutputIterator3  sigma2e_first,
+                                  const bool       subtract_mean,
+                                  const bool       hierarchy,
+                                  Vector&          f,
+                                  Vector&          b)
+{
+    using std::copy;
+    using std::min;
+    using std::size_t;
+    using std::vector;
+
+    typedef typename Vector::value_type Value;
+
+    // Load data and compute per-channel means as burg_method would
+    AR_ENSURE_ARG(d > 0);
+    f.assign(data_first, data_last);
+    AR_ENSURE_ARG(f.size() % d == 0);
+    const size_t N = f.size() / d, dd = d*d;
+    vector<Value> mean(d, Value(0));
+    for (size_t n = 0; n < N; ++n)
+        for (size_t i = 0; i < d; ++i)
+            mean[i] += (f[n*d + i] - mean[i]) / (n + 1);
+    copy(mean.begin(), mean.end(), mean_first);
+    if (subtract_mean)
+    {
+        for (size_t n = 0; n < N; ++n)
+            for (size_t i = 0; i < d; ++i)
+                f[n*d + i] -= mean[i];
+    }
+
+    // At most maxorder N-1 can be fit from N samples.  Beware N is unsigned.
+    maxorder = (N == 0) ? 0 : min(static_cast<size_t>(maxorder), N-1);
+
+    // Zeroth order covariance with Pf, Pb holding the error covariances
+    // Matrix workspace is carved from one allocation
+    vector<Value> work(16*dd + 2*d, Value(0));
+    Value *Pf = &work[0],     *Pb = Pf + dd,  *Lf = Pb + dd, *Lb = Lf + dd,
+          *Sff = Lb + dd,     *Sbb = Sff + dd, *Sfb = Sbb + dd,
+          *U = Sfb + dd,      *V = U + dd,     *X = V + dd,   *Y = X + dd,
+          *Dt = Y + dd,       *Am = Dt + dd,   *Bm = Am + dd,
+          *T1 = Bm + dd,      *T2 = T1 + dd,
+          *lambda = T2 + dd,  *mu = lambda + d;
+    vector<Value> tf(64*d), tb(64*d);
+    if (N)
+    {
+        for (size_t n = 0; n < N; ++n)
+            for (size_t i = 0; i < d; ++i)
+                for (size_t j = 0; j <= i; ++j)
+                    Pf[i*d + j] += f[n*d + i]*f[n*d + j];
+        for (size_t i = 0; i < d; ++i)
+            for (size_t j = 0; j <= i; ++j)
+                Pb[i*d + j] = Pb[j*d + i] = Pf[j*d + i] = Pf[i*d + j] /= N;
+        copy(Pf, Pf + dd, Lf);
+        AR_ENSURE_MSGEXCEPT(ns_cholesky(d, Lf),
+                            "Channel covariance is not positive definite",
+                            std::invalid_argument);
+    }
+    if (hierarchy || maxorder == 0)
+    {
+        sigma2e_first = copy(Pf, Pf + dd, sigma2e_first);
+    }
+
+    // Forward coefficients A_1..A_m and backward coefficients D_0..D_{m-1}
+    // for which b_m(n) = x(n-m) + sum_j D_j x(n-j).  Initial products use
+    // pairs (f[n], b[n-1]) for n in [1, N) as ns_pass documents.
+    vector<Value> Ak(maxorder*dd), Dk(maxorder*dd), An(Ak), Dn(Dk);
+    if (maxorder)
+    {
+        b = f;
+        ns_pass(d, &f[0], &b[0], size_t(0), N,
+                static_cast<const Value*>(NULL), static_cast<const Value*>(NULL),
+                Sff, Sbb, Sfb, &tf[0], &tb[0]);
+    }
+    size_t reached = maxorder;
+    for (size_t m = 1; m <= maxorder; ++m)
+    {
+        // Whiten using Cholesky factors of both error covariances
+        // Stop early, retaining the prior model, when either is singular
+        copy(Pf, Pf + dd, Lf);
+        copy(Pb, Pb + dd, Lb);
+        if (!ns_cholesky(d, Lf) || !ns_cholesky(d, Lb))
+        {
+            reached = m - 1;
+            if (!hierarchy)
+            {
+                params_first  = copy(Ak.begin(), Ak.begin() + reached*dd,
+                                     params_first);
+                sigma2e_first = copy(Pf, Pf + dd, sigma2e_first);
+            }
+            break;
+        }
+        copy(Sff, Sff + dd, X);
+        ns_lower_solve(d, Lf, X);
+        ns_solve_transpose(d, Lf, X);
+        copy(Sbb, Sbb + dd, Y);
+        ns_lower_solve(d, Lb, Y);
+        ns_solve_transpose(d, Lb, Y);
+        copy(Sfb, Sfb + dd, T1);
+        ns_lower_solve(d, Lf, T1);
+        ns_solve_transpose(d, Lb, T1);
+
+        // Solve X Dt + Dt Y = 2 T1 by diagonalizing X and Y
+        ns_eigen(d, X, U, lambda);
+        ns_eigen(d, Y, V, mu);
+        ns_multiply(d, T1, false, V, false, T2);
+        ns_multiply(d, U, true, T2, false, T1);
+        for (size_t i = 0; i < d; ++i)
+        {
+            for (size_t j = 0; j < d; ++j)
+            {
+                const Value den = lambda[i] + mu[j];
+                T1[i*d + j] = den > 0 ? 2 * T1[i*d + j] / den : Value(0);
+            }
+        }
+        ns_multiply(d, T1, false, V, true, T2);
+        ns_multiply(d, U, false, T2, false, Dt);
+
+        // Reflection matrices Am = -Lf Dt inv(Lb) and Bm = -Lb Dt' inv(Lf)
+        copy(Dt, Dt + dd, Am);
+        ns_lower_multiply(d, Lf, Am);
+        ns_solve(d, Lb, Am);
+        for (size_t i = 0; i < d; ++i)
+            for (size_t j = 0; j < d; ++j)
+                Bm[i*d + j] = Dt[j*d + i];
+        ns_lower_multiply(d, Lb, Bm);
+        ns_solve(d, Lf, Bm);
+        for (size_t i = 0; i < dd; ++i) { Am[i] = -Am[i]; Bm[i] = -Bm[i]; }
+
+        // Pf = Lf (I - Dt Dt') Lf' and Pb = Lb (I - Dt' Dt) Lb'
+        ns_multiply(d, Dt, false, Dt, true, T1);
+        ns_multiply(d, Dt, true, Dt, false, T2);
+        for (size_t i = 0; i < dd; ++i) { T1[i] = -T1[i]; T2[i] = -T2[i]; }
+        for (size_t i = 0; i < d; ++i) { T1[i*d + i] += 1; T2[i*d + i] += 1; }
+        ns_lower_multiply(d, Lf, T1);
+        ns_multiply(d, T1, false, Lf, true, Pf);
+        ns_lower_multiply(d, Lb, T2);
+        ns_multiply(d, T2, false, Lb, true, Pb);
+        for (size_t i = 0; i < d; ++i)
+        {
+            for (size_t j = 0; j < i; ++j)
+            {
+                Pf[i*d + j] = Pf[j*d + i] = (Pf[i*d + j] + Pf[j*d + i]) / 2;
+                Pb[i*d + j] = Pb[j*d + i] = (Pb[i*d + j] + Pb[j*d + i]) / 2;
+            }
+        }
+
+        // A_j += Am D_{j-1} and D_j = D_{j-1} + Bm A_j where A_0 = I,
+        // D_{-1} = 0, and D_{m-1} = I prior to this order
+        for (size_t j = 1; j < m; ++j)
+        {
+            ns_multiply(d, Am, false, &Dk[(j-1)*dd], false, &An[(j-1)*dd]);
+            for (size_t i = 0; i < dd; ++i) An[(j-1)*dd + i] += Ak[(j-1)*dd + i];
+            ns_multiply(d, Bm, false, &Ak[(j-1)*dd], false, &Dn[j*dd]);
+            for (size_t i = 0; i < dd; ++i) Dn[j*dd + i] += Dk[(j-1)*dd + i];
+        }
+        copy(Am, Am + dd, An.begin() + (m-1)*dd);
+        copy(Bm, Bm + dd, Dn.begin());
+        std::swap_ranges(An.begin(), An.begin() + m*dd, Ak.begin());
+        std::swap_ranges(Dn.begin(), Dn.begin() + m*dd, Dk.begin());
+
+        // Output parameters and the innovation covariance when requested
+        if (hierarchy || m == maxorder)
+        {
+            params_first  = copy(Ak.begin(), Ak.begin() + m*dd, params_first);
+            sigma2e_first = copy(Pf, Pf + dd, sigma2e_first);
+        }
+
+        // Update f and b and find the next order's products in one pass
+        if (m < maxorder)
+        {
+            ns_pass(d, &f[0], &b[0], m, N, Am, Bm,
+                    Sff, Sbb, Sfb, &tf[0], &tb[0]);
+        }
+    }
+    maxorder = reached;
+
+    return N;
+}
+
+/**
+ * Fit a multivariate autoregressive model using the Nuttall-Strand method.
+ * @copydetails nuttall_strand_method(InputIterator,InputIterator,const std::size_t,OutputIterator1,std::size_t&,OutputIterator2,OutputIterator3,const bool,const bool,Vector&,Vector&)
+ */
+template <class InputIterator,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3>
+std::size_t nuttall_strand_method(InputIterator    data_first,
+                                  InputIterator    data_last,
+                                  const std::size_t d,
+                                  OutputIterator1  mean_first,
+                                  std::size_t&     maxorder,
+                                  OutputIterator2  params_first,
+                                  OutputIterator3  sigma2e_first,
+                                  const bool       subtract_mean = false,
+                                  const bool       hierarchy     = false)
+{
+    std::vector<typename std::iterator_traits<InputIterator>::value_type> f, b;
+    return nuttall_strand_method(data_first, data_last, d, mean_first,
+                                 maxorder, params_first, sigma2e_first,
+                                 subtract_mean, hierarchy, f, b);
+}
+
+/**
+ * Fit autoregressive models given autocovariances \f$\gamma_0, \dots,
+ * \gamma_p\f$ by solving the Yule-Walker equations using the
+ * Levinson-Durbin recursion.  Outputs follow those of \ref burg_method.  That
+ * is, parameters for AR(<tt>maxorder</tt>) or for an entire hierarchy, the
+ * mean squared discrepancy \f$\sigma^2_\epsilon\f$ and gain for either
+ * AR(<tt>maxorder</tt>) or all orders including zero, and autocorrelations
+ * for lags <tt>[0,maxorder]</tt>.  Should \f$\gamma_0\f$ vanish, all
+ * reflection coefficients are taken to be zero.  Complexity is
+ * <tt>O(maxorder^2)</tt>.
+ *
+ * @param[in]  maxorder      Maximum model order desired.
+ * @param[in]  autocov_first Beginning of \f$\gamma_0, \dots,
+ *                           \gamma_{\mbox{\scriptsize maxorder}}\f$.
+ * @param[out] params_first  Model parameters.
+ * @param[out] sigma2e_first Mean squared discrepancies.
+ * @param[out] gain_first    Model gains.
+ * @param[out] autocor_first Lag zero through lag maxorder autocorrelations.
+ * @param[in]  hierarchy     Should the entire hierarchy of models be output?
+ */
+template <class RandomAccessIterator,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4>
+void levinson_durbin(const std::size_t    maxorder,
+                     RandomAccessIterator autocov_first,
+                     OutputIterator1      params_first,
+                     OutputIterator2      sigma2e_first,
+                     OutputIterator3      gain_first,
+                     OutputIterator4      autocor_first,
+                     const bool           hierarchy = false)
+{
+    using std::size_t;
+    using std::vector;
+    typedef typename std::iterator_traits<
+            RandomAccessIterator
+        >::value_type Value;
+
+    const Value gamma0 = autocov_first[0];
+    Value sigma2e = gamma0;
+    Value gain    = 1;
+    if (hierarchy || maxorder == 0)
+    {
+        *sigma2e_first++ = sigma2e;
+        *gain_first++    = gain;
+    }
+
+    vector<Value> a(maxorder + 1, Value(0)), t(maxorder + 1);
+    a[0] = 1;
+    for (size_t m = 1; m <= maxorder; ++m)
+    {
+        // Reflection coefficient from the prediction error of order m-1
+        Value num = autocov_first[m];
+        for (size_t j = 1; j < m; ++j) num += a[j] * autocov_first[m - j];
+        const Value k = sigma2e == 0 ? Value(0) : -num / sigma2e;
+
+        for (size_t j = 1; j < m; ++j) t[j] = a[j] + k*a[m - j];
+        for (size_t j = 1; j < m; ++j) a[j] = t[j];
+        a[m] = k;
+
+        sigma2e *= (1 - k*k);
+        gain    *= 1 / (1 - k*k);
+        if (hierarchy || m == maxorder)
+        {
+            params_first = std::copy(a.begin() + 1, a.begin() + m + 1,
+                                     params_first);
+            *sigma2e_first++ = sigma2e;
+            *gain_first++    = gain;
+        }
+    }
+
+    for (size_t m = 0; m <= maxorder; ++m)
+    {
+        *autocor_first++ = gamma0 == 0 ? Value(m == 0)
+                                       : autocov_first[m] / gamma0;
+    }
+}
+
+// Helpers for autocovariance computing circular correlations by FFT
+namespace
+{
+
+/**
+ * Compute an unnormalized discrete Fourier transform in place by the
+ * iterative radix-2 Cooley-Tukey algorithm.  Real and imaginary parts are
+ * stored separately in \c re and \c im whose common size must be a power of
+ * two.  Twiddle factors are evaluated directly, rather than by recurrence,
+ * to avoid accumulating rounding errors.
+ */
+template <typename Value>
+void fft_radix2(std::vector<Value>& re,
+                std::vector<Value>& im,
+                const bool inverse)
+{
+    using std::cos;
+    using std::sin;
+    using std::size_t;
+    using std::swap;
+
+    const size_t n = re.size();
+    assert(im.size() == n && (n & (n - 1)) == 0);
+
+    // Permute into bit-reversed order
+    for (size_t i = 1, j = 0; i < n; ++i)
+    {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j)
+        {
+            swap(re[i], re[j]);
+            swap(im[i], im[j]);
+        }
+    }
+
+    // Combine successively longer transforms with butterflies
+    const Value pi = Value(3.14159265358979323846264338327950288L);
+    for (size_t len = 2; len <= n; len <<= 1)
+    {
+        const size_t half = len / 2;
+        const Value theta = (inverse ? 2 : -2) * pi / len;
+        for (size_t k = 0; k < half; ++k)
+        {
+            const Value wr = cos(theta*k), wi = sin(theta*k);
+            for (size_t i = k; i < n; i += len)
+            {
+                const size_t j = i + half;
+                const Value vr = re[j]*wr - im[j]*wi;
+                const Value vi = re[j]*wi + im[j]*wr;
+                re[j] = re[i] - vr;
+                im[j] = im[i] - vi;
+                re[i] += vr;
+                im[i] += vi;
+            }
+        }
+    }
+}
+
+}
+
+/**
+ * Compute the biased sample autocovariance \f$\gamma_k = \frac{1}{N}
+ * \sum_{n=0}^{N-k-1} x_n x_{n+k}\f$ for lags <tt>[0,maxlag]</tt> in a
+ * single pass over the data.  Whenever the quadratic cost of computing lags
+ * directly would exceed it, the lags are obtained from the zero-padded power
+ * spectrum in <tt>O(N log N)</tt> time.  As with \ref burg_method, the mean
+ * is computed, returned in \c mean, and removed only when \c subtract_mean
+ * is true.  Otherwise the autocovariance is taken about zero.  The biased
+ * estimate is positive semi-definite, so \ref levinson_durbin then always
+ * produces stationary models.
+ *
+ * @param[in]     data_first    Beginning of the input data range.
+ * @param[in]     data_last     Exclusive end of the input data range.
+ * @param[out]    mean          Mean of data.
+ * @param[in,out] maxlag        On input, the maximum lag desired.  On
+ *                              output, the maximum lag computed which is
+ *                              at most <tt>N-1</tt>.
+ * @param[out]    autocov_first Destination for \f$\gamma_0, \dots,
+ *                              \gamma_{\mbox{\scriptsize maxlag}}\f$.
+ * @param[in]     subtract_mean Should \c mean be subtracted from the data?
+ *
+ * @returns the number data values processed within
+ *          <tt>[data_first, data_last)</tt>.
+ */
+template <class InputIterator,
+          class Value,
+          class OutputIterator>
+std::size_t autocovariance(InputIterator  data_first,
+                           InputIterator  data_last,
+                           Value&         mean,
+                           std::size_t&   maxlag,
+                           OutputIterator autocov_first,
+                           const bool     subtract_mean)
+{
+    using std::min;
+    using std::size_t;
+    using std::vector;
+
+    vector<Value> x(data_first, data_last);
+    const size_t N = x.size();
+    mean = 0;
+    Value var = 0;
+    welford_variance_population(x.begin(), x.end(), mean, var);
+    if (subtract_mean)
+    {
+        for (size_t i = 0; i < N; ++i) x[i] -= mean;
+    }
+    maxlag = (N == 0) ? 0 : min(maxlag, N - 1);
+    if (N == 0)
+    {
+        *autocov_first++ = 0;
+        return N;
+    }
+
+    // Zero padding to M >= N + maxlag prevents circular wrap-around
+    size_t M = 1, log2M = 0;
+    while (M < N + maxlag) { M <<= 1; ++log2M; }
+
+    // Compare rough operation counts for the direct and FFT approaches
+    if (N * (maxlag + 1) <= 8 * M * (log2M + 1))
+    {
+        for (size_t k = 0; k <= maxlag; ++k)
+        {
+            Value acc = 0;
+            for (size_t n = 0; n + k < N; ++n) acc += x[n] * x[n + k];
+            *autocov_first++ = acc / N;
+        }
+    }
+    else
+    {
+        x.resize(M);
+        vector<Value> y(M);
+        fft_radix2(x, y, false);
+        for (size_t i = 0; i < M; ++i)
+        {
+            x[i] = x[i]*x[i] + y[i]*y[i];
+            y[i] = 0;
+        }
+        fft_radix2(x, y, true);
+        for (size_t k = 0; k <= maxlag; ++k)
+        {
+            *autocov_first++ = x[k] / M / N;
+        }
+    }
+
+    return N;
+}
+
+/**
+ * Fit an autoregressive model to stationary time series data by solving
+ * the Yule-Walker equations.  The \ref autocovariance is computed and then
+ * \ref levinson_durbin solves the equations for the requested order or the
+ * entire hierarchy.  Arguments and outputs are exactly those of \ref
+ * burg_method so that, for example, \ref best_model with \ref YuleWalker
+ * criteria applies unchanged.  Cost is <tt>O(N log N + maxorder^2)</tt>
+ * rather than the <tt>O(N maxorder)</tt> of %Burg's method.  Yule-Walker
+ * estimates are biased for short or strongly correlated signals, so prefer
+ * \ref burg_method unless \c N and \c maxorder are both large.
+ *
+ * @param[in]     data_first    Beginning of the input data range.
+ * @param[in]     data_last     Exclusive end of the input data range.
+ * @param[out]    mean          Mean of data.
+ * @param[in,out] maxorder      On input, the maximum model order desired.
+ *                              On output, the maximum model order computed.
+ * @param[out]    params_first  Per \ref burg_method.
+ * @param[out]    sigma2e_first Per \ref burg_method.
+ * @param[out]    gain_first    Per \ref burg_method.
+ * @param[out]    autocor_first Per \ref burg_method.
+ * @param[in]     subtract_mean Should \c mean be subtracted from the data?
+ * @param[in]     hierarchy     Should the entire hierarchy of estimated
+ *                              models be output?
+ *
+ * @returns the number data values processed within
+ *          <tt>[data_first, data_last)</tt>.
+ */
+template <class InputIterator,
+          class Value,
+          class OutputIterator1,
+          class OutputIterator2,
+          class OutputIterator3,
+          class OutputIterator4>
+std::size_t yule_walker_method(InputIterator   data_first,
+                               InputIterator   data_last,
+                               Value&          mean,
+                               std::size_t&    maxorder,
+                               OutputIterator1 params_first,
+                               OutputIterator2 sigma2e_first,
+                               OutputIterator3 gain_first,
+                               OutputIterator4 autocor_first,
+                               const bool      subtract_mean,
+                               const bool      hierarchy = false)
+{
+    std::vector<Value> gamma;
+    gamma.reserve(maxorder + 1);
+    const std::size_t N = autocovariance(data_first, data_last, mean,
+                                         maxorder, std::back_inserter(gamma),
+                                         subtract_mean);
+    levinson_durbin(maxorder, gamma.begin(), params_first, sigma2e_first,
+                    gain_first, autocor_first, hierarchy);
+    return N;
+}
+
+/**
+ * Accumulate lagged products over a sliding window of samples so that
+ * autoregressive models for the window may be fit on demand without
+ * reprocessing its samples.  Each \ref push or \ref pop costs
+ * <tt>O(maxorder)</tt> while each \ref fit costs <tt>O(maxorder^2)</tt>
+ * per \ref levinson_durbin.  The models are Yule-Walker estimates based on
+ * the biased autocovariance of the window rather than %Burg estimates, as
+ * %Burg's method cannot be updated incrementally.  Consider \ref YuleWalker
+ * when selecting among them.
+ *
+ * Sums are kept relative to a shift, initially the first sample and later
+ * the window mean, to curb cancellation.  Rounding errors accrued by retiring
+ * samples are discarded by recomputing the sums from the retained window,
+ * shifted by its mean, every time as many samples have been retired as the
+ * window holds.  Memory is proportional to
+ * the window size.
+ */
+template <typename Value>
+class yule_walker_accumulator
+{
+public:
+
+    /**
+     * Prepare to fit models up to order \c maxorder using windows of at most
+     * \c window samples.  When \c window is zero, samples will be retired
+     * only by explicitly invoking \ref pop.
+     */
+    explicit yule_walker_accumulator(const std::size_t maxorder,
+                                     const std::size_t window = 0)
+        : p(maxorder), W(window), x(), shift(0), sum(0),
+          lag(maxorder + 1, Value(0)), retired(0)
+    {}
+
+    /** Absorb sample \c v, retiring the oldest should the window be full. */
+    void push(const Value v)
+    {
+        if (W && x.size() == W) pop();
+        if (x.empty()) shift = v;
+        const Value y = v - shift;
+        x.push_back(y);
+        sum += y;
+        const std::size_t n = x.size();
+        for (std::size_t k = 0; k <= p && k < n; ++k)
+            lag[k] += y * x[n - 1 - k];
+    }
+
+    /** Absorb every sample within <tt>[first, last)</tt>. */
+    template <class InputIterator>
+    void push(InputIterator first, InputIterator last)
+    {
+        while (first != last) push(*first++);
+    }
+
+    /** Retire the oldest sample, if any. */
+    void pop()
+    {
+        if (x.empty()) return;
+        const Value y = x.front();
+        for (std::size_t k = 0; k <= p && k < x.size(); ++k)
+            lag[k] -= y * x[k];
+        sum -= y;
+        x.pop_front();
+        if (++retired >= x.size()) refresh();
+    }
+
+    /** Number of samples within the window. */
+    std::size_t size() const
+    {
+        return x.size();
+    }
+
+    /**
+     * Fit models to the current window per \ref levinson_durbin.
+     *
+     * @param[out]    mean          Mean of the window.
+     * @param[in,out] maxorder      On input, the maximum model order desired
+     *                              which is bounded by that given at
+     *                              construction.  On output, the maximum
+     *                              model order computed.
+     * @param[out]    params_first  Model parameters.
+     * @param[out]    sigma2e_first Mean squared discrepancies.
+     * @param[out]    gain_first    Model gains.
+     * @param[out]    autocor_first Autocorrelations for lags
+     *                              <tt>[0,maxorder]</tt>.
+     * @param[in]     subtract_mean Should \c mean be subtracted?
+     * @param[in]     hierarchy     Should the entire hierarchy of models
+     *                              be output?
+     *
+     * @returns the number of samples within the window.
+     */
+    template <class OutputIterator1,
+              class OutputIterator2,
+              class OutputIterator3,
+              class OutputIterator4>
+    std::size_t fit(Value&          mean,
+                    std::size_t&    maxorder,
+                    OutputIterator1 params_first,
+                    OutputIterator2 sigma2e_first,
+                    OutputIterator3 gain_first,
+                    OutputIterator4 autocor_first,
+                    const bool      subtract_mean,
+                    const bool      hierarchy = false) const
+    {
+        using std::min;
+        using std::size_t;
+
+        const size_t N = x.size();
+        maxorder = (N == 0) ? 0 : min(min(maxorder, p), N - 1);
+        const Value ybar = N ? sum / N : Value(0);
+        mean = shift + ybar;
+
+        // Correct each lag's products for the mean or for the shift using
+        // the sums of the first k and of the last k samples
+        std::vector<Value> gamma(maxorder + 1);
+        const Value c = subtract_mean ? ybar : -shift;
+        Value head = 0, tail = 0;
+        for (size_t k = 0; k <= maxorder; ++k)
+        {
+            if (k)
+            {
+                head += x[k - 1];
+                tail += x[N - k];
+            }
+            const Value both = (sum - head) + (sum - tail);
+            gamma[k] = (lag[k] - c*both + (N - k)*c*c) / (N ? N : 1);
+        }
+
+        levinson_durbin(maxorder, gamma.begin(), params_first,
+                        sigma2e_first, gain_first, autocor_first, hierarchy);
+        return N;
+    }
+
+private:
+
+    /** Recompute all sums from the retained samples. */
+    void refresh()
+    {
+        retired = 0;
+        sum = 0;
+        std::fill(lag.begin(), lag.end(), Value(0));
+        if (x.empty()) return;
+        Value s = 0;
+        for (std::size_t i = 0; i < x.size(); ++i) s += x[i];
+        s /= x.size();
+        for (std::size_t i = 0; i < x.size(); ++i) x[i] -= s;
+        shift += s;
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            sum += x[i];
+            for (std::size_t k = 0; k <= p && k <= i; ++k)
+                lag[k] += x[i] * x[i - k];
+        }
+    }
+
+    /** Maximum model order. */
+    std::size_t p;
+
+    /** Window size or zero when unbounded. */
+    std::size_t W;
+
+    /** Window samples less \c shift. */
+    std::deque<Value> x;
+
+    /** Shift applied to every sample. */
+    Value shift;
+
+    /** Sum of the shifted samples. */
+    Value sum;
+
+    /** Sums of lag \c k products of shifted samples. */
+    std::vector<Value> lag;
+
+    /** Samples retired since the last \ref refresh. */
+    std::size_t retired;
+};
+
+// Type erasure for NoiseGenerator parameters within predictor.
+// Either std::tr1::function or boost::function would better provide the
+// desired capability but both add additional, undesired dependencies.
+namespace
+{
+
+/** Abstract base class for NoiseGenerator-related type erasure. */
+template <typename Value>
+struct nullary
+{
+    virtual ~nullary() {}
+    virtual Value operator()() = 0;
+    virtual nullary* clone()   = 0;
+};
+
+/** A nullary function always returning zero. */
+template<typename Value>
+struct nullary_impl0 : public nullary<Value>
+{
+    Value operator()()
+    {
+        return 0;
+    }
+    nullary_impl0* clone()
+    {
+        return new nullary_impl0();
+    }
+};
+
+/** A nullary function always invoking t(). */
+template<typename Value, class T>
+struct nullary_impl1 : public nullary<Value>
+{
+    nullary_impl1(T t) : t(t) {}
+    Value operator()()
+    {
+        return t();
+    }
+    nullary_impl1* clone()
+    {
+        return new nullary_impl1(t);
+    }
+    T t;
+};
+
+}
+
+/**
+ * Simulate an autoregressive model process with an InputIterator interface.
+ */
+template <typename Value, typename Index = std::size_t>
+class predictor
+    : public std::iterator<std::input_iterator_tag, Value,
+      std::ptrdiff_t, const Value*, const Value&>
+{
+private:
+    typedef std::iterator<std::input_iterator_tag, Value,
+            std::ptrdiff_t, const Value*, const Value&> base;
+
+public:
+    typedef typename base::difference_type   difference_type;
+    typedef typename base::iterator_category iterator_category;
+    typedef typename base::pointer           pointer;
+    typedef typename base::reference         reference;
+    typedef typename base::value_type        value_type;
+
+    /** Singular instance marking prediction index \c n. */
+    explicit predictor(Index n = 0) : n(n), d(), g(0), xn()
+    {
+#ifndef NDEBUG
+        using std::numeric_limits;
+        if (numeric_limits<Value>::has_quiet_NaN)
+            xn = numeric_limits<Value>::quiet_NaN();
+#endif
+    }
+
+    /**
+     * Iterate on the process \f$x_n + a_1 x_{n - 1} + \dots + a_p x_{n - p} =
+     * 0\f$.  Presumably \ref initial_conditions will be used to specify some
+     * initial state as otherwise the process is identically zero.  The process
+     * order \f$p\f$ is set by <tt>std::distance(params_first,
+     * params_last)</tt>.
+     *
+     * @param params_first  Beginning of the process parameter range
+     *                      starting with \f$a_1\f$.
+     * @param params_last   End of the process parameter range.
+     */
+    template <class RandomAccessIterator>
+    predictor(RandomAccessIterator params_first,
+              RandomAccessIterator params_last)
+        : n(0),
+          d(2*std::distance(params_first, params_last), 0),
+          g(new nullary_impl0<Value>()),
+          xn((*g)())
+    {
+        // Finish preparing d = [ a_p, ..., a_1, 0, ..., 0 ]
+        using std::vector;
+        typename vector<Value>::size_type i = d.size() / 2;
+        while (i --> 0) d[i] = *params_first++;
+
+        // Now x_n = 0 because x_{n-p} = ... = x_{n-1} = 0 by construction.
+    }
+
+    /**
+     * Iterate on the process \f$x_n + a_1 x_{n - 1} + \dots + a_p x_{n - p} =
+     * \epsilon_n\f$ given zero initial conditions.  The process order \f$p\f$
+     * is set by <tt>std::distance(params_first,params_last)</tt>.  The class
+     * <tt>std::tr1::variate_generator</tt> may be helpful in constructing
+     * normally distributed input.
+     *
+     * @param params_first  Beginning of the process parameter range
+     *                      starting with \f$a_1\f$.
+     * @param params_last   End of the process parameter range.
+     * @param generator     A nullary callback for generating \f$\epsilon_n\f$.
+     *                      For example, a random number generator distributed
+     *                      like \f$N\left(0, \sigma^2_\epsilon\right)\f$.
+     */
+    template <class RandomAccessIterator,
+              class NoiseGenerator>
+    predictor(RandomAccessIterator params_first,
+              RandomAccessIterator params_last,
+              NoiseGenerator generator)
+        : n(0),
+          d(2*std::distance(params_first, params_last), 0),
+          g(new nullary_impl1<Value,NoiseGenerator>(generator)),
+          xn((*g)())
+    {
+        // Finish preparing d = [ a_p, ..., a_1, 0, ..., 0 ]
+        using std::vector;
+        typename vector<Value>::size_type i = d.size() / 2;
+        while (i --> 0) d[i] = *params_first++;
+
+        // Here x_0 = \epsilon_0 because x_{0-p} = ... = x_{0-1} = 0.
+    }
+
+    /** Copy constructor */
+    predictor(const predictor& other)
+        : n(other.n),
+          d(other.d),
+          g(other.g ? other.g->clone() : 0),
+          xn(other.xn)
+    {}
+
+    /** Assignment operator */
+    predictor& operator=(const predictor& other)
+    {
+        if (this != &other)
+        {
+            nullary<Value> *tmp = 0;
+            try
+            {
+                tmp = other.g ? other.g->clone() : 0;
+            }
+            catch (...)
+            {
+                delete tmp;
+                throw;
+            }
+            base::operator=(other);
+            n = other.n;
+            d = other.d;
+            delete g;
+            g = tmp;
+            xn = other.xn;
+        }
+        return *this;
+    }
+
+    /** Destructor */
+    ~predictor()
+    {
+        delete g;
+    }
+
+    /**
+     * Specify process initial conditions \f$x_{n-1}, \dots, x_{n-p}\f$ where
+     * \f$p\f$ is the process order fixed by the constructor.  The simulation
+     * index \f$n\f$ is reset to zero and, optionally, \f$x_0\f$ is additively
+     * adjusted by \c x0adjust.
+     *
+     * @param initial_first Beginning of the initial condition range
+     *                      \f$x_{n-1}, \dots, x_{n-p}\f$
+     *                      which must contain \f$p\f$ values.
+     * @param x0adjust      An additive adjustment made to \f$\epsilon_0\f$.
+     */
+    template <class InputIterator>
+    predictor& initial_conditions(InputIterator initial_first,
+                                  const Value x0adjust = 0)
+    {
+        // Zero the simulation time.
+        n = 0;
+
+        // Set d = [ a_p, ..., a_1, x_{n-p}, ..., x_{n-1} ]
+        using std::vector;
+        typename vector<Value>::size_type i = d.size();
+        typename vector<Value>::size_type p = i / 2;
+        while (i --> p) d[i] = *initial_first++;
+
+        // Make x_n := - a_p*x_{n-p} - ... - a_1*x_{n-1} + x_n + x0adjust.
+        // By design, x_n was whatever it happened to be.
+        using std::inner_product;
+        xn += x0adjust;
+        xn  = -inner_product(d.begin(), d.begin() + p, d.begin() + p, -xn);
+
+        return *this;
+    }
+
+    // Concept: InputIterator
+
+    /** Prefix increment. */
+    predictor& operator++()
+    {
+        using std::distance;
+        using std::inner_product;
+        using std::vector;
+
+        if (g)
+        {
+            typename vector<Value>::size_type p = d.size() / 2;
+            if (p)
+            {
+                // Make x_n = - a_p*x_{n-p} - ... - a_1*x_{n-1} + \epsilon_n
+                // by (conceptually) storing previously computed x_n into
+                // circular buffer, updating ++n, and computing x_{n+1}.
+                typename vector<Value>::iterator ab = d.begin();
+                typename vector<Value>::iterator xb = ab + p;
+                typename vector<Value>::iterator c  = xb + n % p;
+                typename vector<Value>::iterator xe = d.end();
+                *c++ =  xn;
+                xn   =  inner_product(c,  xe, ab,                   -(*g)());
+                xn   = -inner_product(xb,  c, ab + distance(c, xe),   xn   );
+            }
+            else
+            {
+                xn = (*g)();
+            }
+        }
+        else
+        {
+#ifndef NDEBUG
+            using std::numeric_limits;
+            if (numeric_limits<Value>::has_quiet_NaN)
+                xn = numeric_limits<Value>::quiet_NaN();
+#endif
+        }
+
+        ++n;
+
+        return *this;
+    }
+
+    /** Postfix increment. */
+    predictor operator++(int) // Postfix increment
+    {
+        predictor t(*this);
+        ++*this;
+        return t;
+    }
+
+    /** Obtain the process prediction \f$x_n\f$. */
+    reference operator* () const
+    {
+        return xn;
+    }
+
+    // Concept: EqualityComparable
+
+    /** Check if two iterators represent the same simulation time. */
+    bool operator== (const predictor& other) const
+    {
+        return n == other.n;
+    }
+
+    /** Check if two iterators represent different simulation times. */
+    bool operator!= (const predictor& other) const
+    {
+        return !(*this == other);
+    }
+
+    /** Obtain the autoregressive process order \f$p\f$. */
+    std::size_t order() const
+    {
+        return d.size() / 2;
+    }
+
+private:
+
+    /** Running prediction index. */
+    Index n;
+
+    /**
+     * State vector keeping \f$\tilde{a}\f$ in <tt>[d, d+p)</tt> and
+     * \f$x_{n-p},\dots,x_{n-2},x_{n-1}\f$ in <tt>[d+p,d+p+p)/<tt> in circular
+     * buffer fashion where <tt>p = d.size()/2</tt> is the autoregressive
+     * process order.  The current location in circular buffer is maintained
+     * using <tt>d + p + n % p</tt>.
+     */
+    typename std::vector<Value> d;
+
+    /**
+     * Noise generator used at every step.
+     * An instance is singular whenever <tt>!g</tt>.
+     */
+    nullary<Value> *g;
+
+    /**
+     * Prediction at current index \c n.  Computed on advance to permit
+     * repeated inexpensive dereferencing and <tt>*i++</tt> usage.
+     */
+    Value xn;
+};
+
+/** A NoiseGenerator for \ref basic_predictor always returning zero. */
+template <typename Value>
+struct zero_noise
+{
+    Value operator()() const
+    {
+        return 0;
+    }
+};
+
+// Storage for basic_predictor parameters and a linear history buffer
+// sized at compile time whenever the process order is known.
+namespace
+{
+
+/**
+ * Fixed storage for process order \c Order maintaining \f$a_p, \dots,
+ * a_1\f$ and a linear history buffer holding several blocks of samples.
+ */
+template <typename Value, std::size_t Order>
+struct predictor_storage
+{
+    enum { capacity = 8*Order + 64 };
+
+    // Callers ensure p == Order
+    predictor_storage(std::size_t)
+    {
+        std::fill(a, a + Order,    Value(0));
+        std::fill(h, h + capacity, Value(0));
+    }
+
+    void reset(std::size_t)
+    {
+        std::fill(a, a + Order,    Value(0));
+        std::fill(h, h + capacity, Value(0));
+    }
+
+    static std::size_t order() { return Order; }
+    std::size_t size() const   { return capacity; }
+
+    Value a[Order ? Order : 1];
+    Value h[capacity];
+};
+
+/** Runtime storage for process order \c p allocated once upon construction. */
+template <typename Value>
+struct predictor_storage<Value, 0>
+{
+    predictor_storage(std::size_t p)
+        : p(p), a(p, Value(0)), h(8*p + 64, Value(0))
+    {}
+
+    /** Storage is reallocated only when \c p exceeds every prior order. */
+    void reset(std::size_t p)
+    {
+        this->p = p;
+        a.assign(p,        Value(0));
+        h.assign(8*p + 64, Value(0));
+    }
+
+    std::size_t order() const { return p; }
+    std::size_t size()  const { return h.size(); }
+
+    std::size_t        p;
+    std::vector<Value> a;
+    std::vector<Value> h;
+};
+
+}
+
+/**
+ * Simulate an autoregressive model process with an InputIterator interface
+ * much like \ref predictor but without type erasure or per-step overhead.
+ * Innovations are drawn by invoking a \c NoiseGenerator instance directly,
+ * rather than through a virtual call, and the process history resides in a
+ * linear buffer so that no modulo arithmetic is required.  When \c Order is
+ * nonzero the process order is fixed at compile time and no storage is
+ * allocated.  Otherwise the order is set at construction.  Results are
+ * identical to those of \ref predictor given the same noise.  Use \ref
+ * generate to produce many samples at once.
+ */
+template <typename Value,
+          class NoiseGenerator = zero_noise<Value>,
+          std::size_t Order    = 0,
+          typename Index       = std::size_t>
+class basic_predictor
+    : public std::iterator<std::input_iterator_tag, Value,
+      std::ptrdiff_t, const Value*, const Value&>
+{
+private:
+    typedef std::iterator<std::input_iterator_tag, Value,
+            std::ptrdiff_t, const Value*, const Value&> base;
+
+public:
+    typedef typename base::difference_type   difference_type;
+    typedef typename base::iterator_category iterator_category;
+    typedef typename base::pointer           pointer;
+    typedef typename base::reference         reference;
+    typedef typename base::value_type        value_type;
+
+    /** Singular instance marking prediction index \c n. */
+    explicit basic_predictor(Index n = 0)
+        : n(n), s(Order), w(Order), g(), xn()
+    {}
+
+    /**
+     * Iterate on the process \f$x_n + a_1 x_{n - 1} + \dots + a_p x_{n - p} =
+     * \epsilon_n\f$ given zero initial conditions.  The process order \f$p\f$
+     * is <tt>std::distance(params_first, params_last)</tt> which must equal
+     * \c Order when that is nonzero.
+     *
+     * @param params_first  Beginning of the process parameter range
+     *                      starting with \f$a_1\f$.
+     * @param params_last   End of the process parameter range.
+     * @param generator     A nullary callback for generating \f$\epsilon_n\f$.
+     *
+     * @throws std::invalid_argument if \c Order is nonzero and differs
+     *         from the process order.
+     */
+    template <class RandomAccessIterator>
+    basic_predictor(RandomAccessIterator params_first,
+                    RandomAccessIterator params_last,
+                    NoiseGenerator generator = NoiseGenerator())
+        : n(0),
+          s(std::distance(params_first, params_last)),
+          w(s.order()),
+          g(generator),
+          xn(g())
+    {
+        AR_ENSURE_ARG(!Order || std::size_t(
+                std::distance(params_first, params_last)) == Order);
+
+        // Prepare a = [ a_p, ..., a_1 ] with zero history by construction
+        std::size_t i = s.order();
+        while (i --> 0) s.a[i] = *params_first++;
+    }
+
+    /**
+     * Restart the process with new parameters and zero initial conditions
+     * exactly as if freshly constructed from them, retaining the noise
+     * generator.  Storage is reused so that repeatedly assigning processes
+     * of no greater order performs no allocation.
+     *
+     * @param params_first  Beginning of the process parameter range
+     *                      starting with \f$a_1\f$.
+     * @param params_last   End of the process parameter range.
+     *
+     * @throws std::invalid_argument if \c Order is nonzero and differs
+     *         from the process order.
+     */
+    template <class RandomAccessIterator>
+    basic_predictor& assign(RandomAccessIterator params_first,
+                            RandomAccessIterator params_last)
+    {
+        AR_ENSURE_ARG(!Order || std::size_t(
+                std::distance(params_first, params_last)) == Order);
+
+        s.reset(std::distance(params_first, params_last));
+        n  = 0;
+        w  = s.order();
+        xn = g();
+        std::size_t i = s.order();
+        while (i --> 0) s.a[i] = *params_first++;
+
+        return *this;
+    }
+
+    /**
+     * Specify process initial conditions \f$x_{n-1}, \dots, x_{n-p}\f$ per
+     * \ref predictor::initial_conditions.
+     *
+     * @param initial_first Beginning of the initial condition range
+     *                      \f$x_{n-1}, \dots, x_{n-p}\f$
+     *                      which must contain \f$p\f$ values.
+     * @param x0adjust      An additive adjustment made to \f$\epsilon_0\f$.
+     */
+    template <class InputIterator>
+    basic_predictor& initial_conditions(InputIterator initial_first,
+                                        const Value x0adjust = 0)
+    {
+        const std::size_t p = s.order();
+        n = 0;
+        w = p;
+        for (std::size_t i = p; i --> 0;) s.h[i] = *initial_first++;
+
+        xn += x0adjust;
+        xn  = next(-xn, w);
+
+        return *this;
+    }
+
+    /** Obtain the autoregressive process order \f$p\f$. */
+    std::size_t order() const
+    {
+        return s.order();
+    }
+
+    /**
+     * Output the current and subsequent predictions, advancing the process
+     * \c count times.  Equivalent to <tt>*out++ = *p++</tt> repeated
+     * \c count times but considerably faster.
+     *
+     * @param out   Beginning of the output range.
+     * @param count Number of predictions to output.
+     *
+     * @return The end of the output range.
+     */
+    template <class OutputIterator>
+    OutputIterator generate(OutputIterator out, std::size_t count)
+    {
+        // Locals avoid state reloads after every store into the history
+        Value x = xn;
+        std::size_t v = w;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            *out++ = x;
+            x = step(x, v);
+        }
+        xn = x;
+        w  = v;
+        n += count;
+        return out;
+    }
+
+    // Concept: InputIterator
+
+    /** Prefix increment. */
+    basic_predictor& operator++()
+    {
+        advance();
+        return *this;
+    }
+
+    /** Postfix increment. */
+    basic_predictor operator++(int)
+    {
+        basic_predictor t(*this);
+        ++*this;
+        return t;
+    }
+
+    /** Obtain the process prediction \f$x_n\f$. */
+    reference operator* () const
+    {
+        return xn;
+    }
+
+    // Concept: EqualityComparable
+
+    /** Check if two iterators represent the same simulation time. */
+    bool operator== (const basic_predictor& other) const
+    {
+        return n == other.n;
+    }
+
+    /** Check if two iterators represent different simulation times. */
+    bool operator!= (const basic_predictor& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+
+    /**
+     * Compute <tt>-(acc + a_p*x_{n-p} + ... + a_1*x_{n-1})</tt> in the
+     * operation order used by \ref predictor given history ending at \c v.
+     */
+    Value next(Value acc, const std::size_t v) const
+    {
+        const std::size_t p = s.order();
+        const Value * const a = &s.a[0];
+        const Value * const x = &s.h[v - p];
+        for (std::size_t j = 0; j < p; ++j) acc += a[j] * x[j];
+        return -acc;
+    }
+
+    /** Record \f$x_n\f$ at history end \c v and compute \f$x_{n+1}\f$. */
+    Value step(const Value x, std::size_t& v)
+    {
+        const std::size_t p = s.order();
+        if (!p) return g();
+        if (v == s.size())
+        {
+            // Slide the most recent p samples to the buffer's front
+            std::copy(&s.h[v - p], &s.h[0] + v, &s.h[0]);
+            v = p;
+        }
+        s.h[v++] = x;
+        return next(-g(), v);
+    }
+
+    /** Advance \c n computing the next prediction. */
+    void advance()
+    {
+        xn = step(xn, w);
+        ++n;
+    }
+
+    /** Running prediction index. */
+    Index n;
+
+    /** Parameters \f$a_p,\dots,a_1\f$ and history \f$\dots,x_{n-1}\f$. */
+    predictor_storage<Value, Order> s;
+
+    /** History <tt>s.h[w-p,w)</tt> holds \f$x_{n-p},\dots,x_{n-1}\f$. */
+    std::size_t w;
+
+    /** Noise generator used at every step. */
+    NoiseGenerator g;
+
+    /** Prediction at current index \c n. */
+    Value xn;
+};
+
+/**
+ * Construct an iterator over the autocorrelation function \f$\rho_k\f$ given
+ * process parameters and initial conditions.
+ *
+ * @param params_first  Beginning of range containing \f$a_1,\dots,a_p\f$.
+ * @param params_last   Exclusive ending of the parameter range.
+ * @param gain          The model gain \f$\sigma^2_x / \sigma^2_\epsilon\f$.
+ * @param autocor_first Beginning of range containing \f$\rho_0,...\rho_p\f$.
+ *
+ * @return An InputIterator across the autocorrelation function starting with
+ *         \f$\rho_0\f$.
+ */
+template <class RandomAccessIterator,
+          class InputIterator,
+          class Value>
+predictor<typename std::iterator_traits<RandomAccessIterator>::value_type>
+autocorrelation(RandomAccessIterator params_first,
+                RandomAccessIterator params_last,
+                Value                gain,
+                InputIterator        autocor_first)
+{
+    predictor<typename std::iterator_traits<
+            RandomAccessIterator
+        >::value_type> p(params_first, params_last);
+    p.initial_conditions(++autocor_first, 1 / gain);
+    return p;
+}
+
+/**
+ * Construct an iterator over the autocorrelation function \f$\rho_k\f$ for
+ * a process whose order \c Order is fixed at compile time, for example one
+ * fit by \ref burg_method_fixed.  The sequence is identical to that from
+ * \ref autocorrelation but is produced by a \ref basic_predictor requiring no
+ * heap storage or per-step virtual dispatch.
+ *
+ * @param params_first  Beginning of range containing \f$a_1,\dots,a_p\f$
+ *                      where \f$p\f$ is \c Order.
+ * @param gain          The model gain \f$\sigma^2_x / \sigma^2_\epsilon\f$.
+ * @param autocor_first Beginning of range containing \f$\rho_0,...\rho_p\f$.
+ *
+ * @return An InputIterator across the autocorrelation function starting with
+ *         \f$\rho_0\f$.
+ */
+template <std::size_t Order,
+          class RandomAccessIterator,
+          class InputIterator,
+          class Value>
+basic_predictor<
+    typename std::iterator_traits<RandomAccessIterator>::value_type,
+    zero_noise<typename std::iterator_traits<RandomAccessIterator>::value_type>,
+    Order>
+autocorrelation(RandomAccessIterator params_first,
+                Value                gain,
+                InputIterator        autocor_first)
+{
+    typedef typename std::iterator_traits<
+            RandomAccessIterator
+        >::value_type value_type;
+    basic_predictor<value_type, zero_noise<value_type>, Order> p(
+            params_first, params_first + Order);
+    p.initial_conditions(++autocor_first, 1 / gain);
+    return p;
+}
+
+// Helpers for forecast_batch processing a block of adjacent series at once.
+// Inner loops run across series so that the compiler may vectorize them
+// while every horizon is computed from the one before.
+namespace
+{
+
+/** Number of adjacent series processed together by \ref forecast_batch. */
+enum { forecast_block = 64 };
+
+/**
+ * Forecast series <tt>[i0, i0 + B)</tt> per \ref forecast_batch.  Terms are
+ * accumulated from \f$a_p\f$ down to \f$a_1\f$ in the order used by \ref
+ * predictor so that, absent a mean, forecasts are bit-for-bit identical.
+ * The block width \c B is fixed at compile time to permit vectorization.
+ */
+template <std::size_t B, typename Value>
+void forecast_batch_block(const std::size_t   i0,
+                          const std::size_t   M,
+                          const std::size_t   p,
+                          const std::size_t   H,
+                          const Value*        params,
+                          const Value* const* lags,
+                          const Value*        mu,
+                          Value*              forecasts,
+                          const Value*        sigma2e,
+                          Value*              variances)
+{
+    Value m[B], acc[B];
+    for (std::size_t j = 0; j < B; ++j) m[j] = mu ? mu[i0 + j] : Value(0);
+
+    // The forecast of x_{n+h} uses x_{n+h-1-k} weighted by a_{k+1}
+    for (std::size_t h = 0; h < H; ++h)
+    {
+        for (std::size_t j = 0; j < B; ++j) acc[j] = 0;
+        for (std::size_t k = p; k --> 0;)
+        {
+            const Value* a = params + k*M + i0;
+            const Value* x = (h > k ? forecasts + (h - 1 - k)*M
+                                    : lags[k - h]) + i0;
+            for (std::size_t j = 0; j < B; ++j) acc[j] += a[j]*(x[j] - m[j]);
+        }
+        Value* out = forecasts + h*M + i0;
+        for (std::size_t j = 0; j < B; ++j) out[j] = m[j] - acc[j];
+    }
+
+    if (!variances) return;
+
+    // Store impulse responses psi_0 = 1, psi_h = -sum a_{k+1} psi_{h-1-k}
+    std::fill(variances + i0, variances + i0 + B, Value(1));
+    for (std::size_t h = 1; h < H; ++h)
+    {
+        for (std::size_t j = 0; j < B; ++j) acc[j] = 0;
+        for (std::size_t k = std::min(p, h); k --> 0;)
+        {
+            const Value* a   = params + k*M + i0;
+            const Value* psi = variances + (h - 1 - k)*M + i0;
+            for (std::size_t j = 0; j < B; ++j) acc[j] += a[j]*psi[j];
+        }
+        Value* out = variances + h*M + i0;
+        for (std::size_t j = 0; j < B; ++j) out[j] = -acc[j];
+    }
+
+    // Then overwrite them by sigma2e times their running sum of squares
+    for (std::size_t j = 0; j < B; ++j)
+    {
+        m[j]   = sigma2e[i0 + j];
+        acc[j] = 0;
+    }
+    for (std::size_t h = 0; h < H; ++h)
+    {
+        Value* out = variances + h*M + i0;
+        for (std::size_t j = 0; j < B; ++j)
+        {
+            acc[j] += out[j]*out[j];
+            out[j]  = m[j]*acc[j];
+        }
+    }
+}
+
+}
+
+/**
+ * Forecast many autoregressive processes \f$h = 1, \dots, H\f$ steps ahead
+ * at once.  Given the most recent observations \f$x_{n-1}, \dots,
+ * x_{n-p}\f$ of each of \c M series, the minimum mean squared error
+ * forecasts \f$\hat{x}_{n}, \dots, \hat{x}_{n+H-1}\f$ of the process
+ * \f$(x_n - \mu) + a_1 (x_{n-1} - \mu) + \dots + a_p (x_{n-p} - \mu) =
+ * \epsilon_n\f$ are computed by iterating the process with zero innovations.
+ * Optionally, the forecast error variances \f$\sigma^2_\epsilon
+ * \sum_{j=0}^{h-1} \psi_j^2\f$ are computed from the impulse response
+ * \f$\psi_j\f$ of each process, which approach \f$\sigma^2_x\f$ as \f$h\f$
+ * grows.
+ *
+ * All storage is structure-of-arrays, that is, element \c i of every row
+ * below belongs to series \c i.  Series of lesser order are zero-padded to
+ * a common order \c p.  Lags are given by row pointers so that a circular
+ * buffer of observations may be used without copying.  Series are processed
+ * in blocks, each distributed across OpenMP threads, and no storage is
+ * allocated.  Absent \c mu each forecast is bit-for-bit identical to that
+ * of a \ref predictor with the same initial conditions.
+ *
+ * @param[in]  M         Number of series.
+ * @param[in]  p         Common model order.
+ * @param[in]  H         Number of horizons.
+ * @param[in]  params    Row-major \c p by \c M matrix whose row \c k holds
+ *                       \f$a_{k+1}\f$ for every series.
+ * @param[in]  lags      Array of \c p pointers where <tt>lags[k]</tt>
+ *                       addresses \f$x_{n-1-k}\f$ for every series.
+ * @param[in]  mu        Process means for every series or \c NULL when all
+ *                       are zero.
+ * @param[out] forecasts Row-major \c H by \c M matrix whose row \c h
+ *                       receives \f$\hat{x}_{n+h}\f$ for every series.
+ * @param[in]  sigma2e   Innovation variances for every series.  Required
+ *                       only when \c variances is not \c NULL.
+ * @param[out] variances Row-major \c H by \c M matrix receiving forecast
+ *                       error variances for every series or \c NULL when
+ *                       none are desired.
+ * @param[in]  nthreads  Number of threads or zero for the OpenMP default.
+ */
+template <typename Value>
+void forecast_batch(const std::size_t   M,
+                    const std::size_t   p,
+                    const std::size_t   H,
+                    const Value*        params,
+                    const Value* const* lags,
+                    const Value*        mu,
+                    Value*              forecasts,
+                    const Value*        sigma2e   = NULL,
+                    Value*              variances = NULL,
+                    const int           nthreads  = 0)
+{
+    using std::ptrdiff_t;
+
+    AR_ENSURE_ARG(!M || !variances || sigma2e);
+    const ptrdiff_t blocks = M / forecast_block;
+
+#ifdef _OPENMP
+    const int T = nthreads > 0 ? nthreads : omp_get_max_threads();
+#pragma omp parallel for schedule(static) num_threads(T) if (blocks > 1)
+#else
+    (void) nthreads;
+#endif
+    for (ptrdiff_t c = 0; c < blocks; ++c)
+    {
+        forecast_batch_block<forecast_block>(
+                c * forecast_block, M, p, H, params, lags, mu, forecasts,
+                sigma2e, variances);
+    }
+
+    // Any remaining series are processed individually
+    for (std::size_t i = blocks * forecast_block; i < M; ++i)
+    {
+        forecast_batch_block<1>(i, M, p, H, params, lags, mu, forecasts,
+                                sigma2e, variances);
+    }
+}
+
+/**
+ * Maintain many autoregressive models and their most recent observations
+ * in the structure-of-arrays layout used by \ref forecast_batch.  Storage
+ * is allocated once upon construction.  Thereafter \ref observe records one
+ * new sample of every series in a circular buffer and \ref forecast
+ * predicts every series without further allocation.
+ */
+template <typename Value>
+class batch_forecaster
+{
+public:
+
+    /** The working precision. */
+    typedef Value value_type;
+
+    /**
+     * Prepare \c M series of order at most \c p with zero parameters,
+     * means, innovation variances, and observations.
+     */
+    batch_forecaster(const std::size_t M, const std::size_t p)
+        : M(M), p(p), head(0),
+          a(p*M, Value(0)), mu(M, Value(0)), sigma2e(M, Value(0)),
+          x(p*M, Value(0)), lags(p)
+    {}
+
+    /** Obtain the number of series. */
+    std::size_t size() const
+    {
+        return M;
+    }
+
+    /** Obtain the common model order. */
+    std::size_t order() const
+    {
+        return p;
+    }
+
+    /**
+     * Set the model for series \c i, for example from an \ref arsel_result.
+     *
+     * @param i            Series index.
+     * @param params_first Beginning of range containing \f$a_1,\dots,a_q\f$.
+     * @param params_last  Exclusive ending of the parameter range.
+     * @param mean         Process mean \f$\mu\f$.
+     * @param variance     Innovation variance \f$\sigma^2_\epsilon\f$.
+     *
+     * @throws std::invalid_argument if \f$q > p\f$ or \f$i \geq M\f$.
+     */
+    template <class InputIterator>
+    batch_forecaster& model(const std::size_t i,
+                            InputIterator     params_first,
+                            InputIterator     params_last,
+                            const Value       mean,
+                            const Value       variance)
+    {
+        AR_ENSURE_ARG(i < M);
+        std::size_t k = 0;
+        for (; params_first != params_last; ++params_first, ++k)
+        {
+            AR_ENSURE_ARG(k < p);
+            a[k*M + i] = *params_first;
+        }
+        for (; k < p; ++k) a[k*M + i] = 0;
+        mu[i]      = mean;
+        sigma2e[i] = variance;
+        return *this;
+    }
+
+    /**
+     * Record the newest observation of every series from the \c M values
+     * beginning at \c first, discarding the oldest.
+     */
+    template <class InputIterator>
+    batch_forecaster& observe(InputIterator first)
+    {
+        if (!p) return *this;
+        head = (head + p - 1) % p;
+        for (std::size_t i = 0; i < M; ++i, ++first) x[head*M + i] = *first;
+        return *this;
+    }
+
+    /**
+     * Forecast every series \c H steps ahead per \ref forecast_batch from
+     * the \c p most recent observations.  Observations not yet recorded
+     * are taken to be zero.
+     *
+     * @param[in]  H         Number of horizons.
+     * @param[out] forecasts Row-major \c H by \c M matrix of forecasts.
+     * @param[out] variances Row-major \c H by \c M matrix of forecast error
+     *                       variances or \c NULL when none are desired.
+     * @param[in]  nthreads  Number of threads or zero for the OpenMP
+     *                       default.
+     */
+    void forecast(const std::size_t H,
+                  Value*            forecasts,
+                  Value*            variances = NULL,
+                  const int         nthreads  = 0)
+    {
+        for (std::size_t k = 0; k < p; ++k)
+            lags[k] = &x[((head + k) % p)*M];
+        forecast_batch(M, p, H, p ? &a[0] : NULL, p ? &lags[0] : NULL,
+                       M ? &mu[0] : NULL, forecasts,
+                       M ? &sigma2e[0] : NULL, variances, nthreads);
+    }
+
+private:
+
+    /** Number of series and common model order. */
+    std::size_t M, p;
+
+    /** Row of \c x holding the newest observation of every series. */
+    std::size_t head;
+
+    /** Parameters, means, and innovation variances per \ref forecast_batch. */
+    std::vector<Value> a, mu, sigma2e;
+
+    /** Circular buffer of \c p rows each holding one sample of every series. */
+    std::vector<Value> x;
+
+    /** Row pointers into \c x ordered from newest to oldest. */
+    std::vector<const Value*> lags;
+};
+
+// Helper for decorrelation_time truncating sums over geometrically decaying
+// autocorrelation functions.
+namespace
+{
+
+/**
+ * Given the estimated \f$\sum\left|\rho_i\right|\f$ mass \c block of the
+ * most recent block of lags and its per-block decay \c q, is the remainder
+ * of the decorrelation time sum negligible relative to \c T0?  The tail is
+ * estimated assuming the decay continues geometrically and bounded using the
+ * maximum summand weight 2.
+ */
+template <class Value>
+bool decorrelation_decay_negligible(const Value block,
+                                    const Value q,
+                                    const Value T0,
+                                    const Value tolerance)
+{
+    using std::abs;
+
+    if (!(q < 1)) return false;  // Also catches NaN
+
+    return 2 * block * q / (1 - q) <= tolerance * abs(T0);
+}
+
+/**
+ * Given the \f$\sum\left|\rho_i\right|\f$ mass \c block of the most recent
+ * \f$p\f$ lags and the mass \c prior of the \f$p\f$ lags preceding them,
+ * is the remainder of the decorrelation time sum negligible relative to
+ * \c T0?  Because the last \f$p\f$ lags fix all subsequent lags, a zero
+ * \c block implies an exactly zero tail.  Otherwise the per-block decay
+ * <tt>block/prior</tt> is assumed to continue geometrically.
+ */
+template <class Value>
+bool decorrelation_tail_negligible(const Value block,
+                                   const Value prior,
+                                   const Value T0,
+                                   const Value tolerance)
+{
+    if (block == 0) return true;
+
+    return decorrelation_decay_negligible(block, block / prior, T0, tolerance);
+}
+
+/**
+ * Compute \ref decorrelation_time advancing \c rho in place so that callers
+ * holding a reusable \ref basic_predictor avoid copying its storage.
+ * The number of lags summed before truncation is stored into \c lags.
+ */
+template <class Predictor>
+typename Predictor::value_type
+decorrelation_time_inplace(const std::size_t N,
+                           Predictor& rho,
+                           const bool abs_rho,
+                           const typename Predictor::value_type tolerance,
+                           std::size_t& lags)
+{
+    using std::abs;
+    using std::max;
+    using std::size_t;
+    typedef typename Predictor::value_type Value;
+
+    Value T0 = *rho++;
+
+    const Value twoinvN = Value(2) / N;
+    const size_t p = max(rho.order(), size_t(1));
+    Value block = 0, prior = 0;
+    size_t i = 1;
+    for (; i <= N; ++i, ++rho)
+    {
+        const Value r = abs(*rho);
+        T0    += (2 - i*twoinvN) * (abs_rho ? r : *rho);
+        block += r;
+        if (i % p == 0)
+        {
+            if (decorrelation_tail_negligible(block, prior, T0, tolerance))
+                break;
+            prior = block;
+            block = 0;
+        }
+    }
+    lags = i > N ? N : i;
+
+    return T0;
+}
+
+template <class Predictor>
+typename Predictor::value_type
+decorrelation_time_inplace(const std::size_t N,
+                           Predictor& rho,
+                           const bool abs_rho,
+                           const typename Predictor::value_type tolerance)
+{
+    std::size_t lags;
+    return decorrelation_time_inplace(N, rho, abs_rho, tolerance, lags);
+}
+
+}
+
+/**
+ * Compute the decorrelation time for variance of the mean given
+ * autocorrelation details.  That is, compute
+ * \f{align}{
+ *     T_0 &= 1 + 2 \sum_{i=1}^{N} \left(1 - \frac{i}{N}\right) \rho_i
+ * \f}
+ * following Trenberth, K. E. "Some effects of finite sample size and
+ * persistence on meteorological statistics. Part I: Autocorrelations." Monthly
+ * Weather Review 112 (1984).
+ * http://dx.doi.org/10.1175/1520-0493(1984)112%3C2359:SEOFSS%3E2.0.CO;2
+ *
+ * Rather than \f$\rho\f$, \f$\left|\rho\right|\f$ may be used in the
+ * definition of \f$T_0\f$ to better approximate the "decay of the correlation
+ * envelope" according to section 17.1.5 of Hans von Storch and Francis W.
+ * Zwiers.  Statistical analysis in climate research. Cambridge University
+ * Press, March 2001. ISBN 978-0521012300.  Doing so is more robust for
+ * oscillatory processes and always provides a larger, more conservative
+ * estimate of \f$T_0\f$.
+ *
+ * Summing all \f$N\f$ lags costs \f$O(Np)\f$ which may exceed the cost of
+ * fitting the model.  As the autocorrelation of a stationary process decays
+ * geometrically, the sum may be truncated once the remaining terms are
+ * estimated to contribute less than <tt>tolerance*abs(T0)</tt>.  The
+ * estimate examines the decay of \f$\sum\left|\rho_i\right|\f$ across
+ * successive blocks of \f$p\f$ lags.  The default zero tolerance stops only
+ * once the autocorrelation becomes identically zero.
+ *
+ * @param N         Maximum lag used to compute the autocorrelation.
+ * @param rho       A \ref predictor or \ref basic_predictor iterating over
+ *                  the \ref autocorrelation.
+ * @param abs_rho   Use \f$\left|\rho\right|\f$ when calculating \f$T_0\f$?
+ * @param tolerance Permitted relative error from truncating the sum.
+ *
+ * @return The decorrelation time \f$T_0\f$ assuming \f$\Delta{}t=1\f$.
+ */
+template <class Predictor>
+typename Predictor::value_type
+decorrelation_time(const std::size_t N,
+                   Predictor rho,
+                   const bool abs_rho = false,
+                   const typename Predictor::value_type tolerance = 0)
+{
+    return decorrelation_time_inplace(N, rho, abs_rho, tolerance);
+}
+
+/**
+ * Compute the decorrelation time for a covariance given autocorrelation
+ * details from two processes.  That is, compute
+ * \f{align}{
+ *     T_0 &= 1 + 2 \sum_{i=1}^{N} \left(1 - \frac{i}{N}\right)
+ *                                 \rho_{1,i} \rho_{2,i}
+ * \f}
+ * following Trenberth, K. E. "Some effects of finite sample size and
+ * persistence on meteorological statistics. Part I: Autocorrelations." Monthly
+ * Weather Review 112 (1984).
+ * http://dx.doi.org/10.1175/1520-0493(1984)112%3C2359:SEOFSS%3E2.0.CO;2
+ *
+ * Rather than \f$\rho\f$, \f$\left|\rho\right|\f$ may be used in the
+ * definition of \f$T_0\f$ to better approximate the "decay of the correlation
+ * envelope" according to section 17.1.5 of Hans von Storch and Francis W.
+ * Zwiers.  Statistical analysis in climate research. Cambridge University
+ * Press, March 2001. ISBN 978-0521012300.  Doing so is more robust for
+ * oscillatory processes and always provides a larger, more conservative
+ * estimate of \f$T_0\f$.
+ *
+ * The sum may be truncated subject to \c tolerance much as in the single
+ * process case using blocks spanning the larger process order.  The decay
+ * of each process is tracked separately and the tail is estimated from the
+ * product of the two.  The default zero tolerance stops only once either
+ * autocorrelation becomes identically zero.
+ *
+ * @param N         Maximum lag used to compute the autocorrelation.
+ * @param rho1      A \ref predictor iterating over the \ref autocorrelation
+ *                  for the first process.
+ * @param rho2      A \ref predictor iterating over the \ref autocorrelation
+ *                  for the second process.
+ * @param abs_rho   Use \f$\left|\rho\right|\f$ when calculating \f$T_0\f$?
+ * @param tolerance Permitted relative error from truncating the sum.
+ *
+ * @return The decorrelation time \f$T_0\f$ assuming \f$\Delta{}t=1\f$.
+ */
+template <class Predictor>
+typename Predictor::value_type
+decorrelation_time(const std::size_t N,
+                   Predictor rho1,
+                   Predictor rho2,
+                   const bool abs_rho = false,
+                   const typename Predictor::value_type tolerance = 0)
+{
+    using std::abs;
+    using std::max;
+    using std::size_t;
+    typedef typename Predictor::value_type Value;
+
+    Value T0 = 1;
+    ++rho1;
+    ++rho2;
+
+    const Value twoinvN = Value(2) / N;
+    const size_t p = max(max(rho1.order(), rho2.order()), size_t(1));
+    Value block1 = 0, prior1 = 0, block2 = 0, prior2 = 0;
+    for (size_t i = 1; i <= N; ++i, ++rho1, ++rho2)
+    {
+        const Value r = (*rho1) * (*rho2);
+        T0     += (2 - i*twoinvN) * (abs_rho ? abs(r) : r);
+        block1 += abs(*rho1);
+        block2 += abs(*rho2);
+        if (i % p == 0)
+        {
+            // A block spans at least either order so either process being
+            // zero throughout implies an exactly zero tail.  Otherwise the
+            // products' mass is bounded by block1*block2 and decays by the
+            // product of the two processes' decays.
+            if (block1 == 0 || block2 == 0) break;
+            if (decorrelation_decay_negligible(
+                        block1*block2, (block1/prior1)*(block2/prior2),
+                        T0, tolerance))
+                break;
+            prior1 = block1;
+            prior2 = block2;
+            block1 = block2 = 0;
+        }
+    }
+
+    return T0;
+}
+
+/**
+ * Compute the gain \f$\sigma^2_x / \sigma^2_\epsilon\f$ and autocorrelation
+ * \f$\rho_0, \dots, \rho_p\f$ of the stationary process \f$x_n + a_1 x_{n
+ * - 1} + \dots + a_p x_{n - p} = \epsilon_n\f$ given only its parameters.
+ * The reflection coefficients are recovered by the step-down recursion and
+ * then both quantities are recomputed exactly as \ref burg_recursion would.
+ * This permits, for example, \ref synthesize to be driven using known rather
+ * than estimated parameters.
+ *
+ * @param[in]  params_first  Beginning of range containing \f$a_1,\dots,a_p\f$.
+ * @param[in]  params_last   Exclusive ending of the parameter range.
+ * @param[out] gain          The model gain.
+ * @param[out] autocor_first Destination for \f$\rho_0, \dots, \rho_p\f$.
+ *
+ * @throws std::invalid_argument if the process is not stationary.
+ */
+template <class RandomAccessIterator,
+          class Value,
+          class OutputIterator>
+void model_autocorrelation(RandomAccessIterator params_first,
+                           RandomAccessIterator params_last,
+                           Value&               gain,
+                           OutputIterator       autocor_first)
+{
+    using std::abs;
+    using std::inner_product;
+    using std::size_t;
+    using std::vector;
+
+    const size_t p = std::distance(params_first, params_last);
+
+    // Step down from order p to find reflection coefficients k_1, ..., k_p
+    vector<Value> a(params_first, params_last), t(p), k(p);
+    for (size_t m = p; m --> 0;)
+    {
+        k[m] = a[m];
+        AR_ENSURE_MSGEXCEPT(abs(k[m]) < 1, "Process is not stationary",
+                            std::invalid_argument);
+        const Value denom = 1 - k[m]*k[m];
+        for (size_t i = 0; i < m; ++i)
+            t[i] = (a[i] - k[m]*a[m - 1 - i]) / denom;
+        std::copy(t.begin(), t.begin() + m, a.begin());
+    }
+
+    // Step up following burg_recursion to obtain the gain and autocorrelation
+    vector<Value> Ak(p + 1, Value(0)), ac;
+    Ak[0] = 1;
+    gain  = 1;
+    for (size_t kp1 = 1; kp1 <= p; ++kp1)
+    {
+        const Value mu = k[kp1 - 1];
+        for (size_t n = 0; n <= kp1/2; ++n)
+        {
+            Value t1 = Ak[n] + mu*Ak[kp1 - n];
+            Value t2 = Ak[kp1 - n] + mu*Ak[n];
+            Ak[n] = t1;
+            Ak[kp1 - n] = t2;
+        }
+        gain *= 1 / (1 - Ak[kp1]*Ak[kp1]);
+        ac.push_back(-inner_product(ac.rbegin(), ac.rend(),
+                                    Ak.begin() + 1, Ak[kp1]));
+    }
+
+    *autocor_first++ = 1;
+    std::copy(ac.begin(), ac.end(), autocor_first);
+}
+
+// Helpers for spectrum and spectrum_uniform evaluating the polynomial
+// A(omega) = 1 + a_1 exp(-i omega) + ... + a_p exp(-i p omega) by Horner's
+// rule.  A block of frequencies is processed lane-by-lane with a fixed trip
+// count so that the compiler may vectorize across frequencies.
+namespace
+{
+
+template <typename Value>
+struct spectrum_lanes
+{
+    enum { L = AR_SIMD_BYTES / sizeof(Value) >= 4
+             ? AR_SIMD_BYTES / sizeof(Value) : 4 };
+};
+
+/**
+ * Store \f$\sigma^2_\epsilon / |A(\omega)|^2\f$ into <tt>out[0:n]</tt> for
+ * <tt>n <= spectrum_lanes<Value>::L</tt> frequencies whose cosines are \c c
+ * and sines are \c s given a bidirectional range of \f$a_1,\dots,a_p\f$.
+ */
+template <typename Value, class BidirectionalIterator>
+void spectrum_horner(BidirectionalIterator params_first,
+                     BidirectionalIterator params_last,
+                     const Value           sigma2e,
+                     const std::size_t     n,
+                     const Value*          c,
+                     const Value*          s,
+                     Value*                out)
+{
+    enum { L = spectrum_lanes<Value>::L };
+
+    // Unused lanes evaluate harmlessly at zero frequency
+    Value lc[L], ls[L], re[L], im[L];
+    for (int j = 0; j < L; ++j)
+    {
+        lc[j] = std::size_t(j) < n ? c[j] : Value(1);
+        ls[j] = std::size_t(j) < n ? s[j] : Value(0);
+        re[j] = im[j] = 0;
+    }
+
+    // Multiply by exp(-i omega) and add each coefficient from a_p down to 1
+    while (params_first != params_last)
+    {
+        const Value a = *--params_last;
+        for (int j = 0; j < L; ++j)
+        {
+            const Value t = re[j]*lc[j] + im[j]*ls[j] + a;
+            im[j]         = im[j]*lc[j] - re[j]*ls[j];
+            re[j]         = t;
+        }
+    }
+    for (int j = 0; j < L; ++j)
+    {
+        const Value t = re[j]*lc[j] + im[j]*ls[j] + 1;
+        im[j]         = im[j]*lc[j] - re[j]*ls[j];
+        re[j]         = t;
+    }
+    for (std::size_t j = 0; j < n; ++j)
+        out[j] = sigma2e / (re[j]*re[j] + im[j]*im[j]);
+}
+
+}
+
+/**
+ * Working storage for \ref spectrum_uniform reused across invocations.
+ * Twiddle factors are retained so that successive evaluations on grids of
+ * one size perform neither allocation nor trigonometry.
+ */
+template <typename Value>
+class spectrum_workspace
+{
+public:
+
+    /** The working precision. */
+    typedef Value value_type;
+
+    /** The sequence type of working storage. */
+    typedef std::vector<Value> vector_type;
+
+    /** Real and imaginary parts of the transform. */
+    vector_type re, im;
+
+    /** Cosines and negated sines of the twiddle factors. */
+    vector_type wr, wi;
+
+    /** Cosines, sines, and densities for frequencies evaluated directly. */
+    vector_type c, s, d;
+};
+
+/**
+ * Evaluate the power spectral density \f$S(\omega) =
+ * \sigma^2_\epsilon / \left|1 + \sum_{k=1}^p a_k e^{-ik\omega}\right|^2\f$
+ * of the process \f$x_n + a_1 x_{n - 1} + \dots + a_p x_{n - p} =
+ * \epsilon_n\f$ at arbitrary angular frequencies \f$\omega\f$ in radians
+ * per sample.  The mean of \f$S\f$ over \f$[-\pi,\pi]\f$ is the process
+ * variance \f$\sigma^2_x\f$.  Frequencies are evaluated in blocks by Horner's
+ * rule, one lane per frequency, at a cost of \f$O(p)\f$ per frequency.
+ *
+ * @param[in]  params_first Beginning of range containing \f$a_1,\dots,a_p\f$.
+ * @param[in]  params_last  Exclusive ending of the parameter range.
+ * @param[in]  sigma2e      The innovation variance \f$\sigma^2_\epsilon\f$.
+ * @param[in]  omega_first  Beginning of the frequencies.
+ * @param[in]  omega_last   Exclusive ending of the frequencies.
+ * @param[out] out          Destination for one density per frequency.
+ *
+ * @returns \c out advanced past the last density written.
+ */
+template <class BidirectionalIterator,
+          typename Value,
+          class InputIterator,
+          class OutputIterator>
+OutputIterator spectrum(BidirectionalIterator params_first,
+                        BidirectionalIterator params_last,
+                        const Value           sigma2e,
+                        InputIterator         omega_first,
+                        InputIterator         omega_last,
+                        OutputIterator        out)
+{
+    using std::cos;
+    using std::sin;
+    using std::size_t;
+
+    enum { L = spectrum_lanes<Value>::L };
+
+    Value c[L], s[L], d[L];
+    while (omega_first != omega_last)
+    {
+        size_t n = 0;
+        for (; n < size_t(L) && omega_first != omega_last; ++n, ++omega_first)
+        {
+            const Value omega = *omega_first;
+            c[n] = cos(omega);
+            s[n] = sin(omega);
+        }
+        spectrum_horner(params_first, params_last, sigma2e, n, c, s, d);
+        out = std::copy(d, d + n, out);
+    }
+
+    return out;
+}
+
+/**
+ * Evaluate the power spectral density per \ref spectrum at the \c K
+ * uniformly spaced frequencies \f$\omega_j = \pi j / (K - 1)\f$ spanning
+ * zero through the Nyquist frequency.  Whenever \f$K - 1\f$ is a power of
+ * two and the model order is at least \f$\log_2 2(K - 1)\f$, every density
+ * is found from one radix-2 fast Fourier transform of length \f$2(K - 1)\f$
+ * of the coefficients \f$1, a_1, \dots, a_p\f$.  Coefficients beyond that
+ * length are folded onto it modulo the length, which is exact at these
+ * frequencies.  Otherwise each frequency is evaluated directly per \ref
+ * spectrum.  Storage is drawn from \c workspace.
+ *
+ * @param[in]     params_first Beginning of range containing
+ *                             \f$a_1,\dots,a_p\f$.
+ * @param[in]     params_last  Exclusive ending of the parameter range.
+ * @param[in]     sigma2e      The innovation variance
+ *                             \f$\sigma^2_\epsilon\f$.
+ * @param[in]     K            Number of frequencies.  One requests only
+ *                             \f$\omega = 0\f$.
+ * @param[out]    out          Destination for \c K densities.
+ * @param[in,out] workspace    Working storage reused across invocations.
+ *
+ * @returns \c out advanced past the last density written.
+ */
+template <class BidirectionalIterator,
+          typename Value,
+          class OutputIterator>
+OutputIterator spectrum_uniform(BidirectionalIterator       params_first,
+                                BidirectionalIterator       params_last,
+                                const Value                 sigma2e,
+                                const std::size_t           K,
+                                OutputIterator              out,
+                                spectrum_workspace<Value>&  workspace)
+{
+    using std::size_t;
+
+    spectrum_workspace<Value>& w = workspace;
+    const size_t p = std::distance(params_first, params_last);
+    const Value  pi = 4 * std::atan(Value(1));
+    if (K == 0) return out;
+
+    // Is a transform of length n applicable and its log2 n below the order?
+    const size_t n = 2*(K - 1);
+    size_t lgn = 0;
+    while ((size_t(1) << lgn) < n) ++lgn;
+    if (K < 2 || (size_t(1) << lgn) != n || p < lgn)
+    {
+        w.c.resize(K);
+        w.s.resize(K);
+        w.d.resize(K);
+        for (size_t j = 0; j < K; ++j)
+        {
+            const Value omega = K < 2 ? 0 : pi * Value(j) / Value(K - 1);
+            w.c[j] = std::cos(omega);
+            w.s[j] = std::sin(omega);
+        }
+        enum { L = spectrum_lanes<Value>::L };
+        for (size_t j = 0; j < K; j += L)
+        {
+            spectrum_horner(params_first, params_last, sigma2e,
+                            std::min(size_t(L), K - j),
+                            &w.c[j], &w.s[j], &w.d[j]);
+        }
+        return std::copy(w.d.begin(), w.d.end(), out);
+    }
+
+    // Twiddle factors exp(-2 pi i m / n) are recomputed only when n changes
+    if (w.wr.size() != n/2)
+    {
+        w.wr.resize(n/2);
+        w.wi.resize(n/2);
+        for (size_t m = 0; m < n/2; ++m)
+        {
+            const Value theta = 2 * pi * Value(m) / Value(n);
+            w.wr[m] =  std::cos(theta);
+            w.wi[m] = -std::sin(theta);
+        }
+    }
+
+    // Fold the coefficients into bit-reversed positions of the transform
+    w.re.assign(n, Value(0));
+    w.im.assign(n, Value(0));
+    w.re[0] = 1;
+    for (size_t k = 1; params_first != params_last; ++params_first, ++k)
+    {
+        size_t m = k % n, r = 0;
+        for (size_t b = 0; b < lgn; ++b, m >>= 1) r = (r << 1) | (m & 1);
+        w.re[r] += *params_first;
+    }
+    // Iterative radix-2 decimation in time
+    for (size_t len = 2; len <= n; len <<= 1)
+    {
+        const size_t half = len / 2, step = n / len;
+        for (size_t i = 0; i < n; i += len)
+        {
+            for (size_t j = 0; j < half; ++j)
+            {
+                const size_t u = i + j, v = u + half;
+                const Value tr = w.re[v]*w.wr[j*step] - w.im[v]*w.wi[j*step];
+                const Value ti = w.re[v]*w.wi[j*step] + w.im[v]*w.wr[j*step];
+                w.re[v]  = w.re[u] - tr;
+                w.im[v]  = w.im[u] - ti;
+                w.re[u] += tr;
+                w.im[u] += ti;
+            }
+        }
+    }
+
+    for (size_t j = 0; j < K; ++j, ++out)
+        *out = sigma2e / (w.re[j]*w.re[j] + w.im[j]*w.im[j]);
+
+    return out;
+}
+
+/**
+ * Evaluate the power spectral density at \c K uniformly spaced frequencies
+ * per \ref spectrum_uniform allocating working storage on each invocation.
+ */
+template <class BidirectionalIterator,
+          typename Value,
+          class OutputIterator>
+OutputIterator spectrum_uniform(BidirectionalIterator params_first,
+                                BidirectionalIterator params_last,
+                                const Value           sigma2e,
+                                const std::size_t     K,
+                                OutputIterator        out)
+{
+    spectrum_workspace<Value> workspace;
+    return spectrum_uniform(params_first, params_last, sigma2e, K, out,
+                            workspace);
+}
+
+/**
+ * Evaluate the power spectral densities of many models at once per \ref
+ * spectrum at common angular frequencies.  Models are distributed across
+ * OpenMP threads using dynamic scheduling.  Model \c i has parameters
+ * <tt>[params_firsts[i], params_lasts[i])</tt> and innovation variance
+ * <tt>sigma2es[i]</tt> and its densities are written to <tt>outs[i]</tt>.
+ * Any exception thrown while processing a model is rethrown after all
+ * threads complete, as a <tt>std::runtime_error</tt> with the same message.
+ *
+ * @param[in]  M             Number of models.
+ * @param[in]  params_firsts Beginning iterators for each model's parameters.
+ * @param[in]  params_lasts  Exclusive end iterators for each model.
+ * @param[in]  sigma2es      Innovation variances for each model.
+ * @param[in]  omega_first   Beginning of the frequencies.
+ * @param[in]  omega_last    Exclusive ending of the frequencies.
+ * @param[out] outs          Destination iterators for each model.
+ * @param[in]  nthreads      Number of threads or zero for the OpenMP default.
+ */
+template <class RandomAccessIterator1,
+          class RandomAccessIterator2,
+          class RandomAccessIterator3,
+          class ForwardIterator,
+          class RandomAccessIterator4>
+void spectrum_batch(const std::size_t     M,
+                    RandomAccessIterator1 params_firsts,
+                    RandomAccessIterator2 params_lasts,
+                    RandomAccessIterator3 sigma2es,
+                    ForwardIterator       omega_first,
+                    ForwardIterator       omega_last,
+                    RandomAccessIterator4 outs,
+                    const int             nthreads = 0)
+{
+    using std::ptrdiff_t;
+    using std::string;
+
+    typedef typename std::iterator_traits<
+            RandomAccessIterator3
+        >::value_type Value;
+
+#ifdef _OPENMP
+    const int T = nthreads > 0 ? nthreads : omp_get_max_threads();
+#else
+    (void) nthreads;
+#endif
+    bool   failed = false;
+    string error;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(T) if (M > 1)
+#endif
+    for (ptrdiff_t i = 0; i < static_cast<ptrdiff_t>(M); ++i)
+    {
+        try
+        {
+            spectrum(params_firsts[i], params_lasts[i], Value(sigma2es[i]),
+                     omega_first, omega_last, outs[i]);
+        }
+        catch (std::exception& e)
+        {
+#ifdef _OPENMP
+#pragma omp critical(ar_spectrum_batch)
+#endif
+            if (!failed) { failed = true; error = e.what(); }
+        }
+    }
+
+    AR_ENSURE_MSGEXCEPT(!failed, error, std::runtime_error);
+}
+
+/**
+ * Evaluate the power spectral densities of many models at once per \ref
+ * spectrum_uniform on a common grid of \c K frequencies.  Models are
+ * distributed across OpenMP threads using dynamic scheduling and every
+ * thread owns a \ref spectrum_workspace reused across the models it
+ * processes.  Model \c i has parameters <tt>[params_firsts[i],
+ * params_lasts[i])</tt> and innovation variance <tt>sigma2es[i]</tt> and its
+ * densities are written to <tt>outs[i]</tt>.  Any exception thrown while
+ * processing a model is rethrown after all threads complete, as a
+ * <tt>std::runtime_error</tt> with the same message.
+ *
+ * @param[in]  M             Number of models.
+ * @param[in]  params_firsts Beginning iterators for each model's parameters.
+ * @param[in]  params_lasts  Exclusive end iterators for each model.
+ * @param[in]  sigma2es      Innovation variances for each model.
+ * @param[in]  K             Number of frequencies.
+ * @param[out] outs          Destination iterators for each model.
+ * @param[in]  nthreads      Number of threads or zero for the OpenMP default.
+ */
+template <class RandomAccessIterator1,
+          class RandomAccessIterator2,
+          class RandomAccessIterator3,
+          class RandomAccessIterator4>
+void spectrum_uniform_batch(const std::size_t     M,
+                            RandomAccessIterator1 params_firsts,
+                            RandomAccessIterator2 params_lasts,
+                            RandomAccessIterator3 sigma2es,
+                            const std::size_t     K,
+                            RandomAccessIterator4 outs,
+                            const int             nthreads = 0)
+{
+    using std::ptrdiff_t;
+    using std::string;
+
+    typedef typename std::iterator_traits<
+            RandomAccessIterator3
+        >::value_type Value;
+
+#ifdef _OPENMP
+    const int T = nthreads > 0 ? nthreads : omp_get_max_threads();
+#else
+    (void) nthreads;
+#endif
+    bool   failed = false;
+    string error;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(T) if (M > 1)
+#endif
+    {
+        // Per-thread working storage reused across models
+        spectrum_workspace<Value> workspace;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (ptrdiff_t i = 0; i < static_cast<ptrdiff_t>(M); ++i)
+        {
+            try
+            {
+                spectrum_uniform(params_firsts[i], params_lasts[i],
+                                 Value(sigma2es[i]), K, outs[i], workspace);
+            }
+            catch (std::exception& e)
+            {
+#ifdef _OPENMP
+#pragma omp critical(ar_spectrum_uniform_batch)
+#endif
+                if (!failed) { failed = true; error = e.what(); }
+            }
+        }
+    }
+
+    AR_ENSURE_MSGEXCEPT(!failed, error, std::runtime_error);
+}
+
+/**
+ * A NoiseGenerator producing normally distributed values with mean zero and
+ * standard deviation \c sigma.  The <tt>i</tt>-th uniform deviate of the
+ * underlying stream is a hash of the key <tt>(seed, stream)</tt> and of \c i
+ * alone, so that distinct streams are statistically independent and
+ * reproducible regardless of the order in which they are consumed.  Uniform
+ * deviates are transformed per Box and Muller.
+ */
+template <typename Value>
+class counter_normal
+{
+public:
+
+    /** Construct stream \c stream from \c seed scaled by \c sigma. */
+    explicit counter_normal(const unsigned long long seed   = 0,
+                            const unsigned long long stream = 0,
+                            const Value              sigma  = 1)
+        : key(mix(seed ^ mix(stream + 0x9E3779B97F4A7C15ULL))),
+          counter(0),
+          sigma(sigma),
+          spare(0),
+          has_spare(false)
+    {}
+
+    /** Obtain the next normally distributed value. */
+    Value operator()()
+    {
+        using std::cos;
+        using std::log;
+        using std::sin;
+        using std::sqrt;
+
+        if (has_spare)
+        {
+            has_spare = false;
+            return spare;
+        }
+
+        const double twopi = 6.283185307179586476925286766559;
+        const double r     = sqrt(-2 * log(uniform()));
+        const double theta = twopi * uniform();
+        spare     = static_cast<Value>(sigma * r * sin(theta));
+        has_spare = true;
+        return static_cast<Value>(sigma * r * cos(theta));
+    }
+
+private:
+
+    /** The SplitMix64 finalizer from Steele, Lea, and Flood 2014. */
+    static unsigned long long mix(unsigned long long z)
+    {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /** Obtain the next uniform deviate on the open interval (0, 1). */
+    double uniform()
+    {
+        const unsigned long long z
+            = mix(key + ++counter * 0x9E3779B97F4A7C15ULL);
+        return ((z >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+    }
+
+    unsigned long long key;
+    unsigned long long counter;
+    Value              sigma;
+    Value              spare;
+    bool               has_spare;
+};
+
+// Helpers for synthesize advancing process state by whole blocks
+namespace
+{
+
+/** Compute row-major <tt>C = A B</tt> for square matrices of order \c p. */
+template <typename Value>
+void square_multiply(const std::size_t p,
+                     const Value* A, const Value* B, Value* C)
+{
+    for (std::size_t i = 0; i < p; ++i)
+    {
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            Value s = 0;
+            for (std::size_t k = 0; k < p; ++k) s += A[i*p + k] * B[k*p + j];
+            C[i*p + j] = s;
+        }
+    }
+}
+
+/**
+ * Compute the row-major matrix \c M advancing the state \f$x_{n-1}, \dots,
+ * x_{n-p}\f$ of the homogeneous process with parameters \c a by \c L steps.
+ * That is, raise the process' companion matrix to the <tt>L</tt>-th power by
+ * repeated squaring.
+ */
+template <typename Value>
+void companion_power(const std::vector<Value>& a,
+                     std::size_t               L,
+                     std::vector<Value>&       M)
+{
+    const std::size_t p = a.size();
+    std::vector<Value> C(p*p, Value(0)), T(p*p);
+    for (std::size_t j = 0; j < p; ++j) C[j] = -a[j];
+    for (std::size_t i = 1; i < p; ++i) C[i*p + i - 1] = 1;
+
+    M.assign(p*p, Value(0));
+    for (std::size_t i = 0; i < p; ++i) M[i*p + i] = 1;
+    while (L)
+    {
+        if (L & 1)
+        {
+            square_multiply(p, &M[0], &C[0], &T[0]);
+            M.swap(T);
+        }
+        L >>= 1;
+        if (L)
+        {
+            square_multiply(p, &C[0], &C[0], &T[0]);
+            C.swap(T);
+        }
+    }
+}
+
+}
+
+/**
+ * Synthesize \c N samples of the process \f$x_n + a_1 x_{n - 1} + \dots +
+ * a_p x_{n - p} = \epsilon_n\f$ with \f$\epsilon_n\sim{}N\left(0,
+ * \sigma^2_\epsilon\right)\f$ by splitting the timeline into blocks of
+ * length \c block which are generated concurrently by OpenMP threads.
+ *
+ * The process starts from a state drawn from the stationary distribution of
+ * \f$x_{n-1}, \dots, x_{n-p}\f$, which has Toeplitz covariance
+ * \f$\sigma^2_x \rho_{|i-j|}\f$, so no burn-in is required.  Each block draws
+ * its innovations from its own \ref counter_normal stream.  Linearity is then
+ * exploited in three phases.  First, every block is generated concurrently
+ * from a zero initial state.  Second, the true state entering each block is
+ * found by a serial scan that jumps the state ahead by whole blocks using the
+ * <tt>block</tt>-th power of the companion matrix.  Third, every block
+ * concurrently adds the response to its true entering state.  The result is,
+ * up to rounding, one continuous realization of the process which depends
+ * only upon the model, \c seed, and \c block but not upon the number of
+ * threads.  The arguments are those produced by \ref burg_method or by \ref
+ * model_autocorrelation.
+ *
+ * @param params_first  Beginning of range containing \f$a_1,\dots,a_p\f$.
+ * @param params_last   Exclusive ending of the parameter range.
+ * @param sigma2e       The innovation variance \f$\sigma^2_\epsilon\f$.
+ * @param gain          The model gain \f$\sigma^2_x / \sigma^2_\epsilon\f$.
+ * @param autocor_first Beginning of range containing \f$\rho_0,...\rho_p\f$.
+ * @param N             Number of samples to synthesize.
+ * @param out_first     Beginning of the output range of length \c N.
+ * @param seed          Seed from which all random streams derive.
+ * @param block         Number of samples in each block which is increased,
+ *                      if necessary, to at least the process order.
+ * @param nthreads      Number of threads or zero for the OpenMP default.
+ *
+ * @return The end of the output range.
+ * @throws std::invalid_argument if the stationary covariance is not
+ *         positive definite or if \c block is zero.
+ */
+template <class RandomAccessIterator1,
+          class Value,
+          class RandomAccessIterator2,
+          class RandomAccessIterator3>
+RandomAccessIterator3 synthesize(RandomAccessIterator1    params_first,
+                                 RandomAccessIterator1    params_last,
+                                 const Value              sigma2e,
+                                 const Value              gain,
+                                 RandomAccessIterator2    autocor_first,
+                                 const std::size_t        N,
+                                 RandomAccessIterator3    out_first,
+                                 const unsigned long long seed,
+                                 std::size_t              block    = 65536,
+                                 const int                nthreads = 0)
+{
+    using std::max;
+    using std::min;
+    using std::ptrdiff_t;
+    using std::size_t;
+    using std::sqrt;
+    using std::string;
+    using std::vector;
+
+    AR_ENSURE_ARG(block > 0);
+    const vector<Value> a(params_first, params_last);
+    const size_t p = a.size();
+    block = max(block, p);
+
+    // Lower Cholesky factor L of the stationary state covariance
+    vector<Value> L(p*p, Value(0));
+    for (size_t i = 0; i < p; ++i)
+    {
+        for (size_t j = 0; j <= i; ++j)
+        {
+            Value s = gain * sigma2e * autocor_first[i - j];
+            for (size_t k = 0; k < j; ++k) s -= L[i*p + k] * L[j*p + k];
+            if (i == j)
+            {
+                AR_ENSURE_MSGEXCEPT(s > 0,
+                        "Stationary covariance is not positive definite",
+                        std::invalid_argument);
+                L[i*p + i] = sqrt(s);
+            }
+            else
+            {
+                L[i*p + j] = s / L[j*p + j];
+            }
+        }
+    }
+
+    // States entering each block where state[b*p + i] holds x_{n-1-i}
+    const size_t B = (N + block - 1) / block;
+    vector<Value> state((B + 1)*p, Value(0));
+    {
+        counter_normal<Value> w(seed, 0);
+        vector<Value> z(p);
+        for (size_t i = 0; i < p; ++i) z[i] = w();
+        for (size_t i = 0; i < p; ++i)
+            for (size_t j = 0; j <= i; ++j) state[i] += L[i*p + j] * z[j];
+    }
+
+#ifdef _OPENMP
+    const int T = nthreads > 0 ? nthreads : omp_get_max_threads();
+#else
+    (void) nthreads;
+#endif
+    bool   failed = false;
+    string error;
+
+    // Generate each block from zero state retaining its final state
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(T) schedule(dynamic) if (B > 1)
+#endif
+    for (ptrdiff_t b = 0; b < static_cast<ptrdiff_t>(B); ++b)
+    {
+        try
+        {
+            basic_predictor<Value, counter_normal<Value> > r(
+                    a.begin(), a.end(),
+                    counter_normal<Value>(seed, b + 1, sqrt(sigma2e)));
+            const size_t first = b*block, n = min(block, N - first);
+            r.generate(out_first + first, n);
+            for (size_t i = 0; i < p && i < n; ++i)
+                state[(b + 1)*p + i] = out_first[first + n - 1 - i];
+        }
+        catch (std::exception& e)
+        {
+#ifdef _OPENMP
+#pragma omp critical(ar_synthesize)
+#endif
+            if (!failed) { failed = true; error = e.what(); }
+        }
+    }
+    AR_ENSURE_MSGEXCEPT(!failed, error, std::runtime_error);
+
+    // Jump each entering state ahead by one block to find the next
+    if (B > 1)
+    {
+        vector<Value> M, t(p);
+        companion_power(a, block, M);
+        for (size_t b = 1; b < B; ++b)
+        {
+            for (size_t i = 0; i < p; ++i)
+            {
+                Value s = state[b*p + i];
+                for (size_t j = 0; j < p; ++j)
+                    s += M[i*p + j] * state[(b - 1)*p + j];
+                t[i] = s;
+            }
+            std::copy(t.begin(), t.end(), state.begin() + b*p);
+        }
+    }
+
+    // Add each block's response to its entering state
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(T) schedule(dynamic) if (B > 1)
+#endif
+    for (ptrdiff_t b = 0; b < static_cast<ptrdiff_t>(B); ++b)
+    {
+        try
+        {
+            basic_predictor<Value> h(a.begin(), a.end());
+            h.initial_conditions(state.begin() + b*p);
+            const size_t first = b*block, n = min(block, N - first);
+            for (size_t i = 0; i < n; ++i, ++h) out_first[first + i] += *h;
+        }
+        catch (std::exception& e)
+        {
+#ifdef _OPENMP
+#pragma omp critical(ar_synthesize)
+#endif
+            if (!failed) { failed = true; error = e.what(); }
+        }
+    }
+    AR_ENSURE_MSGEXCEPT(!failed, error, std::runtime_error);
+
+    return out_first + N;
+}
+
+// Helpers for zohar_linear_solve
+namespace
+{
+
+/**
+ * Compute the dot product of contiguous <tt>x[0], ..., x[n-1]</tt> and
+ * <tt>y[0], ..., y[n-1]</tt> using four independent partial sums.  Breaking
+ * the serial dependence of a single accumulator permits the compiler to
+ * vectorize and pipeline the loop without reassociating floating point.
+ */
+template <typename Value>
+Value unrolled_dot(const Value* x, const Value* y, const std::size_t n)
+{
+    Value s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    std::size_t j = 0;
+    for (; j + 4 <= n; j += 4)
+    {
+        s0 += x[j    ]*y[j    ];
+        s1 += x[j + 1]*y[j + 1];
+        s2 += x[j + 2]*y[j + 2];
+        s3 += x[j + 3]*y[j + 3];
+    }
+    for (; j < n; ++j) s0 += x[j]*y[j];
+    return (s0 + s1) + (s2 + s3);
+}
+
+}
+
+/**
+ * Working storage for \ref zohar_linear_solve.  Once a workspace has solved
+ * a system, solving further systems which are no larger and have no more
+ * right hand sides performs no heap allocation because every buffer retains
+ * its capacity.  Use \ref reserve to reach that state before the first
+ * solve.  Workspaces are not thread-safe so keep one per thread.
+ */
+template <typename Value>
+class zohar_workspace
+{
+public:
+
+    /** The working precision. */
+    typedef Value value_type;
+
+    /** The sequence type of working storage. */
+    typedef std::vector<Value> vector_type;
+
+    /** Allocate only a minimal amount of storage. */
+    zohar_workspace() {}
+
+    /** Allocate storage sufficient for dimension \c n and \c k solutions. */
+    zohar_workspace(const std::size_t n, const std::size_t k = 1)
+    {
+        reserve(n, k);
+    }
+
+    /**
+     * Ensure problems of dimension up to \c n having up to \c k right hand
+     * sides may be solved without allocation.
+     */
+    void reserve(const std::size_t n, const std::size_t k = 1)
+    {
+        a   .reserve(n);
+        rhat.reserve(n);
+        ehat.reserve(n);
+        g   .reserve(n);
+        s   .reserve(k*(n + 1));
+    }
+
+    /** Contiguous copy of \f$\vec{a}\f$. */
+    vector_type a;
+
+    /** Contiguous copy of \f$\vec{r}\f$ in reverse order. */
+    vector_type rhat;
+
+    /**
+     * Storage for \f$\hat{e}_i\f$ which occupies the trailing \c i entries
+     * so that \f$\hat{e}_{i+1}\f$ may be formed in-place.
+     */
+    vector_type ehat;
+
+    /** Storage for \f$g_i\f$. */
+    vector_type g;
+
+    /**
+     * Column-major storage for every \f$s_i\f$ followed by the not yet
+     * consumed portion of the corresponding \f$d\f$.
+     */
+    vector_type s;
+};
+
+/**
+ * Solve a Toeplitz set of linear equations for \c k right hand sides
+ * simultaneously.  That is, find \f$s_{n+1}\f$ satisfying
+ * \f[
+ *      L_{n+1} s_{n+1} = d_{n+1}
+ *      \mbox{ where }
+ *      L_{n+1} = \bigl(\begin{smallmatrix}
+ *                    1   & \tilde{a}_n \\
+ *                    r_n & L_n
+ *                \end{smallmatrix}\bigr)
+ * \f]
+ * for each of \c k vectors \f$\vec{d}\f$ given \f$\vec{a}\f$ and
+ * \f$\vec{r}\f$.  See the single right hand side \ref zohar_linear_solve for
+ * details.  Only the updates of \f$s_i\f$ depend on \f$\vec{d}\f$ so the
+ * remainder of the <tt>O(2*(n+1)^2)</tt> recursion is shared across all
+ * right hand sides, each costing only an additional <tt>O((n+1)^2)</tt>.
+ * The working precision is fixed by the \c value_type of \c w.  No heap
+ * allocation occurs once \c w has sufficient capacity.  Input and output
+ * ranges may coincide.
+ *
+ * @param[in]  a_first Beginning of the range containing \f$\vec{a}\f$.
+ * @param[in]  a_last  End of the range containing \f$\vec{a}\f$.
+ * @param[in]  r_first Beginning of the range containing \f$\vec{r}\f$.
+ * @param[in]  k       Number of right hand sides.
+ * @param[in]  d_first Beginning of the range containing \f$\vec{d}\f$
+ *                     for each right hand side stored consecutively.
+ *                     That is, <tt>k*(n+1)</tt> entries should be available.
+ * @param[out] s_first Beginning of the output range to which
+ *                     <tt>k*(n+1)</tt> entries will be written.  Solutions
+ *                     are stored consecutively like the right hand sides.
+ * @param[in]  w       Working storage to be reused across invocations.
+ */
+template<class RandomAccessIterator,
+         class InputIterator,
+         class OutputIterator,
+         typename Value>
+void zohar_linear_solve(RandomAccessIterator     a_first,
+                        RandomAccessIterator     a_last,
+                        RandomAccessIterator     r_first,
+                        const std::size_t        k,
+                        InputIterator            d_first,
+                        OutputIterator           s_first,
+                        zohar_workspace<Value>&  w)
+{
+    using std::copy;
+    using std::distance;
+    using std::invalid_argument;
+    using std::iterator_traits;
+    using std::size_t;
+
+    // Tildes indicate transposes while hats indicate reversed vectors.
+
+    // Determine problem size using [a_first,a_last) and ensure nontrivial
+    typename iterator_traits<RandomAccessIterator>::difference_type dist
+            = distance(a_first, a_last);
+    if (dist < 1) throw invalid_argument("distance(a_first, a_last) < 1");
+    const size_t n = static_cast<size_t>(dist), n1 = n + 1;
+
+    // Copy a and reversed r so \hat{r}_i is the contiguous rhat[n-i, n)
+    w.a.assign(a_first, a_last);
+    w.rhat.resize(n);
+    for (size_t j = 0; j < n; ++j) w.rhat[n - 1 - j] = r_first[j];
+    const Value* const a    = &w.a[0];
+    const Value* const rhat = &w.rhat[0];
+
+    // Load every right hand side so s shares its storage with unread d
+    w.s.resize(k*n1);
+    for (size_t j = 0; j < k*n1; ++j, ++d_first) w.s[j] = *d_first;
+
+    // Set initial values for recursion.  Trench's observation that "[i]t is
+    // only necessary to retain quantities computed at level m - 1 until the
+    // computations at level m are complete" [Trench1967, page 1504] holds
+    // in-place for \hat{e}_i by storing it right-aligned within ehat.
+    w.ehat.resize(n);
+    w.g   .resize(n);
+    Value* const ehat = &w.ehat[0];
+    Value* const g    = &w.g[0];
+    ehat[n - 1]  = -a[0];
+    g[0]         = -rhat[n - 1];
+    Value lambda = 1 - a[0]*rhat[n - 1];
+
+    // Recursion for i = {1, 2, ..., n - 1}:
+    for (size_t i = 1; i < n; ++i)
+    {
+        Value*       const e  = ehat + (n - i);
+        const Value* const rh = rhat + (n - i);
+
+        // \eta_i   = -\rho_{-(i+1)} - \tilde{a}_i \hat{e}_i
+        const Value neg_eta   = a[i] + unrolled_dot(e, a, i);
+
+        // \gamma_i = -\rho_{i+1}    - \tilde{g}_i \hat{r}_i
+        const Value neg_gamma = rhat[n - 1 - i] + unrolled_dot(g, rh, i);
+
+        /*
+         * s_{i+1} = \bigl(\begin{smallmatrix}
+         *              s_i + (\theta_i/\lambda_i) \hat{e}_i \\
+         *              \theta_i/\lambda_i
+         *          \end{smallmatrix}\bigr)
+         */
+        for (size_t m = 0; m < k; ++m)
+        {
+            Value* const s = &w.s[m*n1];
+
+            // \theta_i =  \delta_{i+1}  - \tilde{s}_i \hat{r}_i
+            const Value neg_theta = unrolled_dot(s, rh, i) - s[i];
+
+            const Value theta_by_lambda = -neg_theta/lambda;
+            for (size_t j = 0; j < i; ++j) s[j] += theta_by_lambda*e[j];
+            s[i] = theta_by_lambda;
+        }
+
+        /*
+         * \hat{e}_{i+1} = \bigl(\begin{smallmatrix}
+         *                     \eta_i/\lambda_i \\
+         *                     \hat{e}_i + (\eta_i/\lambda_i) g_i
+         *                 \end{smallmatrix}\bigr)
+         *
+         * g_{i+1} = \bigl(\begin{smallmatrix}
+         *               g_i + (\gamma_i/\lambda_i) \hat{e}_i \\
+         *               \gamma_i/\lambda_i
+         *           \end{smallmatrix}\bigr)
+         */
+        const Value   eta_by_lambda = -neg_eta  /lambda;
+        const Value gamma_by_lambda = -neg_gamma/lambda;
+        for (size_t j = 0; j < i; ++j)
+        {
+            const Value ej = e[j];
+            e[j] += eta_by_lambda*g[j];
+            g[j] += gamma_by_lambda*ej;
+        }
+        e[-1] = eta_by_lambda;
+        g[i]  = gamma_by_lambda;
+
+        // \lambda_{i+1} = \lambda_i - \eta_i \gamma_i / \lambda_i
+        lambda -= neg_eta*neg_gamma/lambda;
+    }
+
+    // Recursion for i = n differs slightly per Zohar's "Last Computed Values"
+    // Computing g_n above was unnecessary but the incremental expense is small
+    for (size_t m = 0; m < k; ++m)
+    {
+        Value* const s = &w.s[m*n1];
+
+        // \theta_n =  \delta_{n+1}  - \tilde{s}_n \hat{r}_n
+        const Value neg_theta = unrolled_dot(s, rhat, n) - s[n];
+
+        /*
+         * s_{n+1} = \bigl(\begin{smallmatrix}
+         *              s_n + (\theta_n/\lambda_n) \hat{e}_n \\
+         *              \theta_n/\lambda_n
+         *          \end{smallmatrix}\bigr)
+         */
+        const Value theta_by_lambda = -neg_theta/lambda;
+        for (size_t j = 0; j < n; ++j) s[j] += theta_by_lambda*ehat[j];
+        s[n] = theta_by_lambda;
+    }
+
+    // Output solutions
+    copy(w.s.begin(), w.s.end(), s_first);
+}
+
+/**
+ * Solve a Toeplitz set of linear equations using caller-provided working
+ * storage.  Identical to the overload lacking \c w except that the working
+ * precision is fixed by the \c value_type of \c w and no heap allocation
+ * occurs once \c w has sufficient capacity.
+ *
+ * @param[in]  a_first Beginning of the range containing \f$\vec{a}\f$.
+ * @param[in]  a_last  End of the range containing \f$\vec{a}\f$.
+ * @param[in]  r_first Beginning of the range containing \f$\vec{r}\f$.
+ * @param[in]  d_first Beginning of the range containing \f$\vec{d}\f$
+ *                     which should have <tt>n+1</tt> entries available.
+ * @param[out] s_first Beginning of the output range to which
+ *                     <tt>n+1</tt> entries will be written.
+ * @param[in]  w       Working storage to be reused across invocations.
+ */
+template<class RandomAccessIterator,
+         class InputIterator,
+         class OutputIterator,
+         typename Value>
+void zohar_linear_solve(RandomAccessIterator     a_first,
+                        RandomAccessIterator     a_last,
+                        RandomAccessIterator     r_first,
+                        InputIterator            d_first,
+                        OutputIterator           s_first,
+                        zohar_workspace<Value>&  w)
+{
+    return zohar_linear_solve(a_first, a_last, r_first,
+                              1, d_first, s_first, w);
+}
+
+/**
+ * Solve a Toeplitz set of linear equations.  That is, find \f$s_{n+1}\f$
+ * satisfying
+ * \f[
+ *      L_{n+1} s_{n+1} = d_{n+1}
+ *      \mbox{ where }
+ *      L_{n+1} = \bigl(\begin{smallmatrix}
+ *                    1   & \tilde{a}_n \\
+ *                    r_n & L_n
+ *                \end{smallmatrix}\bigr)
+ * \f]
+ * given \f$\vec{a}\f$, \f$\vec{r}\f$, and \f$\vec{d}\f$.  The dimension of the
+ * problem is fixed by <tt>n = distance(a_first, a_last)</tt>.  A symmetric
+ * Toeplitz solve can be performed by having \f$\vec{a}\f$ and \f$\vec{r}\f$
+ * iterate over the same data.  The Hermitian case requires two buffers with
+ * \f$vec{r}\f$ being the conjugate of \f$\vec{a}\f$.  The working precision
+ * is fixed by the \c value_type of \c d_first.
+ *
+ * The algorithm is from Zohar, Shalhav. "The Solution of a Toeplitz Set of
+ * Linear Equations." J. ACM 21 (April 1974): 272-276.
+ * http://dx.doi.org/10.1145/321812.321822.  It has complexity like
+ * <tt>O(2*(n+1)^2)</tt>.  Zohar improved upon earlier work from Page 1504 from
+ * Trench, William F. "Weighting Coefficients for the Prediction of Stationary
+ * Time Series from the Finite Past." SIAM Journal on Applied Mathematics 15
+ * (November 1967): 1502-1510.  http://www.jstor.org/stable/2099503.See
+ * Bunch, James R. "Stability of Methods for Solving Toeplitz Systems of
+ * Equations." SIAM Journal on Scientific and Statistical Computing 6 (1985):
+ * 349-364. http://dx.doi.org/10.1137/0906025 for a discussion of the
+ * algorithm's stability characteristics.
+ *
+ * @param[in]  a_first Beginning of the range containing \f$\vec{a}\f$.
+ * @param[in]  a_last  End of the range containing \f$\vec{a}\f$.
+ * @param[in]  r_first Beginning of the range containing \f$\vec{r}\f$.
+ * @param[in]  d_first Beginning of the range containing \f$\vec{d}\f$
+ *                     which should have <tt>n+1</tt> entries available.
+ * @param[out] s_first Beginning of the output range to which
+ *                     <tt>n+1</tt> entries will be written.
+ */
+template<class RandomAccessIterator,
+         class InputIterator,
+         class OutputIterator>
+void zohar_linear_solve(RandomAccessIterator a_first,
+                        RandomAccessIterator a_last,
+                        RandomAccessIterator r_first,
+                        InputIterator        d_first,
+                        OutputIterator       s_first)
+{
+    // InputIterator::value_type determines the working precision
+    typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+    zohar_workspace<value_type> w;
+    return zohar_linear_solve(a_first, a_last, r_first, d_first, s_first, w);
+}
+
+/**
+ * Solve a Toeplitz set of linear equations in-place.  That is, compute
+ * \f[
+ *      L_{n+1}^{-1} d_{n+1}
+ *      \mbox{ for }
+ *      L_{n+1} = \bigl(\begin{smallmatrix}
+ *                    1   & \tilde{a}_n \\
+ *                    r_n & L_n
+ *                \end{smallmatrix}\bigr)
+ * \f]
+ * given \f$\vec{a}\f$, \f$\vec{r}\f$, and \f$\vec{d}\f$.  The dimension of the
+ * problem is fixed by <tt>n = distance(a_first, a_last)</tt>.  A symmetric
+ * Toeplitz solve can be performed by having \f$\vec{a}\f$ and \f$\vec{r}\f$
+ * iterate over the same data.  The Hermitian case requires two buffers with
+ * \f$vec{r}\f$ being the conjugate of \f$\vec{a}\f$.  The working precision
+ * is fixed by the \c value_type of \c d_first.
+ *
+ * @param[in]     a_first Beginning of the range containing \f$\vec{a}\f$.
+ * @param[in]     a_last  End of the range containing \f$\vec{a}\f$.
+ * @param[in]     r_first Beginning of the range containing \f$\vec{r}\f$.
+ * @param[in,out] d_first Beginning of the range containing \f$\vec{d}\f$.
+ *                        Also the beginning of the output range to which
+ *                        <strong><tt>n+1</tt></strong> entries will be
+ *                        written.
+ */
+template<class RandomAccessIterator,
+         class ForwardIterator>
+void zohar_linear_solve(RandomAccessIterator a_first,
+                        RandomAccessIterator a_last,
+                        RandomAccessIterator r_first,
+                        ForwardIterator      d_first)
+{
+    return zohar_linear_solve(a_first, a_last, r_first, d_first, d_first);
+}
+
+
+/**
+ * Solve a real-valued, symmetric Toeplitz set of linear equations in-place.
+ * That is, compute
+ * \f[
+ *      L_{n+1}^{-1} d_{n+1}
+ *      \mbox{ for }
+ *      L_{n+1} = \bigl(\begin{smallmatrix}
+ *                    1   & \tilde{a}_n \\
+ *                    a_n & L_n
+ *                \end{smallmatrix}\bigr)
+ * \f]
+ * given \f$\vec{a}\f$ and \f$\vec{d}\f$.  The dimension of the problem is
+ * fixed by <tt>n = distance(a_first, a_last)</tt>.  The working precision is
+ * fixed by the \c value_type of \c d_first.
+ *
+ * @param[in]     a_first Beginning of the range containing \f$\vec{a}\f$.
+ * @param[in]     a_last  End of the range containing \f$\vec{a}\f$.
+ * @param[in,out] d_first Beginning of the range containing \f$\vec{d}\f$.
+ *                        Also the beginning of the output range to which
+ *                        <strong><tt>n+1</tt></strong> entries will be
+ *                        written.
+ */
+template<class RandomAccessIterator,
+         class ForwardIterator>
+void zohar_linear_solve(RandomAccessIterator a_first,
+                        RandomAccessIterator a_last,
+                        ForwardIterator      d_first)
+{
+    return zohar_linear_solve(a_first, a_last, a_first, d_first);
+}
+
+/**
+ * @}
+ */
+
+/////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Method-specific estimation variance routines following Broersen.
+ *
+ * For details see either the FiniteSampleCriteria.tex write up or Broersen,
+ * P. M. T. "Finite sample criteria for autoregressive order selection." IEEE
+ * Transactions on Signal Processing 48 (December 2000): 3550-3558.
+ * http://dx.doi.org/10.1109/78.887047.
+ *
+ * The selection criteria routines might be sped up for floating point
+ * arguments given an appropriate digamma (psi) or Pochhammer symbol
+ * implementation.  To do so with the GNU Scientific Library (GSL), e.g., try
+ * @code
+ *     #include <gsl/gsl_sf_psi.h>
+ *     #define AR_DIGAMMA(x) gsl_sf_psi(x)
+ *
+ *     #include <gsl/gsl_sf_gamma.h>
+ *     #define AR_POCHHAMMER(a,x) gsl_sf_poch(a,x)
+ * @endcode
+ * before including this header and link the GSL with your binary.
+ * @{
+ */
+
+/** Denotes the sample mean was subtracted from a signal before estimation. */
+struct mean_subtracted
+{
+    /** Computes the empirical variance estimate for order zero. */
+    template <typename Result, typename Integer>
+    static Result empirical_variance_zero(Integer N)
+    {
+        assert(N >= 1);
+
+        Result den = N;
+        return 1 / den;
+    }
+};
+
+/** Denotes the sample mean was retained in a signal during estimation. */
+struct mean_retained
+{
+    /** Computes the empirical variance estimate for order zero. */
+    template <typename Result, typename Integer>
+    static Result empirical_variance_zero(Integer)
+    {
+        return 0;
+    }
+};
+
+namespace { // anonymous
+
+// Oh the simultaneous love/hate because -Werror => -Werror=type-limits...
+
+template <typename T, bool> struct is_nonnegative_helper;
+
+template <typename T> struct is_nonnegative_helper<T, /*signed?*/ true>
+{
+    static bool check(const T& t) { return t >= 0; }
+};
+
+template <typename T> struct is_nonnegative_helper<T, /*signed?*/ false>
+{
+    static bool check(const T&) { return true; }
+};
+
+template <typename T> bool is_nonnegative(const T& t)
+{
+    using std::numeric_limits;
+    return is_nonnegative_helper<T,numeric_limits<T>::is_signed>::check(t);
+}
+
+}
+
+
+/**
+ * A parent type for autoregressive process parameter estimation techniques.
+ *
+ * Each subclass should have an <tt>empirical_variance(N, i)</tt> method
+ * following Broersen, P. M. and H. E. Wensink. "On Finite Sample Theory for
+ * Autoregressive Model Order Selection." IEEE Transactions on Signal
+ * Processing 41 (January 1993): 194+.
+ * http://dx.doi.org/10.1109/TSP.1993.193138.
+ */
+struct estimation_method {};
+
+/** Represents estimation by solving the Yule--Walker equations. */
+template <class MeanHandling>
+class YuleWalker : public estimation_method
+{
+public:
+
+    /**
+     * Approximates the empirical variance estimate.
+     * @param N Number of observations.
+     * @param i Variance order.
+     */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result empirical_variance(Integer1 N, Integer2 i)
+    {
+        assert(N >= 1);
+        assert(is_nonnegative(i));
+        assert(static_cast<Integer1>(i) <= N);
+
+        if (i == 0)
+            return MeanHandling::template empirical_variance_zero<Result>(N);
+
+        Result num = N - i, den = N*(N + 2);
+        return num / den;
+    }
+};
+
+/** Represents estimation using %Burg's recursive method. */
+template <class MeanHandling>
+class Burg : public estimation_method
+{
+public:
+
+    /**
+     * Approximates the empirical variance estimate.
+     * @param N Number of observations.
+     * @param i Variance order.
+     */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result empirical_variance(Integer1 N, Integer2 i)
+    {
+        assert(N >= 1);
+        assert(is_nonnegative(i));
+        assert(static_cast<Integer1>(i) <= N);
+
+        if (i == 0)
+            return MeanHandling::template empirical_variance_zero<Result>(N);
+
+        Result den = N + 1 - i;
+        return 1 / den;
+    }
+};
+
+/** Represents forward and backward prediction least squares minimization. */
+template <class MeanHandling>
+class LSFB : public estimation_method
+{
+public:
+
+    /**
+     * Approximates the empirical variance estimate.
+     * @param N Number of observations.
+     * @param i Variance order.
+     */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result empirical_variance(Integer1 N, Integer2 i)
+    {
+        assert(N >= 1);
+        assert(is_nonnegative(i));
+        assert(static_cast<Integer1>(i) <= N);
+
+        if (i == 0)
+            return MeanHandling::template empirical_variance_zero<Result>(N);
+
+        // Factorizing expression will cause problems in unsigned arithmetic
+        Result den = N + Result(3)/2 - Result(3)/2 * i;
+        return 1 / den;
+    }
+};
+
+/** Represents forward prediction least squares minimization. */
+template <class MeanHandling>
+class LSF : public estimation_method
+{
+public:
+
+    /**
+     * Approximates the empirical variance estimate.
+     * @param N Number of observations.
+     * @param i Variance order.
+     */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result empirical_variance(Integer1 N, Integer2 i)
+    {
+        assert(N >= 1);
+        assert(is_nonnegative(i));
+        assert(static_cast<Integer1>(i) <= N);
+
+        if (i == 0)
+            return MeanHandling::template empirical_variance_zero<Result>(N);
+
+        // Factorizing expression will cause problems in unsigned arithmetic
+        Result den = N + 2 - 2*i;
+        return 1 / den;
+    }
+};
+
+/** An STL-ready binary_function for a given method's empirical variance. */
+template <class EstimationMethod,
+          typename Result,
+          typename Integer1 = std::size_t,
+          typename Integer2 = Integer1>
+struct empirical_variance_function
+    : public std::binary_function<Result,Integer1,Integer2>
+{
+    Result operator() (Integer1 N, Integer2 i) const
+    {
+        return EstimationMethod::template empirical_variance<Result>(N, i);
+    }
+};
+
+/**
+ * An STL AdaptableGenerator for a given method's empirical variance.
+ *
+ * On each <tt>operator()</tt> invocation the method's empirical variance is
+ * returned for the current model order.  The first invocation returns the
+ * result for model order zero.
+ */
+template <class EstimationMethod,
+          typename Result,
+          typename Integer1 = std::size_t,
+          typename Integer2 = Integer1>
+class empirical_variance_generator
+{
+private:
+
+    Integer1 N;
+    Integer2 i;
+
+public:
+
+    typedef Result result_type;
+
+    empirical_variance_generator(Integer1 N) : N(N), i(0) {}
+
+    Result operator() ()
+    {
+        return EstimationMethod::template empirical_variance<Result>(N, i++);
+    }
+};
+
+/**
+ * An immutable RandomAccessIterator over a method's empirical variance
+ * sequence.
+ *
+ * Facilitates using algorithms like <tt>std::copy</tt>,
+ * <tt>std::accumulate</tt>, and <tt>std::partial_sum</tt> when comparing a
+ * hierarchy of models during model order selection.
+ *
+ * The (N+1)-length sequence of orders 0, 1, ..., N is iterated given sample
+ * size N.  Default constructed instances represent past-end iterators.
+ */
+template <class EstimationMethod,
+          typename Result,
+          typename Integer1 = std::size_t,
+          typename Integer2 = Integer1>
+class empirical_variance_iterator
+    : public std::iterator<std::random_access_iterator_tag, Result,
+                           std::ptrdiff_t, const Result*, const Result&>
+{
+private:
+    typedef std::iterator<std::random_access_iterator_tag, Result,
+                          std::ptrdiff_t, const Result*, const Result&> base;
+
+    Integer1 N;
+    Integer2 i;
+
+public:
+    typedef typename base::difference_type   difference_type;
+    typedef typename base::iterator_category iterator_category;
+    typedef typename base::pointer           pointer;
+    typedef typename base::reference         reference;
+    typedef typename base::value_type        value_type;
+
+    /** Construct a past-end iterator */
+    empirical_variance_iterator() : N(0), i(1) {}  // Null
+
+    /** Construct an iterator over sequence order 0, 1, ..., N (inclusive). */
+    empirical_variance_iterator(Integer1 N) : N(N), i(0)
+        { assert(N >= 1); }
+
+    /** Construct an iterator over sequence order i, i+1, ..., N (inclusive). */
+    empirical_variance_iterator(Integer1 N, Integer2 i) : N(N), i(i) {}
+
+    // Forward traversal
+
+    empirical_variance_iterator& operator++()
+        { assert(N >= 1); ++i; return *this; }
+
+    empirical_variance_iterator operator++(int)
+        { assert(N >= 1); return empirical_variance_iterator(N, i++); }
+
+    empirical_variance_iterator operator+(const difference_type& k)
+        { assert(N >= 1); return empirical_variance_iterator(N, i + k); }
+
+    empirical_variance_iterator& operator+=(const difference_type& k)
+        { assert(N >= 1); i += k; return *this; }
+
+    // Backward traversal
+
+    empirical_variance_iterator& operator--()
+        { assert(N >= 1); --i; return *this; }
+
+    empirical_variance_iterator operator--(int)
+        { assert(N >= 1); return empirical_variance_iterator(N, i--); }
+
+    empirical_variance_iterator operator-(const difference_type& k)
+        { assert(N >= 1); return empirical_variance_iterator(N, i - k); }
+
+    empirical_variance_iterator& operator-=(const difference_type& k)
+        { assert(N >= 1); i -= k; return *this; }
+
+    // Distance support
+
+    difference_type operator-(const empirical_variance_iterator& other) const
+    {
+        if (!this->N) {
+            return 1 + other.N - other.i;
+        } else if (!other.N) {
+            return -static_cast<difference_type>(1 + this->N - this->i);
+        } else {
+            assert(this->N == other.N);
+            return this->i - other.i;
+        }
+    }
+
+    // EqualityComparable
+
+    bool operator==(const empirical_variance_iterator& other) const
+    {
+        if (!this->N) {
+            return other.i >= static_cast<Integer2>(other.N + 1);
+        } else if (!other.N) {
+            return this->i >= static_cast<Integer2>(this->N + 1);
+        } else {
+            return this->N == other.N && this->i == other.i;
+        }
+    }
+
+    bool operator!=(const empirical_variance_iterator& other) const
+        { return !(*this == other); }
+
+    // LessThanComparable will trigger assertion on nonsense N cases
+
+    bool operator<(const empirical_variance_iterator& other) const
+        { return (*this - other) < 0; }
+
+    bool operator<=(const empirical_variance_iterator& other) const
+        { return (*this - other) <= 0; }
+
+    bool operator>(const empirical_variance_iterator& other) const
+        { return (*this - other) > 0; }
+
+    bool operator>=(const empirical_variance_iterator& other) const
+        { return (*this - other) >= 0; }
+
+    // Dereference operations
+
+    const value_type operator*() const
+    {
+        assert(is_nonnegative(i));
+        assert(i <= static_cast<Integer2>(N));
+
+        return EstimationMethod::template empirical_variance<Result>(N, i);
+    }
+
+    const value_type operator[](const difference_type &k) const
+    {
+        assert(is_nonnegative(i + k));
+        assert(i + k <= static_cast<Integer2>(N));
+
+        return EstimationMethod::template empirical_variance<Result>(N, i + k);
+    }
+};
+
+/**
+ * @}
+ */
+
+/////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Criteria for autoregressive model order selection following Broersen.
+ *
+ * For details see either the FiniteSampleCriteria.tex write up or Broersen,
+ * P. M. T. "Finite sample criteria for autoregressive order selection." IEEE
+ * Transactions on Signal Processing 48 (December 2000): 3550-3558.
+ * http://dx.doi.org/10.1109/78.887047.
+ *
+ * @{
+ */
+
+/**
+ * A parent type for autoregressive model selection criterion.
+ *
+ * Each subclass should have an <tt>overfit_penalty(N, p)</tt> method
+ * following Broersen, P. M. and H. E. Wensink. "On Finite Sample Theory for
+ * Autoregressive Model Order Selection." IEEE Transactions on Signal
+ * Processing 41 (January 1993): 194+.
+ * http://dx.doi.org/10.1109/TSP.1993.193138.
+ */
+struct criterion
+{
+    /** Compute the underfit penalty given \f$\sigma^2_\epsilon\f$. */
+    template <typename Result, typename Input>
+    static Result underfit_penalty(Input sigma2e)
+    {
+        using std::log;
+        return log(Result(sigma2e));
+    }
+};
+
+/**
+ * Evaluate a given \ref criterion for \c N samples and model order \c p.
+ *
+ * @param[in] sigma2e The residual \f$\sigma^2_\epsilon\f$
+ * @param[in] N       Sample count used to compute \f$\sigma^2_\epsilon\f$
+ * @param[in] p       The model order use to compute \f$sigma^2_\epsilon\f$
+ *
+ * @return the evaluated criterion.
+ */
+template <class    Criterion,
+          typename Result,
+          typename Integer1,
+          typename Integer2>
+Result evaluate(Result sigma2e, Integer1 N, Integer2 p)
+{
+    Result underfit = Criterion::template underfit_penalty<Result>(sigma2e);
+    Result overfit  = Criterion::template overfit_penalty<Result>(N, p);
+    return underfit + overfit;
+}
+
+/**
+ * Represents the generalized information criterion (GIC).  The penalty factor
+ * \f$\alpha\f$ is controlled by <tt>AlphaNumerator / AlphaDenominator</tt>.
+ */
+template <int AlphaNumerator = 3, int AlphaDenominator = 1>
+struct GIC : public criterion
+{
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        return Result(AlphaNumerator) * p / (N * AlphaDenominator);
+    }
+};
+
+/** Represents the Akaike information criterion (AIC). */
+struct AIC : public GIC<2> {};
+
+/** Represents the consistent criterion BIC. */
+struct BIC : public criterion
+{
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        using std::log;
+        return log(Result(N)) * p / N;
+    }
+};
+
+/** Represents the minimally consistent criterion (MCC). */
+struct MCC : public criterion
+{
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        using std::log;
+        return 2*log(log(Result(N))) * p / N;
+    }
+};
+
+/**
+ * Represents the asymptotically-corrected Akaike information criterion (AICC).
+ */
+struct AICC : public criterion
+{
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        return 2 * Result(p) / (N - p - 1);
+    }
+};
+
+/**
+ * Represents the finite information criterion (FIC) as applied to a particular
+ * \ref estimation_method.  The penalty factor \f$\alpha\f$ is controlled by
+ * <tt>AlphaNumerator / AlphaDenominator</tt>.
+ */
+template <class EstimationMethod,
+          int AlphaNumerator = 3,
+          int AlphaDenominator = 1 >
+struct FIC : public criterion
+{
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        // This accumulate invocation is inefficient but always correct
+        using std::accumulate;
+        typedef empirical_variance_iterator<
+                EstimationMethod, Result, Integer1, Integer2
+            > evi_type;
+        Result sum = accumulate(evi_type(N), evi_type(N) + p, Result(0));
+
+        return AlphaNumerator * sum / AlphaDenominator;
+    }
+};
+
+/**
+ * Represents the finite information criterion (FIC) as applied to the \ref
+ * YuleWalker \ref estimation_method.  The penalty factor \f$\alpha\f$ is
+ * controlled by <tt>AlphaNumerator / AlphaDenominator</tt>.
+ */
+template <class MeanHandling,
+          int AlphaNumerator,
+          int AlphaDenominator>
+struct FIC<YuleWalker<MeanHandling>, AlphaNumerator, AlphaDenominator>
+    : public criterion
+{
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        Result v0  = YuleWalker<MeanHandling>
+            ::template empirical_variance<Result>(N, Integer2(0));
+
+        Result num = (2*N - p - 1)*p;  // Avoids non-positive values
+        Result den = 2*N*(N + 2);
+
+        return AlphaNumerator * (v0 + num/den) / AlphaDenominator;
+    }
+};
+
+// Specializations of the FIC for efficiency when digamma is available.
+#ifdef AR_DIGAMMA
+
+/**
+ * Represents the finite information criterion (FIC) as applied to the \ref
+ * Burg \ref estimation_method.  The penalty factor \f$\alpha\f$ is controlled
+ * by <tt>AlphaNumerator / AlphaDenominator</tt>.
+ */
+template <class MeanHandling,
+          int AlphaNumerator,
+          int AlphaDenominator>
+struct FIC<Burg<MeanHandling>, AlphaNumerator, AlphaDenominator>
+    : public criterion
+{
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        Result t  = Burg<MeanHandling>
+            ::template empirical_variance<Result>(N, Integer2(0));
+        t -= AR_DIGAMMA(N + 1);
+        t += AR_DIGAMMA(N + 1 - p);
+        return AlphaNumerator * t / AlphaDenominator;
+    }
+};
+
+/**
+ * Represents the finite information criterion (FIC) as applied to the \ref
+ * LSFB \ref estimation_method.  The penalty factor \f$\alpha\f$ is controlled
+ * by <tt>AlphaNumerator / AlphaDenominator</tt>.
+ */
+template <class MeanHandling,
+          int AlphaNumerator,
+          int AlphaDenominator>
+struct FIC<LSFB<MeanHandling>, AlphaNumerator, AlphaDenominator>
+    : public criterion
+{
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        Result t  = LSFB<MeanHandling>
+            ::template empirical_variance<Result>(N, Integer2(0));
+        Result a = AR_DIGAMMA((3 + 2*N) / Result(3)    );
+        Result b = AR_DIGAMMA((3 + 2*N) / Result(3) - p);
+        return AlphaNumerator * (t - 2*(a - b)/3) / AlphaDenominator;
+    }
+};
+
+/**
+ * Represents the finite information criterion (FIC) as applied to the \ref
+ * LSF \ref estimation_method.  The penalty factor \f$\alpha\f$ is controlled
+ * by <tt>AlphaNumerator / AlphaDenominator</tt>.
+ */
+template <class MeanHandling,
+          int AlphaNumerator,
+          int AlphaDenominator>
+struct FIC<LSF<MeanHandling>, AlphaNumerator, AlphaDenominator>
+    : public criterion
+{
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        Result t  = LSF<MeanHandling>
+            ::template empirical_variance<Result>(N, Integer2(0));
+        Result a = AR_DIGAMMA((2 + N) / Result(2)    );
+        Result b = AR_DIGAMMA((2 + N) / Result(2) - p);
+        return AlphaNumerator * (t - (a - b)/2) / AlphaDenominator;
+    }
+};
+
+#endif /* AR_DIGAMMA */
+
+/**
+ * Represents the finite sample information criterion (FSIC) as applied to a
+ * particular \ref estimation_method.
+ */
+template <class EstimationMethod>
+struct FSIC : public criterion
+{
+
+private:
+
+    /** A helper to compute \f$\frac{1+v}{1-v}\f$ for the method in use. */
+    template <typename Result, typename Integer1, typename Integer2>
+    class product_iterator
+        : public empirical_variance_iterator<
+                EstimationMethod, Result, Integer1, Integer2
+          >
+    {
+    private:
+        typedef empirical_variance_iterator<
+                EstimationMethod, Result, Integer1, Integer2
+            > base;
+
+    public:
+        typedef typename base::difference_type   difference_type;
+        typedef typename base::iterator_category iterator_category;
+        typedef typename base::pointer           pointer;
+        typedef typename base::reference         reference;
+        typedef typename base::value_type        value_type;
+
+        product_iterator(Integer1 N) : base(N) {}
+
+        value_type operator*() const
+        {
+            const value_type v = this->base::operator*();
+            return (1 + v) / (1 - v);
+        }
+
+        value_type operator[](const difference_type &k) const
+        {
+            const value_type v = this->base::operator[](k);
+            return (1 + v) / (1 - v);
+        }
+
+    };
+
+public:
+
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        // This accumulate invocation is inefficient but always correct
+        using std::multiplies;
+        using std::accumulate;
+        product_iterator<Result, Integer1, Integer2> first(N), last(N);
+        last += p; // Avoids overloading requirements for (last + p)
+
+        return accumulate(first, last, Result(1), multiplies<Result>()) - 1;
+    }
+};
+
+// Specializations of the FIC for efficiency when Pochhammer is available.
+#ifdef AR_POCHHAMMER
+
+/**
+ * Represents the finite information criterion (FSIC) as applied to the \ref
+ * YuleWalker \ref estimation_method.
+ */
+template <class MeanHandling>
+struct FSIC<YuleWalker<MeanHandling> > : public criterion
+{
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        Result v0  = YuleWalker<MeanHandling>
+            ::template empirical_variance<Result>(N, Integer2(0));
+        Result a = AR_POCHHAMMER(N*(N+3) - p, p);
+        Result b = AR_POCHHAMMER(Result(1 + N) - N*N);
+
+        return (1 + v0) / (1 - v0) * (a / b) - 1;
+    }
+};
+
+/**
+ * Represents the finite information criterion (FSIC) as applied to the \ref
+ * Burg \ref estimation_method.
+ */
+template <class MeanHandling>
+struct FSIC<Burg<MeanHandling> > : public criterion
+{
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        Result v0  = Burg<MeanHandling>
+            ::template empirical_variance<Result>(N, Integer2(0));
+        Result a = AR_POCHHAMMER(-Result(1) - N, p);
+        Result b = AR_POCHHAMMER( Result(1) - N, p);
+
+        return (1 + v0) / (1 - v0) * (a / b) - 1;
+    }
+};
+
+/**
+ * Represents the finite information criterion (FSIC) as applied to the \ref
+ * LSFB \ref estimation_method.
+ */
+template <class MeanHandling>
+struct FSIC<LSFB<MeanHandling> > : public criterion
+{
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        Result v0  = LSFB<MeanHandling>
+            ::template empirical_variance<Result>(N, Integer2(0));
+        Result a = AR_POCHHAMMER((-Result(2)-2*N)/3, p);
+        Result b = AR_POCHHAMMER(( Result(2)-2*N)/3, p);
+
+        return (1 + v0) / (1 - v0) * (a / b) - 1;
+    }
+};
+
+/**
+ * Represents the finite information criterion (FSIC) as applied to the \ref
+ * LSF \ref estimation_method.
+ */
+template <class MeanHandling>
+struct FSIC<LSF<MeanHandling> > : public criterion
+{
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        Result v0  = LSF<MeanHandling>
+            ::template empirical_variance<Result>(N, Integer2(0));
+        Result a = AR_POCHHAMMER((-Result(1)-N)/2, p);
+        Result b = AR_POCHHAMMER(( Result(1)-N)/2, p);
+
+        return (1 + v0) / (1 - v0) * (a / b) - 1;
+    }
+};
+
+#endif /* AR_POCHHAMMER */
+
+
+/**
+ * Represents the combined information criterion (CIC) as applied to a
+ * particular \ref estimation_method.
+ */
+template <class EstimationMethod>
+struct CIC : public criterion
+{
+    /** Compute overfit penalty given \c N observations at model order \c p. */
+    template <typename Result, typename Integer1, typename Integer2>
+    static Result overfit_penalty(Integer1 N, Integer2 p)
+    {
+        using std::max;
+        return max(
+                FSIC<EstimationMethod>::template overfit_penalty<Result>(N, p),
+                FIC <EstimationMethod>::template overfit_penalty<Result>(N, p)
+            );
+    }
+};
+
+// Helpers for overfit_penalty_table building tables in O(maxorder) whenever
+// a criterion has no closed form.  Each table entry is computed using
+// exactly the operations of the criterion's overfit_penalty.
+namespace
+{
+
+/** Tabulate by invoking \c overfit_penalty for every order. */
+template <class Criterion, typename Result>
+void overfit_penalty_loop(const std::size_t    N,
+                          const std::size_t    maxorder,
+                          std::vector<Result>& table)
+{
+    table.resize(maxorder + 1);
+    for (std::size_t p = 0; p <= maxorder; ++p)
+        table[p] = Criterion::template overfit_penalty<Result>(N, p);
+}
+
+/** By default tabulate by directly invoking \c overfit_penalty. */
+template <class Criterion>
+struct penalty_table_builder
+{
+    template <typename Result>
+    static void build(const std::size_t    N,
+                      const std::size_t    maxorder,
+                      std::vector<Result>& table)
+    {
+        overfit_penalty_loop<Criterion>(N, maxorder, table);
+    }
+};
+
+#ifndef AR_DIGAMMA
+
+/** Accumulate the FIC sum of empirical variances incrementally. */
+template <class EstimationMethod, int AlphaNumerator, int AlphaDenominator>
+struct penalty_table_builder<
+        FIC<EstimationMethod, AlphaNumerator, AlphaDenominator> >
+{
+    template <typename Result>
+    static void build(const std::size_t    N,
+                      const std::size_t    maxorder,
+                      std::vector<Result>& table)
+    {
+        table.resize(maxorder + 1);
+        Result sum = 0;
+        for (std::size_t p = 0; p <= maxorder; ++p)
+        {
+            table[p] = AlphaNumerator * sum / AlphaDenominator;
+            if (p < maxorder)
+                sum = sum + EstimationMethod
+                    ::template empirical_variance<Result>(N, p);
+        }
+    }
+};
+
+#endif /* AR_DIGAMMA */
+
+/** The YuleWalker FIC has a closed form which must be used as is. */
+template <class MeanHandling, int AlphaNumerator, int AlphaDenominator>
+struct penalty_table_builder<
+        FIC<YuleWalker<MeanHandling>, AlphaNumerator, AlphaDenominator> >
+{
+    template <typename Result>
+    static void build(const std::size_t    N,
+                      const std::size_t    maxorder,
+                      std::vector<Result>& table)
+    {
+        overfit_penalty_loop<
+                FIC<YuleWalker<MeanHandling>,AlphaNumerator,AlphaDenominator>
+            >(N, maxorder, table);
+    }
+};
+
+#ifndef AR_POCHHAMMER
+
+/** Accumulate the FSIC product of \f$\frac{1+v}{1-v}\f$ incrementally. */
+template <class EstimationMethod>
+struct penalty_table_builder<FSIC<EstimationMethod> >
+{
+    template <typename Result>
+    static void build(const std::size_t    N,
+                      const std::size_t    maxorder,
+                      std::vector<Result>& table)
+    {
+        table.resize(maxorder + 1);
+        Result product = 1;
+        for (std::size_t p = 0; p <= maxorder; ++p)
+        {
+            table[p] = product - 1;
+            if (p < maxorder)
+            {
+                const Result v = EstimationMethod
+                    ::template empirical_variance<Result>(N, p);
+                product = product * ((1 + v) / (1 - v));
+            }
+        }
+    }
+};
+
+#endif /* AR_POCHHAMMER */
+
+/** Combine the FSIC and FIC tables elementwise. */
+template <class EstimationMethod>
+struct penalty_table_builder<CIC<EstimationMethod> >
+{
+    template <typename Result>
+    static void build(const std::size_t    N,
+                      const std::size_t    maxorder,
+                      std::vector<Result>& table)
+    {
+        using std::max;
+        std::vector<Result> fic;
+        penalty_table_builder<FSIC<EstimationMethod> >::build(
+                N, maxorder, table);
+        penalty_table_builder<FIC<EstimationMethod> >::build(
+                N, maxorder, fic);
+        for (std::size_t p = 0; p <= maxorder; ++p)
+            table[p] = max(table[p], fic[p]);
+    }
+};
+
+}
+
+/**
+ * Tabulate the overfit penalty of a \ref criterion for \c N samples at
+ * model orders zero through \c maxorder, inclusive.  Criteria lacking closed
+ * forms, like \ref FSIC, \ref FIC, and so \ref CIC absent \c AR_POCHHAMMER
+ * or \c AR_DIGAMMA, are tabulated in <tt>O(maxorder)</tt> time by
+ * incrementally updating their products or sums rather than in the
+ * <tt>O(maxorder^2)</tt> time taken by invoking \c overfit_penalty for each
+ * order.  Entries are bit-for-bit identical to those invocations.
+ *
+ * @param[in]  N        Sample count used to compute \f$\sigma^2_\epsilon\f$.
+ * @param[in]  maxorder Maximum model order, at most <tt>N-1</tt> unless
+ *                      zero.
+ * @param[out] table    Resized to hold <tt>maxorder + 1</tt> penalties.
+ */
+template <class Criterion, typename Result>
+void overfit_penalty_table(const std::size_t    N,
+                           const std::size_t    maxorder,
+                           std::vector<Result>& table)
+{
+    penalty_table_builder<Criterion>::template build<Result>(
+            N, maxorder, table);
+}
+
+/**
+ * A cached table of a \ref criterion's overfit penalties permitting each
+ * model to be evaluated in constant time.  Evaluation is bit-for-bit
+ * identical to \ref evaluate.  The table is keyed by the criterion's \ref
+ * overfit_penalty_table function, which fixes the criterion, its estimation
+ * method, and mean handling, alongside \c N and the maximum order.  Calling
+ * \ref assign with a matching key performs no work, so a table held across
+ * many signals sharing \c N and the maximum order is built only once.
+ */
+template <typename Value>
+class penalty_table
+{
+public:
+
+    /** Builds a table as does \ref overfit_penalty_table. */
+    typedef void (*builder)(std::size_t N, std::size_t maxorder,
+                            std::vector<Value>& table);
+
+    /** Construct an empty table. */
+    penalty_table() : build(NULL), N_(0) {}
+
+    /** Construct a table using \c build for \c N and \c maxorder. */
+    penalty_table(builder build, std::size_t N, std::size_t maxorder)
+        : build(NULL), N_(0)
+    {
+        assign(build, N, maxorder);
+    }
+
+    /**
+     * Ensure the table holds penalties from \c build for \c N and orders
+     * zero through at least \c maxorder, rebuilding only when necessary.
+     * Returns whether the table was rebuilt.
+     */
+    bool assign(builder build, std::size_t N, std::size_t maxorder)
+    {
+        if (build == this->build && N == N_ && maxorder < table.size())
+            return false;
+        build(N, maxorder, table);
+        this->build = build;
+        N_ = N;
+        return true;
+    }
+
+    /** Sample count for which the table was built. */
+    std::size_t N() const { return N_; }
+
+    /** Maximum model order within the table. */
+    std::size_t maxorder() const { return table.size() - 1; }
+
+    /** The overfit penalty at model order \c p. */
+    Value overfit_penalty(const std::size_t p) const
+    {
+        assert(p < table.size());
+        return table[p];
+    }
+
+    /** Evaluate the criterion given \f$\sigma^2_\epsilon\f$ at order \c p. */
+    Value operator()(const Value sigma2e, const std::size_t p) const
+    {
+        assert(p < table.size());
+        return criterion::underfit_penalty<Value>(sigma2e) + table[p];
+    }
+
+private:
+    builder            build;
+    std::size_t        N_;
+    std::vector<Value> table;
+};
+
+/**
+ * @}
+ */
+
+/////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Algorithmic helpers for autoregressive model order selection.
+ *
+ * @{
+ */
+
+/**
+ * Evaluate a \ref criterion on a hierarchy of models given
+ * \f$\sigma^2_\epsilon\f$ for each model.  The index of the best model, i.e.
+ * the one with minimum criterion value, is returned.
+ *
+ * @param[in]  N        Sample count used to compute \f$\sigma^2_\epsilon\f$.
+ * @param[in]  ordfirst The model order corresponding to \c first.
+ *                      When \f$\sigma^2_\epsilon\f$ is produced entirely by
+ *                      \ref burg_method with <tt>hierarchy == true</tt>,
+ *                      this should be \c 0.
+ * @param[in]  first    Beginning of the range holding \f$\sigma^2_\epsilon\f$
+ * @param[in]  last     Exclusive end of input range.
+ * @param[out] crit     Value assigned to each model by the criterion.
+ *
+ * @return The distance from \c first to the best model.
+ *         An obscenely negative value is returned on error.
+ */
+template <class    Criterion,
+          typename Integer1,
+          typename Integer2,
+          class    InputIterator,
+          class    OutputIterator>
+typename std::iterator_traits<InputIterator>::difference_type
+evaluate_models(Integer1       N,
+                Integer2       ordfirst,
+                InputIterator  first,
+                InputIterator  last,
+                OutputIterator crit)
+{
+    using std::iterator_traits;
+    using std::numeric_limits;
+
+    typedef InputIterator iterator;
+    typedef typename iterator_traits<iterator>::difference_type difference_type;
+    typedef typename iterator_traits<iterator>::value_type      value_type;
+
+    // Short circuit on trivial input
+    if (first == last)
+        return numeric_limits<difference_type>::min();
+
+    // Handle first iteration without comparison as AICC blows up on N == 1
+    value_type best_val = evaluate<Criterion>(*first++, N, ordfirst);
+    difference_type best_pos = 0, dist = 0;
+
+    // Scan through rest of candidates (up to order N-1) updating best as we go
+    while (first != last && static_cast<Integer1>(++dist) < N)
+    {
+        value_type candidate = evaluate<Criterion>(*first++, N, dist+ordfirst);
+        *crit++ = candidate;
+
+        if (candidate < best_val) {
+            best_val = candidate;
+            best_pos = dist;
+        }
+    }
+
+    return best_pos;
+}
+
+/**
+ * Evaluate a tabulated \ref criterion on a hierarchy of models given
+ * \f$\sigma^2_\epsilon\f$ for each model.  Behavior is identical to \ref
+ * evaluate_models(Integer1,Integer2,InputIterator,InputIterator,OutputIterator)
+ * for the criterion and \c N fixed by \c table but each model costs only
+ * a lookup.  The table must cover every model order evaluated.
+ *
+ * @param[in]  table    Overfit penalties built per \ref penalty_table.
+ * @param[in]  ordfirst The model order corresponding to \c first.
+ * @param[in]  first    Beginning of the range holding \f$\sigma^2_\epsilon\f$
+ * @param[in]  last     Exclusive end of input range.
+ * @param[out] crit     Value assigned to each model by the criterion.
+ *
+ * @return The distance from \c first to the best model.
+ *         An obscenely negative value is returned on error.
+ */
+template <typename Value,
+          typename Integer2,
+          class    InputIterator,
+          class    OutputIterator>
+typename std::iterator_traits<InputIterator>::difference_type
+evaluate_models(const penalty_table<Value>& table,
+                Integer2                    ordfirst,
+                InputIterator               first,
+                InputIterator               last,
+                OutputIterator              crit)
+{
+    using std::iterator_traits;
+    using std::numeric_limits;
+    using std::size_t;
+
+    typedef InputIterator iterator;
+    typedef typename iterator_traits<iterator>::difference_type difference_type;
+    typedef typename iterator_traits<iterator>::value_type      value_type;
+
+    // Short circuit on trivial input
+    if (first == last)
+        return numeric_limits<difference_type>::min();
+
+    // Handle first iteration without comparison as AICC blows up on N == 1
+    const size_t N = table.N();
+    value_type best_val = table(*first++, ordfirst);
+    difference_type best_pos = 0, dist = 0;
+
+    // Scan through rest of candidates (up to order N-1) updating best as we go
+    while (first != last && static_cast<size_t>(++dist) < N)
+    {
+        value_type candidate = table(*first++, dist+ordfirst);
+        *crit++ = candidate;
+
+        if (candidate < best_val) {
+            best_val = candidate;
+            best_pos = dist;
+        }
+    }
+
+    return best_pos;
+}
+
+/**
+ * Obtain the best model according to \ref criterion applied to
+ * \f$\sigma^2_\epsilon\f$ given a hierarchy of candidates.
+ *
+ * On input, \c params, \c sigma2e, \c gain, and \c autocor should be <a
+ * href="http://www.sgi.com/tech/stl/Sequence.html">Sequence</a>s which were
+ * populated by \ref burg_method when \c hierarchy is \c true (or in some other
+ * equivalent manner).  On output, these arguments will contain only values
+ * relevant to the best model.
+ *
+ * @param[in]     N        Sample count used to compute \f$\sigma^2_\epsilon\f$.
+ *                         For example, the return value of \ref burg_method.
+ * @param[in]     minorder Constrain the best model to be at least this order.
+ *                         Supplying zero specifies no constraint.
+ * @param[in,out] params   Model parameters
+ * @param[in,out] sigma2e  \f$\sigma^2_\epsilon\f$
+ * @param[in,out] gain     Model gain
+ * @param[in,out] autocor  Model autocorrelations
+ * @param[out]    crit     Value assigned to each model by the criterion.
+ *
+ * @return The index of the best criterion value within \c crit.
+ */
+template <class    Criterion,
+          typename Integer1,
+          typename Integer2,
+          class    Sequence1,
+          class    Sequence2,
+          class    Sequence3,
+          class    Sequence4,
+          class    OutputIterator>
+typename Sequence1::difference_type
+best_model(Integer1       N,
+           Integer2       minorder,
+           Sequence1&     params,
+           Sequence2&     sigma2e,
+           Sequence3&     gain,
+           Sequence4&     autocor,
+           OutputIterator crit)
+{
+    using std::advance;
+    using std::copy_backward;
+    using std::invalid_argument;
+    using std::size_t;
+
+    // Ensure all inputs have conformant sizes
+    // Sanity checks written to provide order messages readable by end users
+    AR_ENSURE_ARG(sigma2e.size() > 0);
+    const size_t maxorder = sigma2e.size() - 1;
+    AR_ENSURE_ARG(is_nonnegative(minorder));
+    AR_ENSURE_ARG(static_cast<size_t>(minorder) <= maxorder);
+    AR_ENSURE_ARG(params .size() == (sigma2e.size()-1)*sigma2e.size()/2);
+    AR_ENSURE_ARG(gain   .size() == sigma2e.size());
+    AR_ENSURE_ARG(autocor.size() == sigma2e.size());
+
+    // Find the best model index according to the given minorder and criterion
+    typename Sequence1::difference_type best = minorder;
+    {
+        typename Sequence2::iterator iter = sigma2e.begin();
+        advance(iter, minorder);
+        best += evaluate_models<Criterion>(N, minorder, iter,
+                                           sigma2e.end(), crit);
+    }
+
+    // Now trim away everything and leaving only the best model in Sequences...
+
+    // ...first in params...
+    {
+        // Best parameters might overlap beginning of params so copy_backwards.
+        // AR(0) is trivial and AR(1) starts at params.begin(), hence off by 1.
+        typename Sequence1::iterator first  = params.begin();
+        typename Sequence1::iterator last   = params.begin();
+        typename Sequence1::iterator result = params.begin();
+        advance(first,  ((best-1)*best)/2       );
+        advance(last,   ((best-1)*best)/2 + best);
+        advance(result,                     best);
+        copy_backward(first, last, result);
+        params.resize(best);
+    }
+
+    // ...next in sigma2e...
+    {
+        typename Sequence2::iterator cursor = sigma2e.begin();
+        advance(cursor, best);
+        *sigma2e.begin() = *cursor;
+        sigma2e.resize(1);
+    }
+
+    // ...next in gain...
+    {
+        typename Sequence2::iterator cursor = gain.begin();
+        advance(cursor, best);
+        *gain.begin() = *cursor;
+        gain.resize(1);
+    }
+
+    // ...and last in autocor...
+    autocor.resize(best + 1);
+
+    // ...but notice that resizing does not free capacity for std::vectors.
+
+    return best;
+}
+
+namespace { // anonymous
+
+// Used to discard output per http://stackoverflow.com/questions/335930/
+struct null_output : std::iterator< std::output_iterator_tag, null_output >
+{
+    template <typename T> void operator=(const T&) {}
+
+    null_output& operator++()
+        { return *this; }
+
+    null_output operator++(int)
+        { null_output it(*this); ++*this; return it; }
+
+    null_output& operator*()
+        { return *this; }
+};
+
+}
+
+/**
+ * Find the index of the best model from a hierarchy of candidates according to
+ * a \ref criterion given \f$\sigma^2_\epsilon\f$ for each model.
+ *
+ * @param[in]  N        Sample count used to compute \f$\sigma^2_\epsilon\f$.
+ * @param[in]  ordfirst The model order corresponding to \c first.
+ *                      When \f$sigma^2_\epsilon\f$ is produced entirely by
+ *                      \ref burg_method, this should be \c 0u.
+ * @param[in]  first    Beginning of the range holding \f$\sigma^2_\epsilon\f$
+ * @param[in]  last     Exclusive end of input range.
+ *
+ * @return The distance from \c first to the best model.
+ *
+ * @see evaluate_models(Criterion,Integer1,Integer2,InputIterator,OutputIterator)
+ */
+template <class    Criterion,
+          typename Integer1,
+          typename Integer2,
+          class    InputIterator>
+typename std::iterator_traits<InputIterator>::difference_type
+evaluate_models(Integer1      N,
+                Integer2      ordfirst,
+                InputIterator first,
+                InputIterator last)
+{
+    return evaluate_models<Criterion>(N, ordfirst, first, last, null_output());
+}
+
+/**
+ * Obtain the best model according to \ref criterion applied to
+ * \f$\sigma^2_\epsilon\f$ given a hierarchy of candidates.
+ *
+ * On input, \c params, \c sigma2e, \c gain, and \c autocor should be <a
+ * href="http://www.sgi.com/tech/stl/Sequence.html">Sequence</a>s which were
+ * populated by \ref burg_method when \c hierarchy is \c true (or in some other
+ * equivalent manner).  On output, these arguments will contain only values
+ * relevant to the best model.
+ *
+ * @param[in]     N        Sample count used to compute \f$\sigma^2_\epsilon\f$.
+ *                         For example, the return value of \ref burg_method.
+ * @param[in]     minorder Constrain the best model to be at least this order.
+ *                         Supplying zero specifies no constraint.
+ * @param[in,out] params   Model parameters
+ * @param[in,out] sigma2e  \f$\sigma^2_\epsilon\f$
+ * @param[in,out] gain     Model gain
+ * @param[in,out] autocor  Model autocorrelations
+ *
+ * @return The index of the best model within the inputs.
+ *
+ * @see best_model(Integer1,Integer2,Sequence1,Sequence2,Sequence3,Sequence4,OutputIterator)
+ */
+template <class    Criterion,
+          typename Integer1,
+          typename Integer2,
+          class    Sequence1,
+          class    Sequence2,
+          class    Sequence3,
+          class    Sequence4>
+typename Sequence1::difference_type
+best_model(Integer1       N,
+           Integer2       minorder,
+           Sequence1&     params,
+           Sequence2&     sigma2e,
+           Sequence3&     gain,
+           Sequence4&     autocor)
+{
+    return best_model<Criterion>(N, minorder, params, sigma2e, gain,
+                                 autocor, null_output());
+}
 
-    empirical_variance_iterator& operator++()
-        { assert(N >= 1); ++i; return *this; }
+/**
+ * Obtain the best multivariate model according to \ref criterion given a
+ * hierarchy of candidates from \ref nuttall_strand_method.  Each order
+ * \f$p\f$ is scored by applying \c Criterion to the generalized variance
+ * \f$\left|\Sigma\right|^{1/d}\f$ with \f$pd\f$ parameters per channel.
+ * For \ref AIC this recovers the usual multivariate criterion
+ * \f$\ln\left|\Sigma\right| + 2 p d^2 / N\f$ scaled by \f$1/d\f$.
+ * Orders for which \f$pd \geq N\f$ are not considered.
+ *
+ * On input, \c params and \c sigma2e should be <a
+ * href="http://www.sgi.com/tech/stl/Sequence.html">Sequence</a>s which were
+ * populated by \ref nuttall_strand_method when \c hierarchy is \c true.  On
+ * output, these arguments will contain only values relevant to the best
+ * model.
+ *
+ * @param[in]     N        Sample count returned by \ref nuttall_strand_method.
+ * @param[in]     d        Number of channels.
+ * @param[in]     minorder Constrain the best model to be at least this order.
+ *                         Supplying zero specifies no constraint.
+ * @param[in,out] params   Row-major model parameters
+ * @param[in,out] sigma2e  Row-major innovation covariances
+ *
+ * @return The order of the best model.
+ */
+template <class    Criterion,
+          typename Integer1,
+          typename Integer2,
+          class    Sequence1,
+          class    Sequence2>
+std::size_t
+best_vector_model(Integer1       N,
+                  const std::size_t d,
+                  Integer2       minorder,
+                  Sequence1&     params,
+                  Sequence2&     sigma2e)
+{
+    using std::copy;
+    using std::exp;
+    using std::log;
+    using std::size_t;
 
-    empirical_variance_iterator operator++(int)
-        { assert(N >= 1); return empirical_variance_iterator(N, i++); }
+    typedef typename Sequence2::value_type value_type;
 
-    empirical_variance_iterator operator+(const difference_type& k)
-        { assert(N >= 1); return empirical_variance_iterator(N, i + k); }
+    // Ensure all inputs have conformant sizes
+    AR_ENSURE_ARG(d > 0);
+    const size_t dd = d*d;
+    AR_ENSURE_ARG(sigma2e.size() > 0 && sigma2e.size() % dd == 0);
+    const size_t maxorder = sigma2e.size() / dd - 1;
+    AR_ENSURE_ARG(is_nonnegative(minorder));
+    AR_ENSURE_ARG(static_cast<size_t>(minorder) <= maxorder);
+    AR_ENSURE_ARG(params.size() == dd*maxorder*(maxorder+1)/2);
 
-    empirical_variance_iterator& operator+=(const difference_type& k)
-        { assert(N >= 1); i += k; return *this; }
+    // Score each order by the generalized variance from a Cholesky factor
+    std::vector<value_type> L(dd);
+    size_t best = minorder;
+    value_type best_val = 0;
+    for (size_t p = minorder; p <= maxorder; ++p)
+    {
+        if (p > minorder && p*d >= static_cast<size_t>(N)) break;
+        copy(sigma2e.begin() + p*dd, sigma2e.begin() + (p+1)*dd, L.begin());
+        if (!ns_cholesky(d, &L[0])) break;
+        value_type logdet = 0;
+        for (size_t i = 0; i < d; ++i) logdet += log(L[i*d + i]);
+        const value_type candidate = evaluate<Criterion>(
+                exp(2*logdet/d), N, p*d);
+        if (p == static_cast<size_t>(minorder) || candidate < best_val)
+        {
+            best_val = candidate;
+            best     = p;
+        }
+    }
 
-    // Backward traversal
+    // Trim away everything but the best model
+    copy(params.begin() + dd*(best-1)*best/2,
+         params.begin() + dd*(best-1)*best/2 + dd*best,
+         params.begin());
+    params.resize(dd*best);
+    copy(sigma2e.begin() + best*dd, sigma2e.begin() + (best+1)*dd,
+         sigma2e.begin());
+    sigma2e.resize(dd);
 
-    empirical_variance_iterator& operator--()
-        { assert(N >= 1); --i; return *this; }
+    return best;
+}
 
-    empirical_variance_iterator operator--(int)
-        { assert(N >= 1); return empirical_variance_iterator(N, i--); }
+/**
+ * A template typedef and helper method returning a \ref best_model
+ * implementation matching a model selection criterion provided at runtime.
+ * Intended for use within interactive APIs, this method handles much of the
+ * ugliness of resolving overloaded criterion logic and accounting for which
+ * methods care as to whether or not the sample mean has been subtracted.
+ * Class template parameters should be set to match the desired overload
+ * returned by the \ref lookup method.
+ *
+ * Methods are looked up using their abbreviations as follows:
+ * <dl>
+ * <dt>AIC </dt><dd>Akaike information criterion</dd>
+ * <dt>AICC</dt><dd>asymptotically-corrected Akaike information criterion</dd>
+ * <dt>BIC </dt><dd>consistent criterion BIC</dd>
+ * <dt>CIC </dt><dd>combined information criterion</dd>
+ * <dt>FIC </dt><dd>finite information criterion</dd>
+ * <dt>FSIC</dt><dd>finite sample information criterion</dd>
+ * <dt>GIC </dt><dd>generalized information criterion</dd>
+ * <dt>MCC </dt><dd>minimally consistent criterion</dd>
+ * </dl>
+ * Leading or trailing whitespace as well as capitalization differences are
+ * ignored.
+ *
+ * @tparam EstimationMethod One of Burg, YuleWalker, LSFB, or LSF.
+ * @tparam Integer1         Per the \c Integer1 parameter of \ref best_model
+ * @tparam Integer2         Per the \c Integer2 parameter of \ref best_model
+ * @tparam Sequence1        Per the \c Sequence1 parameter of \ref best_model
+ * @tparam Sequence2        Per the \c Sequence2 parameter of \ref best_model
+ * @tparam Sequence3        Per the \c Sequence3 parameter of \ref best_model
+ * @tparam Sequence4        Per the \c Sequence4 parameter of \ref best_model
+ */
+template <template <class> class EstimationMethod,
+          typename Integer1,
+          typename Integer2,
+          class    Sequence1,
+          class    Sequence2 = Sequence1,
+          class    Sequence3 = Sequence2,
+          class    Sequence4 = Sequence3>
+struct best_model_function
+{
+    /** The type returned by the \ref lookup function. */
+    typedef typename Sequence1::difference_type (*type)(Integer1   N,
+                                                        Integer2   minorder,
+                                                        Sequence1& params,
+                                                        Sequence2& sigma2e,
+                                                        Sequence3& gain,
+                                                        Sequence4& autocor);
 
-    empirical_variance_iterator operator-(const difference_type& k)
-        { assert(N >= 1); return empirical_variance_iterator(N, i - k); }
+    /**
+     * Lookup a \ref best_model function pointer matching \c EstimationMethod,
+     * the specified criterion c abbreviation, and whether or not the sample
+     * mean has been subtracted from the data.
+     *
+     * @param abbreviation  Known abbreviations per \ref best_model_function.
+     *                      If only whitespace, a reasonable default is used.
+     * @param subtract_mean Has the sample mean been subtracted from the data?
+     *
+     * @tparam CharT     Permits use by any \c std::basic_string instantiation
+     * @tparam Traits    Permits use by any \c std::basic_string instantiation
+     * @tparam Allocator Permits use by any \c std::basic_string instantiation
+     *
+     * @return A function pointer which, when invoked, calls \ref best_model.
+     *         When no known criterion matches \c abbreviation, \c NULL
+     *         is returned.
+     */
+    template <class CharT, class Traits, class Allocator>
+    static type lookup(std::basic_string<CharT,Traits,Allocator> abbreviation,
+                       const bool subtract_mean);
 
-    empirical_variance_iterator& operator-=(const difference_type& k)
-        { assert(N >= 1); i -= k; return *this; }
+    /**
+     * Lookup a \ref best_model function pointer matching \c EstimationMethod,
+     * the specified criterion c abbreviation, and whether or not the sample
+     * mean has been subtracted from the data.
+     *
+     * @param abbreviation  Known abbreviations per \ref best_model_function.
+     *                      If only whitespace, a reasonable default is used.
+     * @param subtract_mean Has the sample mean been subtracted from the data?
+     *
+     * @return A function pointer which, when invoked, calls \ref best_model.
+     *         When no known criterion matches \c abbreviation, \c NULL
+     *         is returned.
+     */
+    static type lookup(const char *abbreviation, const bool subtract_mean)
+    {
+        std::string s(abbreviation);
+        return lookup(s, subtract_mean);
+    }
+};
 
-    // Distance support
+// Helper for best_model_function and criterion_function lookups
+namespace
+{
+
+/** Make a criterion abbreviation uppercase and trim its whitespace. */
+template <class CharT, class Traits, class Allocator>
+void canonicalize_criterion(std::basic_string<CharT,Traits,Allocator>& abbrev)
+{
+    using std::basic_string;
+    using std::toupper;
+
+    typedef basic_string<CharT,Traits,Allocator> string_type;
+    for (typename string_type::iterator p = abbrev.begin();
+         abbrev.end() != p; ++p)
+    {
+        *p = toupper(*p);
+    }
+    abbrev.erase(0, abbrev.find_first_not_of(" \n\r\t"));
+    abbrev.erase(1 + abbrev.find_last_not_of(" \n\r\t"));
+}
+
+}
+
+template <template <class> class EstimationMethod,
+          typename Integer1,
+          typename Integer2,
+          class    Sequence1,
+          class    Sequence2,
+          class    Sequence3,
+          class    Sequence4>
+template <class CharT, class Traits, class Allocator>
+typename best_model_function<
+    EstimationMethod,Integer1,Integer2,Sequence1,Sequence2,Sequence3,Sequence4
+>::type
+best_model_function<
+    EstimationMethod,Integer1,Integer2,Sequence1,Sequence2,Sequence3,Sequence4
+>::lookup(std::basic_string<CharT,Traits,Allocator> abbrev,
+          const bool subtract_mean)
+{
+    // Canonicalize the abbreviation by making it uppercase and trimming it
+    // For nothing but this reason the method accepts 'abbrev' by value
+    canonicalize_criterion(abbrev);
+
+    // Obtain best_model(...) per abbrev, subtract_mean, EstimationMethod
+    // and assign to retval to provide unambiguous overload resolution.
+    type retval;
+
+    if      (abbrev.empty() || 0 == abbrev.compare("CIC" ))  // Default
+    {
+        if (subtract_mean)
+            retval = best_model<CIC<EstimationMethod<mean_subtracted> > >;
+        else
+            retval = best_model<CIC<EstimationMethod<mean_retained  > > >;
+    }
+    else if (0 == abbrev.compare("AIC" ))
+    {
+        retval = best_model<AIC>;
+    }
+    else if (0 == abbrev.compare("AICC"))
+    {
+        retval = best_model<AICC>;
+    }
+    else if (0 == abbrev.compare("BIC" ))
+    {
+        retval = best_model<BIC>;
+    }
+    else if (0 == abbrev.compare("FIC" ))
+    {
+        if (subtract_mean)
+            retval = best_model<FIC<EstimationMethod<mean_subtracted> > >;
+        else
+            retval = best_model<FIC<EstimationMethod<mean_retained  > > >;
+    }
+    else if (0 == abbrev.compare("FSIC"))
+    {
+        if (subtract_mean)
+            retval = best_model<FSIC<EstimationMethod<mean_subtracted> > >;
+        else
+            retval = best_model<FSIC<EstimationMethod<mean_retained  > > >;
+    }
+    else if (0 == abbrev.compare("GIC" ))
+    {
+        retval = best_model<GIC<> >;
+    }
+    else if (0 == abbrev.compare("MCC" ))
+    {
+        retval = best_model<MCC>;
+    } else
+    {
+        retval = NULL;
+    }
+
+    return retval;
+}
+
+/**
+ * A template typedef and helper method returning \ref evaluate for a model
+ * selection criterion provided at runtime much as \ref best_model_function
+ * does for \ref best_model.  The result is suitable for selecting models
+ * online using \ref online_best_model.  Abbreviations and the handling of
+ * \c subtract_mean follow \ref best_model_function.  Method \ref
+ * lookup_table similarly returns the matching \ref overfit_penalty_table
+ * for building a \ref penalty_table.
+ *
+ * @tparam EstimationMethod One of Burg, YuleWalker, LSFB, or LSF.
+ * @tparam Value            Precision in which criteria are evaluated.
+ */
+template <template <class> class EstimationMethod,
+          typename Value>
+struct criterion_function
+{
+    /** The type returned by the \ref lookup function. */
+    typedef Value (*type)(Value sigma2e, std::size_t N, std::size_t p);
+
+    /** The type returned by the \ref lookup_table function. */
+    typedef typename penalty_table<Value>::builder table_type;
+
+    /**
+     * Lookup an \ref evaluate function pointer matching \c
+     * EstimationMethod, the specified criterion abbreviation, and whether or
+     * not the sample mean has been subtracted from the data.
+     *
+     * @param abbreviation  Known abbreviations per \ref best_model_function.
+     *                      If only whitespace, a reasonable default is used.
+     * @param subtract_mean Has the sample mean been subtracted from the data?
+     *
+     * @tparam CharT     Permits use by any \c std::basic_string instantiation
+     * @tparam Traits    Permits use by any \c std::basic_string instantiation
+     * @tparam Allocator Permits use by any \c std::basic_string instantiation
+     *
+     * @return A function pointer which, when invoked, calls \ref evaluate.
+     *         When no known criterion matches \c abbreviation, \c NULL
+     *         is returned.
+     */
+    template <class CharT, class Traits, class Allocator>
+    static type lookup(std::basic_string<CharT,Traits,Allocator> abbreviation,
+                       const bool subtract_mean)
+    {
+        return dispatch<evaluator>(abbreviation, subtract_mean);
+    }
 
-    difference_type operator-(const empirical_variance_iterator& other) const
+    /**
+     * Lookup an \ref evaluate function pointer matching \c
+     * EstimationMethod, the specified criterion abbreviation, and whether or
+     * not the sample mean has been subtracted from the data.
+     *
+     * @param abbreviation  Known abbreviations per \ref best_model_function.
+     *                      If only whitespace, a reasonable default is used.
+     * @param subtract_mean Has the sample mean been subtracted from the data?
+     *
+     * @return A function pointer which, when invoked, calls \ref evaluate.
+     *         When no known criterion matches \c abbreviation, \c NULL
+     *         is returned.
+     */
+    static type lookup(const char *abbreviation, const bool subtract_mean)
     {
-        if (!this->N) {
-            return 1 + other.N - other.i;
-        } else if (!other.N) {
-            return -static_cast<difference_type>(1 + this->N - this->i);
-        } else {
-            assert(this->N == other.N);
-            return this->i - other.i;
-        }
+        std::string s(abbreviation);
+        return lookup(s, subtract_mean);
     }
 
-    // EqualityComparable
+    /**
+     * Lookup an \ref overfit_penalty_table function pointer matching \c
+     * EstimationMethod, the specified criterion abbreviation, and whether or
+     * not the sample mean has been subtracted from the data.
+     *
+     * @param abbreviation  Known abbreviations per \ref best_model_function.
+     *                      If only whitespace, a reasonable default is used.
+     * @param subtract_mean Has the sample mean been subtracted from the data?
+     *
+     * @tparam CharT     Permits use by any \c std::basic_string instantiation
+     * @tparam Traits    Permits use by any \c std::basic_string instantiation
+     * @tparam Allocator Permits use by any \c std::basic_string instantiation
+     *
+     * @return A function pointer suitable for \ref penalty_table::assign.
+     *         When no known criterion matches \c abbreviation, \c NULL
+     *         is returned.
+     */
+    template <class CharT, class Traits, class Allocator>
+    static table_type lookup_table(
+            std::basic_string<CharT,Traits,Allocator> abbreviation,
+            const bool subtract_mean)
+    {
+        return dispatch<tabulator>(abbreviation, subtract_mean);
+    }
 
-    bool operator==(const empirical_variance_iterator& other) const
+    /**
+     * Lookup an \ref overfit_penalty_table function pointer matching \c
+     * EstimationMethod, the specified criterion abbreviation, and whether or
+     * not the sample mean has been subtracted from the data.
+     *
+     * @param abbreviation  Known abbreviations per \ref best_model_function.
+     *                      If only whitespace, a reasonable default is used.
+     * @param subtract_mean Has the sample mean been subtracted from the data?
+     *
+     * @return A function pointer suitable for \ref penalty_table::assign.
+     *         When no known criterion matches \c abbreviation, \c NULL
+     *         is returned.
+     */
+    static table_type lookup_table(const char *abbreviation,
+                                   const bool subtract_mean)
     {
-        if (!this->N) {
-            return other.i >= static_cast<Integer2>(other.N + 1);
-        } else if (!other.N) {
-            return this->i >= static_cast<Integer2>(this->N + 1);
-        } else {
-            return this->N == other.N && this->i == other.i;
-        }
+        std::string s(abbreviation);
+        return lookup_table(s, subtract_mean);
     }
 
-    bool operator!=(const empirical_variance_iterator& other) const
-        { return !(*this == other); }
+private:
 
-    // LessThanComparable will trigger assertion on nonsense N cases
+    /** Obtains \ref evaluate for a given criterion. */
+    struct evaluator
+    {
+        typedef type result_type;
 
-    bool operator<(const empirical_variance_iterator& other) const
-        { return (*this - other) < 0; }
+        template <class Criterion>
+        static result_type get()
+        {
+            return evaluate<Criterion, Value, std::size_t, std::size_t>;
+        }
+    };
 
-    bool operator<=(const empirical_variance_iterator& other) const
-        { return (*this - other) <= 0; }
+    /** Obtains \ref overfit_penalty_table for a given criterion. */
+    struct tabulator
+    {
+        typedef table_type result_type;
 
-    bool operator>(const empirical_variance_iterator& other) const
-        { return (*this - other) > 0; }
+        template <class Criterion>
+        static result_type get()
+        {
+            return overfit_penalty_table<Criterion, Value>;
+        }
+    };
 
-    bool operator>=(const empirical_variance_iterator& other) const
-        { return (*this - other) >= 0; }
+    /** Apply \c Getter to the criterion matching the abbreviation. */
+    template <class Getter, class CharT, class Traits, class Allocator>
+    static typename Getter::result_type dispatch(
+            std::basic_string<CharT,Traits,Allocator> abbrev,
+            const bool subtract_mean);
+};
 
-    // Dereference operations
+template <template <class> class EstimationMethod,
+          typename Value>
+template <class Getter, class CharT, class Traits, class Allocator>
+typename Getter::result_type
+criterion_function<EstimationMethod,Value>::dispatch(
+        std::basic_string<CharT,Traits,Allocator> abbrev,
+        const bool subtract_mean)
+{
+    // Canonicalize the abbreviation per best_model_function::lookup
+    canonicalize_criterion(abbrev);
 
-    const value_type operator*() const
-    {
-        assert(is_nonnegative(i));
-        assert(i <= static_cast<Integer2>(N));
+    // Obtain the result per abbrev, subtract_mean, EstimationMethod
+    typedef EstimationMethod<mean_subtracted> subtracted;
+    typedef EstimationMethod<mean_retained  > retained;
+    typename Getter::result_type retval;
 
-        return EstimationMethod::template empirical_variance<Result>(N, i);
+    if      (abbrev.empty() || 0 == abbrev.compare("CIC" ))  // Default
+    {
+        if (subtract_mean)
+            retval = Getter::template get<CIC<subtracted> >();
+        else
+            retval = Getter::template get<CIC<retained  > >();
     }
-
-    const value_type operator[](const difference_type &k) const
+    else if (0 == abbrev.compare("AIC" ))
     {
-        assert(is_nonnegative(i + k));
-        assert(i + k <= static_cast<Integer2>(N));
-
-        return EstimationMethod::template empirical_variance<Result>(N, i + k);
+        retval = Getter::template get<AIC>();
     }
-};
-
-/**
- * @}
- */
-
-/////////////////////////////////////////////////////////////////////////////
-/////////////////////////////////////////////////////////////////////////////
-/////////////////////////////////////////////////////////////////////////////
-
-/**
- * Criteria for autoregressive model order selection following Broersen.
- *
- * For details see either the FiniteSampleCriteria.tex write up or Broersen,
- * P. M. T. "Finite sample criteria for autoregressive order selection." IEEE
- * Transactions on Signal Processing 48 (December 2000): 3550-3558.
- * http://dx.doi.org/10.1109/78.887047.
- *
- * @{
- */
-
-/**
- * A parent type for autoregressive model selection criterion.
- *
- * Each subclass should have an <tt>overfit_penalty(N, p)</tt> method
- * following Broersen, P. M. and H. E. Wensink. "On Finite Sample Theory for
- * Autoregressive Model Order Selection." IEEE Transactions on Signal
- * Processing 41 (January 1993): 194+.
- * http://dx.doi.org/10.1109/TSP.1993.193138.
- */
-struct criterion
-{
-    /** Compute the underfit penalty given \f$\sigma^2_\epsilon\f$. */
-    template <typename Result, typename Input>
-    static Result underfit_penalty(Input sigma2e)
+    else if (0 == abbrev.compare("AICC"))
     {
-        using std::log;
-        return log(Result(sigma2e));
+        retval = Getter::template get<AICC>();
     }
-};
-
-/**
- * Evaluate a given \ref criterion for \c N samples and model order \c p.
- *
- * @param[in] sigma2e The residual \f$\sigma^2_\epsilon\f$
- * @param[in] N       Sample count used to compute \f$\sigma^2_\epsilon\f$
- * @param[in] p       The model order use to compute \f$sigma^2_\epsilon\f$
- *
- * @return the evaluated criterion.
- */
-template <class    Criterion,
-          typename Result,
-          typename Integer1,
-          typename Integer2>
-Result evaluate(Result sigma2e, Integer1 N, Integer2 p)
-{
-    Result underfit = Criterion::template underfit_penalty<Result>(sigma2e);
-    Result overfit  = Criterion::template overfit_penalty<Result>(N, p);
-    return underfit + overfit;
-}
-
-/**
- * Represents the generalized information criterion (GIC).  The penalty factor
- * \f$\alpha\f$ is controlled by <tt>AlphaNumerator / AlphaDenominator</tt>.
- */
-template <int AlphaNumerator = 3, int AlphaDenominator = 1>
-struct GIC : public criterion
-{
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
+    else if (0 == abbrev.compare("BIC" ))
     {
-        return Result(AlphaNumerator) * p / (N * AlphaDenominator);
+        retval = Getter::template get<BIC>();
     }
-};
-
-/** Represents the Akaike information criterion (AIC). */
-struct AIC : public GIC<2> {};
-
-/** Represents the consistent criterion BIC. */
-struct BIC : public criterion
-{
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
+    else if (0 == abbrev.compare("FIC" ))
     {
-        using std::log;
-        return log(Result(N)) * p / N;
+        if (subtract_mean)
+            retval = Getter::template get<FIC<subtracted> >();
+        else
+            retval = Getter::template get<FIC<retained  > >();
     }
-};
-
-/** Represents the minimally consistent criterion (MCC). */
-struct MCC : public criterion
-{
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
+    else if (0 == abbrev.compare("FSIC"))
     {
-        using std::log;
-        return 2*log(log(Result(N))) * p / N;
+        if (subtract_mean)
+            retval = Getter::template get<FSIC<subtracted> >();
+        else
+            retval = Getter::template get<FSIC<retained  > >();
     }
-};
-
-/**
- * Represents the asymptotically-corrected Akaike information criterion (AICC).
- */
-struct AICC : public criterion
-{
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
+    else if (0 == abbrev.compare("GIC" ))
     {
-        return 2 * Result(p) / (N - p - 1);
+        retval = Getter::template get<GIC<> >();
     }
-};
-
-/**
- * Represents the finite information criterion (FIC) as applied to a particular
- * \ref estimation_method.  The penalty factor \f$\alpha\f$ is controlled by
- * <tt>AlphaNumerator / AlphaDenominator</tt>.
- */
-template <class EstimationMethod,
-          int AlphaNumerator = 3,
-          int AlphaDenominator = 1 >
-struct FIC : public criterion
-{
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
+    else if (0 == abbrev.compare("MCC" ))
     {
-        // This accumulate invocation is inefficient but always correct
-        using std::accumulate;
-        typedef empirical_variance_iterator<
-                EstimationMethod, Result, Integer1, Integer2
-            > evi_type;
-        Result sum = accumulate(evi_type(N), evi_type(N) + p, Result(0));
-
-        return AlphaNumerator * sum / AlphaDenominator;
+        retval = Getter::template get<MCC>();
+    } else
+    {
+        retval = NULL;
     }
-};
 
-/**
- * Represents the finite information criterion (FIC) as applied to the \ref
- * YuleWalker \ref estimation_method.  The penalty factor \f$\alpha\f$ is
- * controlled by <tt>AlphaNumerator / AlphaDenominator</tt>.
- */
-template <class MeanHandling,
-          int AlphaNumerator,
-          int AlphaDenominator>
-struct FIC<YuleWalker<MeanHandling>, AlphaNumerator, AlphaDenominator>
-    : public criterion
+    return retval;
+}
+
+/**
+ * Select the best model under each of several criteria in a single sweep
+ * over \f$\sigma^2_\epsilon\f$ for a hierarchy of candidates.  Unlike
+ * \ref best_model, the hierarchy is left unmodified so that every criterion
+ * shares one copy of it.  The underfit penalty of each model is computed once
+ * and the overfit penalty of each criterion is looked up from a \ref
+ * penalty_table rebuilt only when \c N or the maximum order change.  For each
+ * criterion, in the order added, the selected order is identical to that
+ * chosen by \ref best_model.
+ *
+ * The parameters of the model selected by criterion \c i begin at \ref
+ * params(i, first) given the beginning of a hierarchy's parameters and are
+ * \ref order(i) in number.  Its \f$\sigma^2_\epsilon\f$ and gain are found
+ * at index \ref order(i) and its autocorrelations are the first
+ * <tt>order(i) + 1</tt> within the hierarchy.
+ */
+template <typename Value>
+class best_models
 {
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
+public:
+
+    /** Builds a criterion's \ref penalty_table. */
+    typedef typename penalty_table<Value>::builder builder;
+
+    /**
+     * Add a criterion, for example one obtained from
+     * <tt>criterion_function<Burg,Value>::lookup_table</tt>.
+     *
+     * @returns the index of the criterion.
+     */
+    std::size_t add(builder crit)
     {
-        Result v0  = YuleWalker<MeanHandling>
-            ::template empirical_variance<Result>(N, Integer2(0));
+        AR_ENSURE_ARG(crit);
+        builders.push_back(crit);
+        tables  .push_back(penalty_table<Value>());
+        orders  .push_back(0);
+        values  .push_back(0);
+        return builders.size() - 1;
+    }
 
-        Result num = (2*N - p - 1)*p;  // Avoids non-positive values
-        Result den = 2*N*(N + 2);
+    /** Number of criteria added. */
+    std::size_t size() const { return builders.size(); }
 
-        return AlphaNumerator * (v0 + num/den) / AlphaDenominator;
+    /**
+     * Evaluate every criterion on a hierarchy given \f$\sigma^2_\epsilon\f$
+     * for orders zero and up, for example as populated by \ref burg_method
+     * when \c hierarchy is \c true.
+     *
+     * @param[in] N        Sample count used to compute \f$\sigma^2_\epsilon\f$.
+     * @param[in] minorder Constrain the best models to be at least this order.
+     * @param[in] sigma2e  A <a
+     *                     href="http://www.sgi.com/tech/stl/Sequence.html">
+     *                     Sequence</a> holding \f$\sigma^2_\epsilon\f$.
+     */
+    template <class Sequence>
+    void evaluate(const std::size_t N,
+                  const std::size_t minorder,
+                  const Sequence&   sigma2e)
+    {
+        using std::size_t;
+
+        // Checks mirror those of best_model
+        AR_ENSURE_ARG(sigma2e.size() > 0);
+        const size_t maxorder = sigma2e.size() - 1;
+        AR_ENSURE_ARG(minorder <= maxorder);
+
+        const size_t K = builders.size();
+        for (size_t i = 0; i < K; ++i)
+            tables[i].assign(builders[i], N, maxorder);
+
+        // Scan candidates exactly as evaluate_models does for each criterion
+        // Notice strict comparison keeps the lowest order among any ties
+        typename Sequence::const_iterator it = sigma2e.begin();
+        std::advance(it, minorder);
+        for (size_t dist = 0, p = minorder; p <= maxorder; ++dist, ++p, ++it)
+        {
+            if (dist && dist >= N) break;
+            const Value u = criterion::underfit_penalty<Value>(*it);
+            for (size_t i = 0; i < K; ++i)
+            {
+                const Value c = u + tables[i].overfit_penalty(p);
+                if (dist == 0 || c < values[i])
+                {
+                    values[i] = c;
+                    orders[i] = p;
+                }
+            }
+        }
     }
-};
 
-// Specializations of the FIC for efficiency when digamma is available.
-#ifdef AR_DIGAMMA
+    /** Order of the best model under criterion \c i. */
+    std::size_t order(const std::size_t i) const { return orders[i]; }
 
-/**
- * Represents the finite information criterion (FIC) as applied to the \ref
- * Burg \ref estimation_method.  The penalty factor \f$\alpha\f$ is controlled
- * by <tt>AlphaNumerator / AlphaDenominator</tt>.
- */
-template <class MeanHandling,
-          int AlphaNumerator,
-          int AlphaDenominator>
-struct FIC<Burg<MeanHandling>, AlphaNumerator, AlphaDenominator>
-    : public criterion
-{
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
+    /** Criterion \c i evaluated at its best model. */
+    Value best_criterion(const std::size_t i) const { return values[i]; }
+
+    /**
+     * Beginning of the parameters of the best model under criterion \c i
+     * given \c first, the beginning of a hierarchy's concatenated parameters.
+     */
+    template <class RandomAccessIterator>
+    RandomAccessIterator params(const std::size_t    i,
+                                RandomAccessIterator first) const
     {
-        Result t  = Burg<MeanHandling>
-            ::template empirical_variance<Result>(N, Integer2(0));
-        t -= AR_DIGAMMA(N + 1);
-        t += AR_DIGAMMA(N + 1 - p);
-        return AlphaNumerator * t / AlphaDenominator;
+        const std::size_t p = orders[i];
+        return first + (p ? (p - 1)*p/2 : 0);
     }
+
+private:
+
+    /** Builders of each criterion's tables. */
+    std::vector<builder> builders;
+
+    /** Penalties for each criterion. */
+    std::vector<penalty_table<Value> > tables;
+
+    /** Best order found under each criterion. */
+    std::vector<std::size_t> orders;
+
+    /** Criterion value at each best order. */
+    std::vector<Value> values;
 };
 
 /**
- * Represents the finite information criterion (FIC) as applied to the \ref
- * LSFB \ref estimation_method.  The penalty factor \f$\alpha\f$ is controlled
- * by <tt>AlphaNumerator / AlphaDenominator</tt>.
+ * Select the best model according to a \ref criterion while models are
+ * estimated rather than afterwards.  Output iterators obtained from \ref
+ * params, \ref sigma2e, \ref gain, and \ref autocor are passed to \ref
+ * burg_method or \ref burg_recursion with <tt>hierarchy == true</tt>.  As
+ * each model's \f$\sigma^2_\epsilon\f$ arrives the criterion is
+ * evaluated and only the best model found so far is retained.  Storage is
+ * therefore \f$O(p)\f$ rather than the \f$O(p^2)\f$ of a hierarchy and,
+ * after \ref reset, repeated selections perform no allocation.  The selected
+ * model is identical to that chosen by \ref best_model.
  */
-template <class MeanHandling,
-          int AlphaNumerator,
-          int AlphaDenominator>
-struct FIC<LSFB<MeanHandling>, AlphaNumerator, AlphaDenominator>
-    : public criterion
+template <typename Value>
+class online_best_model
 {
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
+private:
+
+    // Receivers precede their use as template arguments below
+
+    void receive_param(const Value& v)
     {
-        Result t  = LSFB<MeanHandling>
-            ::template empirical_variance<Result>(N, Integer2(0));
-        Result a = AR_DIGAMMA((3 + 2*N) / Result(3)    );
-        Result b = AR_DIGAMMA((3 + 2*N) / Result(3) - p);
-        return AlphaNumerator * (t - 2*(a - b)/3) / AlphaDenominator;
+        candidate.push_back(v);
     }
-};
 
-/**
- * Represents the finite information criterion (FIC) as applied to the \ref
- * LSF \ref estimation_method.  The penalty factor \f$\alpha\f$ is controlled
- * by <tt>AlphaNumerator / AlphaDenominator</tt>.
- */
-template <class MeanHandling,
-          int AlphaNumerator,
-          int AlphaDenominator>
-struct FIC<LSF<MeanHandling>, AlphaNumerator, AlphaDenominator>
-    : public criterion
-{
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
+    void receive_sigma2e(const Value& v)
     {
-        Result t  = LSF<MeanHandling>
-            ::template empirical_variance<Result>(N, Integer2(0));
-        Result a = AR_DIGAMMA((2 + N) / Result(2)    );
-        Result b = AR_DIGAMMA((2 + N) / Result(2) - p);
-        return AlphaNumerator * (t - (a - b)/2) / AlphaDenominator;
+        // Order k's parameters, if any, arrived immediately beforehand
+        // Strict comparison after the first keeps ties per evaluate_models
+        latest = false;
+        if (k >= minorder)
+        {
+            const Value c = table ? (*table)(v, k) : crit(v, N, k);
+            if (!found || c < crit_)
+            {
+                found    = true;
+                latest   = true;
+                order_   = k;
+                crit_    = c;
+                sigma2e_ = v;
+                best.swap(candidate);
+            }
+        }
+        candidate.clear();
+        ++k;
     }
-};
 
-#endif /* AR_DIGAMMA */
+    void receive_gain(const Value& v)
+    {
+        if (latest) gain_ = v;
+    }
 
-/**
- * Represents the finite sample information criterion (FSIC) as applied to a
- * particular \ref estimation_method.
- */
-template <class EstimationMethod>
-struct FSIC : public criterion
-{
+    void receive_autocor(const Value& v)
+    {
+        if (autocor_.size() <= order_) autocor_.push_back(v);
+    }
 
-private:
+public:
 
-    /** A helper to compute \f$\frac{1+v}{1-v}\f$ for the method in use. */
-    template <typename Result, typename Integer1, typename Integer2>
-    class product_iterator
-        : public empirical_variance_iterator<
-                EstimationMethod, Result, Integer1, Integer2
-          >
-    {
-    private:
-        typedef empirical_variance_iterator<
-                EstimationMethod, Result, Integer1, Integer2
-            > base;
+    /** Evaluates a criterion given \f$\sigma^2_\epsilon\f$, N, and p. */
+    typedef Value (*evaluator)(Value sigma2e, std::size_t N, std::size_t p);
 
+    /** An OutputIterator forwarding each assignment to a member function. */
+    template <void (online_best_model::*Receive)(const Value&)>
+    class output
+        : public std::iterator<std::output_iterator_tag, void, void, void, void>
+    {
     public:
-        typedef typename base::difference_type   difference_type;
-        typedef typename base::iterator_category iterator_category;
-        typedef typename base::pointer           pointer;
-        typedef typename base::reference         reference;
-        typedef typename base::value_type        value_type;
+        /** Forward values to \c m. */
+        explicit output(online_best_model& m) : m(&m) {}
 
-        product_iterator(Integer1 N) : base(N) {}
+        /** Forward \c v to the selector. */
+        output& operator=(const Value& v) { (m->*Receive)(v); return *this; }
 
-        value_type operator*() const
-        {
-            const value_type v = this->base::operator*();
-            return (1 + v) / (1 - v);
-        }
+        /** No-op dereference. */
+        output& operator*()     { return *this; }
 
-        value_type operator[](const difference_type &k) const
-        {
-            const value_type v = this->base::operator[](k);
-            return (1 + v) / (1 - v);
-        }
+        /** No-op prefix increment. */
+        output& operator++()    { return *this; }
 
+        /** No-op postfix increment. */
+        output  operator++(int) { return *this; }
+
+    private:
+        online_best_model* m;
     };
 
-public:
+    /** Receives \f$a_1, \dots, a_k\f$ for each successive order \f$k\f$. */
+    typedef output<&online_best_model::receive_param>   params_iterator;
 
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
-    {
-        // This accumulate invocation is inefficient but always correct
-        using std::multiplies;
-        using std::accumulate;
-        product_iterator<Result, Integer1, Integer2> first(N), last(N);
-        last += p; // Avoids overloading requirements for (last + p)
+    /** Receives \f$\sigma^2_\epsilon\f$ for each successive order. */
+    typedef output<&online_best_model::receive_sigma2e> sigma2e_iterator;
 
-        return accumulate(first, last, Result(1), multiplies<Result>()) - 1;
-    }
-};
+    /** Receives the gain for each successive order. */
+    typedef output<&online_best_model::receive_gain>    gain_iterator;
 
-// Specializations of the FIC for efficiency when Pochhammer is available.
-#ifdef AR_POCHHAMMER
+    /** Receives autocorrelations for lags zero and up. */
+    typedef output<&online_best_model::receive_autocor> autocor_iterator;
 
-/**
- * Represents the finite information criterion (FSIC) as applied to the \ref
- * YuleWalker \ref estimation_method.
- */
-template <class MeanHandling>
-struct FSIC<YuleWalker<MeanHandling> > : public criterion
-{
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
+    /**
+     * Prepare to select among models fit from \c N samples ignoring those
+     * of order less than \c minorder.  Storage is reserved for models up
+     * to order \c maxorder.
+     */
+    explicit online_best_model(evaluator         crit     = NULL,
+                               const std::size_t N        = 0,
+                               const std::size_t minorder = 0,
+                               const std::size_t maxorder = 0)
+        : crit(crit), table(NULL)
     {
-        Result v0  = YuleWalker<MeanHandling>
-            ::template empirical_variance<Result>(N, Integer2(0));
-        Result a = AR_POCHHAMMER(N*(N+3) - p, p);
-        Result b = AR_POCHHAMMER(Result(1 + N) - N*N);
+        reserve(maxorder);
+        reset(N, minorder);
+    }
 
-        return (1 + v0) / (1 - v0) * (a / b) - 1;
+    /** Reserve storage for models up to order \c maxorder. */
+    void reserve(const std::size_t maxorder)
+    {
+        candidate.reserve(maxorder);
+        best     .reserve(maxorder);
+        autocor_ .reserve(maxorder + 1);
+    }
+
+    /** Discard any selection to prepare for another hierarchy. */
+    void reset(const std::size_t N, const std::size_t minorder)
+    {
+        this->N        = N;
+        this->minorder = minorder;
+        k        = 0;
+        order_   = 0;
+        found    = false;
+        latest   = false;
+        crit_    = 0;
+        sigma2e_ = 0;
+        gain_    = 0;
+        candidate.clear();
+        best     .clear();
+        autocor_ .clear();
     }
+
+    /** Change the criterion used for subsequent selections. */
+    void criterion(evaluator c) { crit = c; table = NULL; }
+
+    /**
+     * Evaluate subsequent selections using \c t, which must remain valid,
+     * cover every order to be received, and have been built for the \c N
+     * provided to \ref reset.
+     */
+    void criterion(const penalty_table<Value>& t) { crit = NULL; table = &t; }
+
+    /** Obtain an output iterator receiving model parameters. */
+    params_iterator  params()  { return params_iterator (*this); }
+
+    /** Obtain an output iterator receiving \f$\sigma^2_\epsilon\f$. */
+    sigma2e_iterator sigma2e() { return sigma2e_iterator(*this); }
+
+    /** Obtain an output iterator receiving model gains. */
+    gain_iterator    gain()    { return gain_iterator   (*this); }
+
+    /** Obtain an output iterator receiving autocorrelations. */
+    autocor_iterator autocor() { return autocor_iterator(*this); }
+
+    /** Has any model of at least order \c minorder been received? */
+    bool selected() const { return found; }
+
+    /** Order of the best model. */
+    std::size_t order() const { return order_; }
+
+    /** Parameters \f$a_1, \dots, a_p\f$ of the best model. */
+    const std::vector<Value>& best_params() const { return best; }
+
+    /** \f$\sigma^2_\epsilon\f$ of the best model. */
+    Value best_sigma2e() const { return sigma2e_; }
+
+    /** Gain of the best model. */
+    Value best_gain() const { return gain_; }
+
+    /** Autocorrelations \f$\rho_0, \dots, \rho_p\f$ of the best model. */
+    const std::vector<Value>& best_autocor() const { return autocor_; }
+
+    /** Criterion value of the best model. */
+    Value best_criterion() const { return crit_; }
+
+private:
+
+    /** Criterion evaluated for every eligible model absent \c table. */
+    evaluator crit;
+
+    /** When non-NULL, the tabulated criterion used in place of \c crit. */
+    const penalty_table<Value>* table;
+
+    /** Sample count passed to \c crit. */
+    std::size_t N;
+
+    /** Minimum eligible model order. */
+    std::size_t minorder;
+
+    /** Order of the next \f$\sigma^2_\epsilon\f$ to be received. */
+    std::size_t k;
+
+    /** Order of the best model so far. */
+    std::size_t order_;
+
+    /** Has an eligible model been received? */
+    bool found;
+
+    /** Was the most recently received model the best so far? */
+    bool latest;
+
+    /** Criterion, innovation variance, and gain of the best model. */
+    Value crit_, sigma2e_, gain_;
+
+    /** Parameters of the model currently being received. */
+    std::vector<Value> candidate;
+
+    /** Parameters of the best model so far. */
+    std::vector<Value> best;
+
+    /** Best model autocorrelations. */
+    std::vector<Value> autocor_;
 };
 
 /**
- * Represents the finite information criterion (FSIC) as applied to the \ref
- * Burg \ref estimation_method.
+ * Phases of fitting, selecting, and characterizing one signal recorded by an
+ * instrumentation policy like \ref arsel_timing.
  */
-template <class MeanHandling>
-struct FSIC<Burg<MeanHandling> > : public criterion
+enum arsel_phase
 {
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
-    {
-        Result v0  = Burg<MeanHandling>
-            ::template empirical_variance<Result>(N, Integer2(0));
-        Result a = AR_POCHHAMMER(-Result(1) - N, p);
-        Result b = AR_POCHHAMMER( Result(1) - N, p);
-
-        return (1 + v0) / (1 - v0) * (a / b) - 1;
-    }
+    arsel_read,     /**< Parsing input, recorded only by callers.         */
+    arsel_load,     /**< Copying a signal into working storage.           */
+    arsel_penalty,  /**< Tabulating criterion penalties per order.        */
+    arsel_burg,     /**< Burg recursion and online best model selection.  */
+    arsel_T0,       /**< Summing the best model's decorrelation time.     */
+    arsel_phases    /**< Number of phases.                                */
 };
 
 /**
- * Represents the finite information criterion (FSIC) as applied to the \ref
- * LSFB \ref estimation_method.
+ * An instrumentation policy recording nothing.  Every hook is an empty
+ * inline function so an \ref arsel_result using this default policy
+ * compiles as though uninstrumented.
+ *
+ * A policy provides a static <tt>now()</tt> returning a time in seconds and
+ * <tt>record(phase, seconds, iterations, bytes)</tt> accumulating the wall
+ * time, the iteration count, and the nominal bytes touched by one phase.
  */
-template <class MeanHandling>
-struct FSIC<LSFB<MeanHandling> > : public criterion
+struct null_instrumentation
 {
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
-    {
-        Result v0  = LSFB<MeanHandling>
-            ::template empirical_variance<Result>(N, Integer2(0));
-        Result a = AR_POCHHAMMER((-Result(2)-2*N)/3, p);
-        Result b = AR_POCHHAMMER(( Result(2)-2*N)/3, p);
+    /** The current time, always zero. */
+    static double now() { return 0; }
 
-        return (1 + v0) / (1 - v0) * (a / b) - 1;
-    }
+    /** Record nothing. */
+    void record(arsel_phase, double, std::size_t, double) {}
 };
 
 /**
- * Represents the finite information criterion (FSIC) as applied to the \ref
- * LSF \ref estimation_method.
+ * An instrumentation policy accumulating the wall time, iterations, and
+ * nominal bytes touched by each \ref arsel_phase.  Iterations count samples
+ * while loading, orders tabulated while building penalties, orders computed
+ * by the Burg recursion, and lags summed for the decorrelation time.  Without
+ * OpenMP, processor time measured by <tt>std::clock</tt> is recorded.
  */
-template <class MeanHandling>
-struct FSIC<LSF<MeanHandling> > : public criterion
+class arsel_timing
 {
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
+public:
+
+    /** Construct with nothing recorded. */
+    arsel_timing() { reset(); }
+
+    /** The current time in seconds. */
+    static double now()
+    {
+#ifdef _OPENMP
+        return omp_get_wtime();
+#else
+        return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+    }
+
+    /** Accumulate \c seconds, \c iterations, and \c bytes for \c phase. */
+    void record(const arsel_phase phase,
+                const double      seconds,
+                const std::size_t iterations,
+                const double      bytes)
     {
-        Result v0  = LSF<MeanHandling>
-            ::template empirical_variance<Result>(N, Integer2(0));
-        Result a = AR_POCHHAMMER((-Result(1)-N)/2, p);
-        Result b = AR_POCHHAMMER(( Result(1)-N)/2, p);
+        seconds_[phase]    += seconds;
+        iterations_[phase] += iterations;
+        bytes_[phase]      += bytes;
+    }
 
-        return (1 + v0) / (1 - v0) * (a / b) - 1;
+    /** Forget everything recorded. */
+    void reset()
+    {
+        std::fill(seconds_,    seconds_    + arsel_phases, 0.0);
+        std::fill(iterations_, iterations_ + arsel_phases, std::size_t(0));
+        std::fill(bytes_,      bytes_      + arsel_phases, 0.0);
     }
-};
 
-#endif /* AR_POCHHAMMER */
+    /** Seconds recorded for \c phase. */
+    double seconds(const arsel_phase phase) const
+    { return seconds_[phase]; }
 
+    /** Iterations recorded for \c phase. */
+    std::size_t iterations(const arsel_phase phase) const
+    { return iterations_[phase]; }
 
-/**
- * Represents the combined information criterion (CIC) as applied to a
- * particular \ref estimation_method.
- */
-template <class EstimationMethod>
-struct CIC : public criterion
-{
-    /** Compute overfit penalty given \c N observations at model order \c p. */
-    template <typename Result, typename Integer1, typename Integer2>
-    static Result overfit_penalty(Integer1 N, Integer2 p)
+    /** Nominal bytes touched recorded for \c phase. */
+    double bytes(const arsel_phase phase) const
+    { return bytes_[phase]; }
+
+    /** A short, whitespace-free name for \c phase. */
+    static const char* name(const arsel_phase phase)
     {
-        using std::max;
-        return max(
-                FSIC<EstimationMethod>::template overfit_penalty<Result>(N, p),
-                FIC <EstimationMethod>::template overfit_penalty<Result>(N, p)
-            );
+        static const char* const names[arsel_phases] = {
+            "read", "load", "penalty", "burg", "T0"
+        };
+        return names[phase];
     }
+
+private:
+    double      seconds_[arsel_phases];
+    std::size_t iterations_[arsel_phases];
+    double      bytes_[arsel_phases];
 };
 
 /**
- * @}
+ * The outcome of automatically fitting one signal within \ref arsel_batch.
+ * Field names follow the output of the \c arsel utility.  Per-phase costs
+ * are recorded into \c timing by \ref arsel_fit and \ref
+ * arsel_batch_lockstep according to the \c Instrumentation policy, either
+ * \ref null_instrumentation or \ref arsel_timing.
  */
+template <typename Value, class Instrumentation = null_instrumentation>
+struct arsel_result
+{
+    /** The working precision. */
+    typedef Value value_type;
 
-/////////////////////////////////////////////////////////////////////////////
-/////////////////////////////////////////////////////////////////////////////
-/////////////////////////////////////////////////////////////////////////////
+    /** The instrumentation policy. */
+    typedef Instrumentation instrumentation_type;
 
-/**
- * Algorithmic helpers for autoregressive model order selection.
- *
- * @{
- */
+    /** Number of samples in the signal. */
+    std::size_t N;
+
+    /** Maximum model order considered after limiting by \c N. */
+    std::size_t maxorder;
+
+    /** Sample mean of the signal. */
+    Value mu;
+
+    /** Parameters \f$a_1, \dots, a_p\f$ of the best model. */
+    std::vector<Value> AR;
+
+    /** Autocorrelations for lags zero through \f$p\f$, inclusive. */
+    std::vector<Value> autocor;
+
+    /** Innovation variance \f$\sigma^2_\epsilon\f$ of the best model. */
+    Value sigma2eps;
+
+    /** Gain \f$\sigma^2_x / \sigma^2_\epsilon\f$ of the best model. */
+    Value gain;
+
+    /** Process output variance \f$\sigma^2_x\f$ of the best model. */
+    Value sigma2x;
+
+    /** Decorrelation time per \ref decorrelation_time. */
+    Value T0;
+
+    /** Effective signal variance following Trenberth 1984. */
+    Value eff_var;
+
+    /** Effective number of independent samples. */
+    Value eff_N;
+
+    /** Estimated standard deviation of the sample mean. */
+    Value mu_sigma;
+
+    /** Costs recorded while producing this result. */
+    Instrumentation timing;
+};
 
 /**
- * Evaluate a \ref criterion on a hierarchy of models given
- * \f$\sigma^2_\epsilon\f$ for each model.  The index of the best model, i.e.
- * the one with minimum criterion value, is returned.
- *
- * @param[in]  N        Sample count used to compute \f$\sigma^2_\epsilon\f$.
- * @param[in]  ordfirst The model order corresponding to \c first.
- *                      When \f$\sigma^2_\epsilon\f$ is produced entirely by
- *                      \ref burg_method with <tt>hierarchy == true</tt>,
- *                      this should be \c 0.
- * @param[in]  first    Beginning of the range holding \f$\sigma^2_\epsilon\f$
- * @param[in]  last     Exclusive end of input range.
- * @param[out] crit     Value assigned to each model by the criterion.
- *
- * @return The distance from \c first to the best model.
- *         An obscenely negative value is returned on error.
+ * Working storage for fitting, selecting, and characterizing models within
+ * \ref arsel_fit.  Once a workspace has processed a signal, processing
+ * further signals which are no longer and fit to no greater maximum order
+ * performs no heap allocation because every buffer retains its capacity.
+ * Use \ref reserve to reach that state before the first signal.  Workspaces
+ * are not thread-safe so keep one per thread.
  */
-template <class    Criterion,
-          typename Integer1,
-          typename Integer2,
-          class    InputIterator,
-          class    OutputIterator>
-typename std::iterator_traits<InputIterator>::difference_type
-evaluate_models(Integer1       N,
-                Integer2       ordfirst,
-                InputIterator  first,
-                InputIterator  last,
-                OutputIterator crit)
+template <typename Value>
+class burg_workspace
 {
-    using std::iterator_traits;
-    using std::numeric_limits;
+public:
 
-    typedef InputIterator iterator;
-    typedef typename iterator_traits<iterator>::difference_type difference_type;
-    typedef typename iterator_traits<iterator>::value_type      value_type;
+    /** The working precision. */
+    typedef Value value_type;
 
-    // Short circuit on trivial input
-    if (first == last)
-        return numeric_limits<difference_type>::min();
+    /** The sequence type of working storage. */
+    typedef std::vector<Value> vector_type;
 
-    // Handle first iteration without comparison as AICC blows up on N == 1
-    value_type best_val = evaluate<Criterion>(*first++, N, ordfirst);
-    difference_type best_pos = 0, dist = 0;
+    /** Allocate only a minimal amount of storage. */
+    burg_workspace() {}
 
-    // Scan through rest of candidates (up to order N-1) updating best as we go
-    while (first != last && static_cast<Integer1>(++dist) < N)
+    /** Allocate storage sufficient for \c N samples and order \c maxorder. */
+    burg_workspace(const std::size_t N, const std::size_t maxorder)
     {
-        value_type candidate = evaluate<Criterion>(*first++, N, dist+ordfirst);
-        *crit++ = candidate;
+        reserve(N, maxorder);
+    }
 
-        if (candidate < best_val) {
-            best_val = candidate;
-            best_pos = dist;
-        }
+    /**
+     * Ensure signals of up to \c N samples may be fit up to order
+     * \c maxorder without allocation.
+     */
+    void reserve(const std::size_t N, const std::size_t maxorder)
+    {
+        f .reserve(N);
+        b .reserve(N);
+        Ak.reserve(maxorder + 1);
+        ac.reserve(maxorder + 1);
+        selector.reserve(maxorder);
+        Ak .assign(maxorder, Value(0));
+        rho.assign(Ak.begin(), Ak.end());
+        Ak .clear();
     }
 
-    return best_pos;
-}
+    /** Forward prediction errors per \ref burg_method. */
+    vector_type f;
+
+    /** Backward prediction errors per \ref burg_method. */
+    vector_type b;
+
+    /** Working storage \c Ak per \ref burg_method. */
+    vector_type Ak;
+
+    /** Working storage \c ac per \ref burg_method. */
+    vector_type ac;
+
+    /** Criterion penalties cached across fits sharing N and maxorder. */
+    penalty_table<Value> table;
+
+    /** Retains the best model as the hierarchy is estimated. */
+    online_best_model<Value> selector;
+
+    /** Iterates the best model's autocorrelation per \ref autocorrelation. */
+    basic_predictor<Value> rho;
+};
 
 /**
- * Obtain the best model according to \ref criterion applied to
- * \f$\sigma^2_\epsilon\f$ given a hierarchy of candidates.
- *
- * On input, \c params, \c sigma2e, \c gain, and \c autocor should be <a
- * href="http://www.sgi.com/tech/stl/Sequence.html">Sequence</a>s which were
- * populated by \ref burg_method when \c hierarchy is \c true (or in some other
- * equivalent manner).  On output, these arguments will contain only values
- * relevant to the best model.
- *
- * @param[in]     N        Sample count used to compute \f$\sigma^2_\epsilon\f$.
- *                         For example, the return value of \ref burg_method.
- * @param[in]     minorder Constrain the best model to be at least this order.
- *                         Supplying zero specifies no constraint.
- * @param[in,out] params   Model parameters
- * @param[in,out] sigma2e  \f$\sigma^2_\epsilon\f$
- * @param[in,out] gain     Model gain
- * @param[in,out] autocor  Model autocorrelations
- * @param[out]    crit     Value assigned to each model by the criterion.
- *
- * @return The index of the best criterion value within \c crit.
+ * The complete hierarchy of models fit by \ref burg_method retained so that
+ * selection may be repeated per \ref arsel_replay under differing criteria,
+ * minimum orders, or decorrelation time windows without refitting.  Because
+ * %Burg's recursion computes each order from only the lower ones, the
+ * hierarchy through some \ref maxorder also answers every request through a
+ * lesser maximum order.  Members are public so that callers may persist and
+ * restore them, for example within an on-disk cache.
  */
-template <class    Criterion,
-          typename Integer1,
-          typename Integer2,
-          class    Sequence1,
-          class    Sequence2,
-          class    Sequence3,
-          class    Sequence4,
-          class    OutputIterator>
-typename Sequence1::difference_type
-best_model(Integer1       N,
-           Integer2       minorder,
-           Sequence1&     params,
-           Sequence2&     sigma2e,
-           Sequence3&     gain,
-           Sequence4&     autocor,
-           OutputIterator crit)
+template <typename Value>
+class burg_hierarchy
 {
-    using std::advance;
-    using std::copy_backward;
-    using std::invalid_argument;
-    using std::size_t;
-
-    // Ensure all inputs have conformant sizes
-    // Sanity checks written to provide order messages readable by end users
-    AR_ENSURE_ARG(sigma2e.size() > 0);
-    const size_t maxorder = sigma2e.size() - 1;
-    AR_ENSURE_ARG(is_nonnegative(minorder));
-    AR_ENSURE_ARG(static_cast<size_t>(minorder) <= maxorder);
-    AR_ENSURE_ARG(params .size() == (sigma2e.size()-1)*sigma2e.size()/2);
-    AR_ENSURE_ARG(gain   .size() == sigma2e.size());
-    AR_ENSURE_ARG(autocor.size() == sigma2e.size());
+public:
 
-    // Find the best model index according to the given minorder and criterion
-    typename Sequence1::difference_type best = minorder;
-    {
-        typename Sequence2::iterator iter = sigma2e.begin();
-        advance(iter, minorder);
-        best += evaluate_models<Criterion>(N, minorder, iter,
-                                           sigma2e.end(), crit);
-    }
+    /** The working precision. */
+    typedef Value value_type;
 
-    // Now trim away everything and leaving only the best model in Sequences...
+    /** The sequence type of stored results. */
+    typedef std::vector<Value> vector_type;
 
-    // ...first in params...
-    {
-        // Best parameters might overlap beginning of params so copy_backwards.
-        // AR(0) is trivial and AR(1) starts at params.begin(), hence off by 1.
-        typename Sequence1::iterator first  = params.begin();
-        typename Sequence1::iterator last   = params.begin();
-        typename Sequence1::iterator result = params.begin();
-        advance(first,  ((best-1)*best)/2       );
-        advance(last,   ((best-1)*best)/2 + best);
-        advance(result,                     best);
-        copy_backward(first, last, result);
-        params.resize(best);
-    }
+    /** Construct an empty hierarchy. */
+    burg_hierarchy() : N(0), maxorder(0), subtract_mean(false), mu(0) {}
 
-    // ...next in sigma2e...
+    /**
+     * Fit every order through \c maxorder to <tt>[first, last)</tt> using
+     * \ref burg_method_inplace with storage drawn from \c workspace.
+     *
+     * @returns the number data values processed within
+     *          <tt>[data_first, data_last)</tt>.
+     */
+    template <class InputIterator, class Kernel>
+    std::size_t assign(InputIterator           first,
+                       InputIterator           last,
+                       const bool              subtract_mean,
+                       const std::size_t       maxorder,
+                       burg_workspace<Value>&  workspace,
+                       const Kernel&           kernel)
     {
-        typename Sequence2::iterator cursor = sigma2e.begin();
-        advance(cursor, best);
-        *sigma2e.begin() = *cursor;
-        sigma2e.resize(1);
+        burg_workspace<Value>& w = workspace;
+        w.f.assign(first, last);
+        w.b.resize(w.f.size());
+        params .clear();
+        sigma2e.clear();
+        gain   .clear();
+        autocor.clear();
+        this->subtract_mean = subtract_mean;
+        this->maxorder      = maxorder;
+        N = burg_method_inplace(w.f.begin(), w.f.end(), mu, this->maxorder,
+                                std::back_inserter(params),
+                                std::back_inserter(sigma2e),
+                                std::back_inserter(gain),
+                                std::back_inserter(autocor),
+                                subtract_mean, /* hierarchy? */ true,
+                                w.b.begin(), w.Ak, w.ac, kernel,
+                                burg_never_stop());
+        return N;
     }
 
-    // ...next in gain...
+    /**
+     * Can this hierarchy answer a request through order \c maxorder?  Only
+     * <tt>N-1</tt> orders can ever be fit so requests beyond that are
+     * answered by any hierarchy reaching it.
+     */
+    bool covers(const std::size_t maxorder) const
     {
-        typename Sequence2::iterator cursor = gain.begin();
-        advance(cursor, best);
-        *gain.begin() = *cursor;
-        gain.resize(1);
+        const std::size_t reachable = N ? std::min(maxorder, N - 1) : 0;
+        return this->maxorder >= reachable;
     }
 
-    // ...and last in autocor...
-    autocor.resize(best + 1);
+    /** Number of samples fit. */
+    std::size_t N;
 
-    // ...but notice that resizing does not free capacity for std::vectors.
+    /** Maximum model order fit. */
+    std::size_t maxorder;
 
-    return best;
-}
+    /** Was the sample mean subtracted prior to fitting? */
+    bool subtract_mean;
 
-namespace { // anonymous
+    /** Sample mean of the data. */
+    Value mu;
 
-// Used to discard output per http://stackoverflow.com/questions/335930/
-struct null_output : std::iterator< std::output_iterator_tag, null_output >
-{
-    template <typename T> void operator=(const T&) {}
+    /** Parameters for orders one through \ref maxorder, concatenated. */
+    vector_type params;
 
-    null_output& operator++()
-        { return *this; }
+    /** \f$\sigma^2_\epsilon\f$ for orders zero through \ref maxorder. */
+    vector_type sigma2e;
 
-    null_output operator++(int)
-        { null_output it(*this); ++*this; return it; }
+    /** Gain for orders zero through \ref maxorder. */
+    vector_type gain;
 
-    null_output& operator*()
-        { return *this; }
+    /** Autocorrelations for lags zero through \ref maxorder. */
+    vector_type autocor;
 };
 
+// Helpers for arsel_fit and arsel_batch_lockstep which, given the best model
+// for one signal per online_best_model, compute derived results and the
+// nominal traffic of a Burg recursion reading and writing f and b per order.
+namespace
+{
+
+template <typename Value>
+double burg_bytes(const std::size_t N, const std::size_t maxorder)
+{
+    // Order k updates N - k samples of both f and b
+    const double updates = double(maxorder) * N
+                         - 0.5 * double(maxorder) * (maxorder + 1);
+    return 4 * sizeof(Value) * updates;
+}
+
+template <class Result, class Selector, class Predictor>
+void arsel_select(Result&         r,
+                  const Selector& selector,
+                  const bool      absrho,
+                  const double    window_T0,
+                  Predictor&      rho)
+{
+    using std::size_t;
+    using std::sqrt;
+
+    // Mimic best_model which rejects minorder exceeding the maximum order
+    AR_ENSURE_MSGEXCEPT(selector.selected(),
+                        "minorder exceeds the maximum order fit",
+                        std::invalid_argument);
+    const typename Result::value_type sigma2e = selector.best_sigma2e();
+    const typename Result::value_type gain    = selector.best_gain();
+
+    // Iterate over the autocorrelation per ar::autocorrelation
+    typedef typename Result::value_type value_type;
+    typedef typename Result::instrumentation_type instrumentation_type;
+    const double t0 = instrumentation_type::now();
+    rho.assign(selector.best_params().begin(), selector.best_params().end());
+    rho.initial_conditions(selector.best_autocor().begin() + 1, 1 / gain);
+    size_t lags;
+    r.T0 = decorrelation_time_inplace(
+            static_cast<size_t>(window_T0*r.N), rho, absrho,
+            std::numeric_limits<value_type>::epsilon(), lags);
+    r.timing.record(arsel_T0, instrumentation_type::now() - t0, lags,
+                    double(lags) * rho.order() * sizeof(value_type));
+    r.AR.assign(selector.best_params().begin(),
+                selector.best_params().end());
+    r.autocor.assign(selector.best_autocor().begin(),
+                     selector.best_autocor().end());
+    r.sigma2eps = sigma2e;
+    r.gain      = gain;
+    r.sigma2x   = gain*sigma2e;
+    r.eff_var   = (r.N*gain*sigma2e) / (r.N - r.T0); // Trenberth1984
+    r.eff_N     = r.N / r.T0;
+    r.mu_sigma  = sqrt(r.eff_var / r.eff_N);
+}
+
 }
 
 /**
- * Find the index of the best model from a hierarchy of candidates according to
- * a \ref criterion given \f$\sigma^2_\epsilon\f$ for each model.
- *
- * @param[in]  N        Sample count used to compute \f$\sigma^2_\epsilon\f$.
- * @param[in]  ordfirst The model order corresponding to \c first.
- *                      When \f$sigma^2_\epsilon\f$ is produced entirely by
- *                      \ref burg_method, this should be \c 0u.
- * @param[in]  first    Beginning of the range holding \f$\sigma^2_\epsilon\f$
- * @param[in]  last     Exclusive end of input range.
+ * Automatically fit an autoregressive model to one signal using \ref
+ * burg_method, select the best model per a \ref criterion_function using
+ * \ref online_best_model and a \ref penalty_table held within \c workspace
+ * so that penalties are tabulated only when \c crit, \c N, or \c maxorder
+ * change, and compute its decorrelation time exactly as
+ * \ref arsel_batch does for each of its signals.  Every intermediate buffer
+ * is drawn from \c workspace so that fitting many signals of similar size in
+ * succession performs no heap allocation once \c workspace and \c r have
+ * been used at least once.  Only the best model is ever stored.  The cost
+ * of each \ref arsel_phase is recorded into <tt>r.timing</tt>.
  *
- * @return The distance from \c first to the best model.
+ * @param[in]     data_first    Beginning of the input data range.
+ * @param[in]     data_last     Exclusive end of the input data range.
+ * @param[out]    r             The result, an \ref arsel_result whose
+ *                              \c value_type is \c Value.
+ * @param[in]     crit          A function pointer obtained from
+ *                              <tt>criterion_function<Burg,Value>
+ *                              ::lookup_table</tt>.
+ * @param[in]     subtract_mean Per \ref arsel_batch.
+ * @param[in]     absrho        Per \ref arsel_batch.
+ * @param[in]     minorder      Per \ref arsel_batch.
+ * @param[in]     maxorder      Per \ref arsel_batch.
+ * @param[in]     window_T0     Per \ref arsel_batch.
+ * @param[in,out] workspace     Working storage reused across invocations.
+ * @param[in]     kernel        Inner loop kernels per \ref burg_recursion.
+ * @param[in]     stop          Stopping policy per \ref burg_recursion,
+ *                              for example a \ref burg_criterion_stop
+ *                              using \c crit, \c N, and \c minorder.
  *
- * @see evaluate_models(Criterion,Integer1,Integer2,InputIterator,OutputIterator)
+ * @returns the number data values processed within
+ *          <tt>[data_first, data_last)</tt>.
+ */
+template <class InputIterator,
+          class Result,
+          class Value,
+          class Kernel,
+          class Stop>
+std::size_t arsel_fit(
+        InputIterator                                data_first,
+        InputIterator                                data_last,
+        Result&                                      r,
+        typename penalty_table<Value>::builder       crit,
+        const bool                                   subtract_mean,
+        const bool                                   absrho,
+        const std::size_t                            minorder,
+        const std::size_t                            maxorder,
+        const double                                 window_T0,
+        burg_workspace<Value>&                       workspace,
+        const Kernel&                                kernel,
+        Stop                                         stop)
+{
+    using std::size_t;
+
+    typedef typename Result::instrumentation_type instrumentation_type;
+
+    // The selector requires N so copy the data as burg_method would
+    burg_workspace<Value>& w = workspace;
+    double t0 = instrumentation_type::now(), t1;
+    w.f.assign(data_first, data_last);
+    const size_t N = w.f.size();
+    w.b.resize(N);
+    t1 = instrumentation_type::now();
+    r.timing.record(arsel_load, t1 - t0, N, double(N) * sizeof(Value));
+    const size_t tabulated = N ? std::min(maxorder, N - 1) : 0;
+    const bool built = w.table.assign(crit, N, tabulated);
+    t0 = instrumentation_type::now();
+    r.timing.record(arsel_penalty, t0 - t1, built ? tabulated + 1 : 0,
+                    built ? double(tabulated + 1) * sizeof(Value) : 0.0);
+    w.selector.reserve(maxorder);
+    w.selector.criterion(w.table);
+    w.selector.reset(N, minorder);
+    r.maxorder = maxorder;
+    r.N = burg_method_inplace(w.f.begin(), w.f.end(), r.mu, r.maxorder,
+                              w.selector.params(),  w.selector.sigma2e(),
+                              w.selector.gain(),    w.selector.autocor(),
+                              subtract_mean, /* hierarchy? */ true,
+                              w.b.begin(), w.Ak, w.ac, kernel, stop);
+    r.timing.record(arsel_burg, instrumentation_type::now() - t0, r.maxorder,
+                    burg_bytes<Value>(N, r.maxorder));
+    arsel_select(r, w.selector, absrho, window_T0, w.rho);
+
+    return r.N;
+}
+
+/**
+ * Automatically fit an autoregressive model to one signal through
+ * \c maxorder.
+ * @copydetails arsel_fit(InputIterator,InputIterator,Result&,typename penalty_table<Value>::builder,const bool,const bool,const std::size_t,const std::size_t,const double,burg_workspace<Value>&,const Kernel&,Stop)
+ */
+template <class InputIterator,
+          class Result,
+          class Value,
+          class Kernel>
+std::size_t arsel_fit(
+        InputIterator                                data_first,
+        InputIterator                                data_last,
+        Result&                                      r,
+        typename penalty_table<Value>::builder       crit,
+        const bool                                   subtract_mean,
+        const bool                                   absrho,
+        const std::size_t                            minorder,
+        const std::size_t                            maxorder,
+        const double                                 window_T0,
+        burg_workspace<Value>&                       workspace,
+        const Kernel&                                kernel)
+{
+    return arsel_fit(data_first, data_last, r, crit, subtract_mean, absrho,
+                     minorder, maxorder, window_T0, workspace, kernel,
+                     burg_never_stop());
+}
+
+/**
+ * Automatically fit an autoregressive model to one signal using \ref
+ * burg_scalar_kernel.
+ * @copydetails arsel_fit(InputIterator,InputIterator,Result&,typename penalty_table<Value>::builder,const bool,const bool,const std::size_t,const std::size_t,const double,burg_workspace<Value>&,const Kernel&,Stop)
  */
-template <class    Criterion,
-          typename Integer1,
-          typename Integer2,
-          class    InputIterator>
-typename std::iterator_traits<InputIterator>::difference_type
-evaluate_models(Integer1      N,
-                Integer2      ordfirst,
-                InputIterator first,
-                InputIterator last)
+template <class InputIterator,
+          class Result,
+          class Value>
+std::size_t arsel_fit(
+        InputIterator                                data_first,
+        InputIterator                                data_last,
+        Result&                                      r,
+        typename penalty_table<Value>::builder       crit,
+        const bool                                   subtract_mean,
+        const bool                                   absrho,
+        const std::size_t                            minorder,
+        const std::size_t                            maxorder,
+        const double                                 window_T0,
+        burg_workspace<Value>&                       workspace)
 {
-    return evaluate_models<Criterion>(N, ordfirst, first, last, null_output());
+    return arsel_fit(data_first, data_last, r, crit, subtract_mean, absrho,
+                     minorder, maxorder, window_T0, workspace,
+                     burg_scalar_kernel());
 }
 
 /**
- * Obtain the best model according to \ref criterion applied to
- * \f$\sigma^2_\epsilon\f$ given a hierarchy of candidates.
- *
- * On input, \c params, \c sigma2e, \c gain, and \c autocor should be <a
- * href="http://www.sgi.com/tech/stl/Sequence.html">Sequence</a>s which were
- * populated by \ref burg_method when \c hierarchy is \c true (or in some other
- * equivalent manner).  On output, these arguments will contain only values
- * relevant to the best model.
- *
- * @param[in]     N        Sample count used to compute \f$\sigma^2_\epsilon\f$.
- *                         For example, the return value of \ref burg_method.
- * @param[in]     minorder Constrain the best model to be at least this order.
- *                         Supplying zero specifies no constraint.
- * @param[in,out] params   Model parameters
- * @param[in,out] sigma2e  \f$\sigma^2_\epsilon\f$
- * @param[in,out] gain     Model gain
- * @param[in,out] autocor  Model autocorrelations
+ * Automatically fit an autoregressive model to one signal per \ref arsel_fit
+ * but using \ref burg_method_chunked so that the prediction errors reside in
+ * \c store rather than in memory.  The cost of loading the data into \c
+ * store is included in that recorded for \ref arsel_burg whose nominal
+ * bytes count traffic to and from \c store.
  *
- * @return The index of the best model within the inputs.
+ * @param[in]     data_first      Beginning of the input data range.
+ * @param[in]     data_last       Exclusive end of the input data range.
+ * @param[out]    r               Per \ref arsel_fit.
+ * @param[in]     crit            Per \ref arsel_fit.
+ * @param[in]     subtract_mean   Per \ref arsel_batch.
+ * @param[in]     absrho          Per \ref arsel_batch.
+ * @param[in]     minorder        Per \ref arsel_batch.
+ * @param[in]     maxorder        Per \ref arsel_batch.
+ * @param[in]     window_T0       Per \ref arsel_batch.
+ * @param[in,out] workspace       Per \ref arsel_fit.  Its prediction error
+ *                                storage goes unused.
+ * @param[in,out] store           Per \ref burg_method_chunked.
+ * @param[in]     chunk           Per \ref burg_method_chunked.
+ * @param[in]     orders_per_pass Per \ref burg_method_chunked.
  *
- * @see best_model(Integer1,Integer2,Sequence1,Sequence2,Sequence3,Sequence4,OutputIterator)
+ * @returns the number data values processed within
+ *          <tt>[data_first, data_last)</tt>.
  */
-template <class    Criterion,
-          typename Integer1,
-          typename Integer2,
-          class    Sequence1,
-          class    Sequence2,
-          class    Sequence3,
-          class    Sequence4>
-typename Sequence1::difference_type
-best_model(Integer1       N,
-           Integer2       minorder,
-           Sequence1&     params,
-           Sequence2&     sigma2e,
-           Sequence3&     gain,
-           Sequence4&     autocor)
+template <class ForwardIterator,
+          class Result,
+          class Value,
+          class Store>
+std::size_t arsel_fit_chunked(
+        ForwardIterator                              data_first,
+        ForwardIterator                              data_last,
+        Result&                                      r,
+        typename penalty_table<Value>::builder       crit,
+        const bool                                   subtract_mean,
+        const bool                                   absrho,
+        const std::size_t                            minorder,
+        const std::size_t                            maxorder,
+        const double                                 window_T0,
+        burg_workspace<Value>&                       workspace,
+        Store&                                       store,
+        const std::size_t                            chunk,
+        const std::size_t                            orders_per_pass)
 {
-    return best_model<Criterion>(N, minorder, params, sigma2e, gain,
-                                 autocor, null_output());
+    using std::size_t;
+
+    typedef typename Result::instrumentation_type instrumentation_type;
+
+    // The selector requires N before any data is loaded
+    burg_workspace<Value>& w = workspace;
+    double t0 = instrumentation_type::now(), t1;
+    const size_t N = std::distance(data_first, data_last);
+    const size_t tabulated = N ? std::min(maxorder, N - 1) : 0;
+    const bool built = w.table.assign(crit, N, tabulated);
+    t1 = instrumentation_type::now();
+    r.timing.record(arsel_penalty, t1 - t0, built ? tabulated + 1 : 0,
+                    built ? double(tabulated + 1) * sizeof(Value) : 0.0);
+    w.selector.reserve(maxorder);
+    w.selector.criterion(w.table);
+    w.selector.reset(N, minorder);
+    r.maxorder = maxorder;
+    r.N = burg_method_chunked(data_first, data_last, r.mu, r.maxorder,
+                              w.selector.params(),  w.selector.sigma2e(),
+                              w.selector.gain(),    w.selector.autocor(),
+                              subtract_mean, /* hierarchy? */ true,
+                              store, chunk, orders_per_pass, w.Ak, w.ac,
+                              burg_never_stop());
+    r.timing.record(arsel_burg, instrumentation_type::now() - t1, r.maxorder,
+                    burg_bytes<Value>(N, r.maxorder));
+    arsel_select(r, w.selector, absrho, window_T0, w.rho);
+
+    return r.N;
 }
 
 /**
- * A template typedef and helper method returning a \ref best_model
- * implementation matching a model selection criterion provided at runtime.
- * Intended for use within interactive APIs, this method handles much of the
- * ugliness of resolving overloaded criterion logic and accounting for which
- * methods care as to whether or not the sample mean has been subtracted.
- * Class template parameters should be set to match the desired overload
- * returned by the \ref lookup method.
+ * Select and characterize the best model within a previously fit \ref
+ * burg_hierarchy exactly as \ref arsel_fit would have for the same data.
+ * Models beyond \c maxorder are ignored so a hierarchy fit through a higher
+ * order may be reused.  The cost of presenting the hierarchy to the
+ * selector is recorded as \ref arsel_burg with no orders computed.
  *
- * Methods are looked up using their abbreviations as follows:
- * <dl>
- * <dt>AIC </dt><dd>Akaike information criterion</dd>
- * <dt>AICC</dt><dd>asymptotically-corrected Akaike information criterion</dd>
- * <dt>BIC </dt><dd>consistent criterion BIC</dd>
- * <dt>CIC </dt><dd>combined information criterion</dd>
- * <dt>FIC </dt><dd>finite information criterion</dd>
- * <dt>FSIC</dt><dd>finite sample information criterion</dd>
- * <dt>GIC </dt><dd>generalized information criterion</dd>
- * <dt>MCC </dt><dd>minimally consistent criterion</dd>
- * </dl>
- * Leading or trailing whitespace as well as capitalization differences are
- * ignored.
+ * @param[in]     h             A hierarchy which \ref burg_hierarchy::covers
+ *                              \c maxorder.
+ * @param[out]    r             Per \ref arsel_fit.
+ * @param[in]     crit          Per \ref arsel_fit.
+ * @param[in]     absrho        Per \ref arsel_batch.
+ * @param[in]     minorder      Per \ref arsel_batch.
+ * @param[in]     maxorder      Per \ref arsel_batch.
+ * @param[in]     window_T0     Per \ref arsel_batch.
+ * @param[in,out] workspace     Per \ref arsel_fit.  Its prediction error
+ *                              storage goes unused.
  *
- * @tparam EstimationMethod One of Burg, YuleWalker, LSFB, or LSF.
- * @tparam Integer1         Per the \c Integer1 parameter of \ref best_model
- * @tparam Integer2         Per the \c Integer2 parameter of \ref best_model
- * @tparam Sequence1        Per the \c Sequence1 parameter of \ref best_model
- * @tparam Sequence2        Per the \c Sequence2 parameter of \ref best_model
- * @tparam Sequence3        Per the \c Sequence3 parameter of \ref best_model
- * @tparam Sequence4        Per the \c Sequence4 parameter of \ref best_model
+ * @returns the number data values from which \c h was fit.
+ * @throws std::invalid_argument if \c h does not cover \c maxorder.
  */
-template <template <class> class EstimationMethod,
-          typename Integer1,
-          typename Integer2,
-          class    Sequence1,
-          class    Sequence2 = Sequence1,
-          class    Sequence3 = Sequence2,
-          class    Sequence4 = Sequence3>
-struct best_model_function
+template <class Result,
+          class Value>
+std::size_t arsel_replay(
+        const burg_hierarchy<Value>&                 h,
+        Result&                                      r,
+        typename penalty_table<Value>::builder       crit,
+        const bool                                   absrho,
+        const std::size_t                            minorder,
+        const std::size_t                            maxorder,
+        const double                                 window_T0,
+        burg_workspace<Value>&                       workspace)
 {
-    /** The type returned by the \ref lookup function. */
-    typedef typename Sequence1::difference_type (*type)(Integer1   N,
-                                                        Integer2   minorder,
-                                                        Sequence1& params,
-                                                        Sequence2& sigma2e,
-                                                        Sequence3& gain,
-                                                        Sequence4& autocor);
-
-    /**
-     * Lookup a \ref best_model function pointer matching \c EstimationMethod,
-     * the specified criterion c abbreviation, and whether or not the sample
-     * mean has been subtracted from the data.
-     *
-     * @param abbreviation  Known abbreviations per \ref best_model_function.
-     *                      If only whitespace, a reasonable default is used.
-     * @param subtract_mean Has the sample mean been subtracted from the data?
-     *
-     * @tparam CharT     Permits use by any \c std::basic_string instantiation
-     * @tparam Traits    Permits use by any \c std::basic_string instantiation
-     * @tparam Allocator Permits use by any \c std::basic_string instantiation
-     *
-     * @return A function pointer which, when invoked, calls \ref best_model.
-     *         When no known criterion matches \c abbreviation, \c NULL
-     *         is returned.
-     */
-    template <class CharT, class Traits, class Allocator>
-    static type lookup(std::basic_string<CharT,Traits,Allocator> abbreviation,
-                       const bool subtract_mean);
+    using std::size_t;
 
-    /**
-     * Lookup a \ref best_model function pointer matching \c EstimationMethod,
-     * the specified criterion c abbreviation, and whether or not the sample
-     * mean has been subtracted from the data.
-     *
-     * @param abbreviation  Known abbreviations per \ref best_model_function.
-     *                      If only whitespace, a reasonable default is used.
-     * @param subtract_mean Has the sample mean been subtracted from the data?
-     *
-     * @return A function pointer which, when invoked, calls \ref best_model.
-     *         When no known criterion matches \c abbreviation, \c NULL
-     *         is returned.
-     */
-    static type lookup(const char *abbreviation, const bool subtract_mean)
+    typedef typename Result::instrumentation_type instrumentation_type;
+
+    AR_ENSURE_MSGEXCEPT(h.covers(maxorder),
+                        "hierarchy does not reach the maximum order",
+                        std::invalid_argument);
+
+    burg_workspace<Value>& w = workspace;
+    double t0 = instrumentation_type::now(), t1;
+    const size_t N = h.N;
+    const size_t p = N ? std::min(maxorder, N - 1) : 0;
+    const bool built = w.table.assign(crit, N, p);
+    t1 = instrumentation_type::now();
+    r.timing.record(arsel_penalty, t1 - t0, built ? p + 1 : 0,
+                    built ? double(p + 1) * sizeof(Value) : 0.0);
+    w.selector.reserve(maxorder);
+    w.selector.criterion(w.table);
+    w.selector.reset(N, minorder);
+
+    // Present results in the order produced by burg_recursion
+    typename online_best_model<Value>::params_iterator  params
+            = w.selector.params();
+    typename online_best_model<Value>::sigma2e_iterator sigma2e
+            = w.selector.sigma2e();
+    typename online_best_model<Value>::gain_iterator    gain
+            = w.selector.gain();
+    *sigma2e++ = h.sigma2e[0];
+    *gain++    = h.gain[0];
+    typename burg_hierarchy<Value>::vector_type::const_iterator a
+            = h.params.begin();
+    for (size_t k = 1; k <= p; a += k, ++k)
     {
-        std::string s(abbreviation);
-        return lookup(s, subtract_mean);
+        params     = std::copy(a, a + k, params);
+        *sigma2e++ = h.sigma2e[k];
+        *gain++    = h.gain[k];
     }
-};
+    std::copy(h.autocor.begin(), h.autocor.begin() + p + 1,
+              w.selector.autocor());
+    r.N        = N;
+    r.mu       = h.mu;
+    r.maxorder = p;
+    r.timing.record(arsel_burg, instrumentation_type::now() - t1, 0,
+                    double(p + 1) * (p + 6) / 2 * sizeof(Value));
+    arsel_select(r, w.selector, absrho, window_T0, w.rho);
+
+    return r.N;
+}
 
-template <template <class> class EstimationMethod,
-          typename Integer1,
-          typename Integer2,
-          class    Sequence1,
-          class    Sequence2,
-          class    Sequence3,
-          class    Sequence4>
-template <class CharT, class Traits, class Allocator>
-typename best_model_function<
-    EstimationMethod,Integer1,Integer2,Sequence1,Sequence2,Sequence3,Sequence4
->::type
-best_model_function<
-    EstimationMethod,Integer1,Integer2,Sequence1,Sequence2,Sequence3,Sequence4
->::lookup(std::basic_string<CharT,Traits,Allocator> abbrev,
-          const bool subtract_mean)
+/**
+ * Automatically fit autoregressive models to many signals at once using \ref
+ * burg_method, select the best model for each per \ref criterion_function,
+ * and compute each decorrelation time per \ref decorrelation_time truncated
+ * at a relative tolerance of machine epsilon.  Signals are distributed
+ * across OpenMP threads using dynamic scheduling so that idle threads take
+ * the next unprocessed signal.  Every thread owns its working storage which
+ * is reused across the signals it processes.
+ *
+ * Signal \c i is <tt>[firsts[i], lasts[i])</tt> and its results are stored
+ * into <tt>results[i]</tt>, an \ref arsel_result whose \c value_type sets
+ * the working precision.  Results do not depend on the number of threads.
+ * Any exception thrown while processing a signal is rethrown after all
+ * threads complete, as a <tt>std::runtime_error</tt> with the same message.
+ *
+ * @param[in]  M             Number of signals.
+ * @param[in]  firsts        Beginning iterators for each signal.
+ * @param[in]  lasts         Exclusive end iterators for each signal.
+ * @param[out] results       Destination for the \c M results.
+ * @param[in]  criterion     Model selection criterion abbreviation
+ *                           per \ref criterion_function.
+ * @param[in]  subtract_mean Should each sample mean be subtracted?
+ * @param[in]  absrho        Use \f$\left|\rho\right|\f$ when computing
+ *                           decorrelation times?
+ * @param[in]  minorder      Minimum model order to select.
+ * @param[in]  maxorder      Maximum model order to consider.
+ * @param[in]  window_T0     Decorrelation times are integrated to lag
+ *                           <tt>window_T0 * N</tt>.
+ * @param[in]  nthreads      Number of threads or zero for the OpenMP default.
+ * @param[in]  kernel        Inner loop kernels per \ref burg_recursion.
+ *
+ * @throws std::invalid_argument if \c criterion is unknown.
+ */
+template <class RandomAccessIterator1,
+          class RandomAccessIterator2,
+          class RandomAccessIterator3,
+          class Kernel>
+void arsel_batch(const std::size_t     M,
+                 RandomAccessIterator1 firsts,
+                 RandomAccessIterator2 lasts,
+                 RandomAccessIterator3 results,
+                 const std::string&    criterion,
+                 const bool            subtract_mean,
+                 const bool            absrho,
+                 const std::size_t     minorder,
+                 const std::size_t     maxorder,
+                 const double          window_T0,
+                 const int             nthreads,
+                 const Kernel&         kernel)
 {
-    using std::basic_string;
-    using std::toupper;
+    using std::ptrdiff_t;
+    using std::string;
+
+    typedef typename std::iterator_traits<
+            RandomAccessIterator3
+        >::value_type result_type;
+    typedef typename result_type::value_type Value;
+    typedef criterion_function<Burg, Value> criterion_function_type;
+
+    const typename criterion_function_type::table_type crit
+            = criterion_function_type::lookup_table(criterion, subtract_mean);
+    AR_ENSURE_MSGEXCEPT(crit, "Unknown model selection criterion",
+                        std::invalid_argument);
+
+#ifdef _OPENMP
+    const int T = nthreads > 0 ? nthreads : omp_get_max_threads();
+#else
+    (void) nthreads;
+#endif
+    bool   failed = false;
+    string error;
 
-    // Canonicalize the abbreviation by making it uppercase and trimming it
-    // For nothing but this reason the method accepts 'abbrev' by value
-    typedef basic_string<CharT,Traits,Allocator> string_type;
-    for (typename string_type::iterator p = abbrev.begin();
-         abbrev.end() != p; ++p)
+#ifdef _OPENMP
+#pragma omp parallel num_threads(T) if (M > 1)
+#endif
     {
-        *p = toupper(*p);
+        // Per-thread working storage reused across signals
+        burg_workspace<Value> workspace(0, maxorder);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (ptrdiff_t i = 0; i < static_cast<ptrdiff_t>(M); ++i)
+        {
+            try
+            {
+                arsel_fit(firsts[i], lasts[i], results[i], crit,
+                          subtract_mean, absrho, minorder, maxorder,
+                          window_T0, workspace, kernel);
+            }
+            catch (std::exception& e)
+            {
+#ifdef _OPENMP
+#pragma omp critical(ar_arsel_batch)
+#endif
+                if (!failed) { failed = true; error = e.what(); }
+            }
+        }
     }
-    abbrev.erase(0, abbrev.find_first_not_of(" \n\r\t"));
-    abbrev.erase(1 + abbrev.find_last_not_of(" \n\r\t"));
 
-    // Obtain best_model(...) per abbrev, subtract_mean, EstimationMethod
-    // and assign to retval to provide unambiguous overload resolution.
-    type retval;
+    AR_ENSURE_MSGEXCEPT(!failed, error, std::runtime_error);
+}
 
-    if      (abbrev.empty() || 0 == abbrev.compare("CIC" ))  // Default
-    {
-        if (subtract_mean)
-            retval = best_model<CIC<EstimationMethod<mean_subtracted> > >;
-        else
-            retval = best_model<CIC<EstimationMethod<mean_retained  > > >;
-    }
-    else if (0 == abbrev.compare("AIC" ))
-    {
-        retval = best_model<AIC>;
-    }
-    else if (0 == abbrev.compare("AICC"))
-    {
-        retval = best_model<AICC>;
-    }
-    else if (0 == abbrev.compare("BIC" ))
-    {
-        retval = best_model<BIC>;
-    }
-    else if (0 == abbrev.compare("FIC" ))
-    {
-        if (subtract_mean)
-            retval = best_model<FIC<EstimationMethod<mean_subtracted> > >;
-        else
-            retval = best_model<FIC<EstimationMethod<mean_retained  > > >;
-    }
-    else if (0 == abbrev.compare("FSIC"))
-    {
-        if (subtract_mean)
-            retval = best_model<FSIC<EstimationMethod<mean_subtracted> > >;
-        else
-            retval = best_model<FSIC<EstimationMethod<mean_retained  > > >;
-    }
-    else if (0 == abbrev.compare("GIC" ))
-    {
-        retval = best_model<GIC<> >;
-    }
-    else if (0 == abbrev.compare("MCC" ))
-    {
-        retval = best_model<MCC>;
-    } else
+/**
+ * Automatically fit autoregressive models to many signals at once using \ref
+ * burg_scalar_kernel.
+ * @copydetails arsel_batch(const std::size_t,RandomAccessIterator1,RandomAccessIterator2,RandomAccessIterator3,const std::string&,const bool,const bool,const std::size_t,const std::size_t,const double,const int,const Kernel&)
+ */
+template <class RandomAccessIterator1,
+          class RandomAccessIterator2,
+          class RandomAccessIterator3>
+void arsel_batch(const std::size_t     M,
+                 RandomAccessIterator1 firsts,
+                 RandomAccessIterator2 lasts,
+                 RandomAccessIterator3 results,
+                 const std::string&    criterion,
+                 const bool            subtract_mean,
+                 const bool            absrho,
+                 const std::size_t     minorder,
+                 const std::size_t     maxorder,
+                 const double          window_T0 = 1,
+                 const int             nthreads  = 0)
+{
+    arsel_batch(M, firsts, lasts, results, criterion, subtract_mean,
+                absrho, minorder, maxorder, window_T0, nthreads,
+                burg_scalar_kernel());
+}
+
+/**
+ * Automatically fit autoregressive models to many signals of equal length
+ * per \ref arsel_batch but using \ref burg_method_lockstep to process
+ * consecutive groups of \c lanes signals together.  Groups are distributed
+ * across OpenMP threads using dynamic scheduling.  Results are bit-for-bit
+ * identical to those of \ref arsel_batch using \ref burg_scalar_kernel.
+ *
+ * @param[in]  M             Number of signals.
+ * @param[in]  N             Number of samples in every signal.
+ * @param[in]  firsts        Random access beginning iterators for each signal.
+ * @param[out] results       Destination for the \c M results.
+ * @param[in]  criterion     Per \ref arsel_batch.
+ * @param[in]  subtract_mean Per \ref arsel_batch.
+ * @param[in]  absrho        Per \ref arsel_batch.
+ * @param[in]  minorder      Per \ref arsel_batch.
+ * @param[in]  maxorder      Per \ref arsel_batch.
+ * @param[in]  window_T0     Per \ref arsel_batch.
+ * @param[in]  nthreads      Per \ref arsel_batch.
+ * @param[in]  lanes         Number of signals processed in lockstep.
+ *
+ * @throws std::invalid_argument if \c criterion is unknown.
+ */
+template <class RandomAccessIterator1,
+          class RandomAccessIterator2>
+void arsel_batch_lockstep(const std::size_t     M,
+                          const std::size_t     N,
+                          RandomAccessIterator1 firsts,
+                          RandomAccessIterator2 results,
+                          const std::string&    criterion,
+                          const bool            subtract_mean,
+                          const bool            absrho,
+                          const std::size_t     minorder,
+                          const std::size_t     maxorder,
+                          const double          window_T0 = 1,
+                          const int             nthreads  = 0,
+                          const std::size_t     lanes     = 8)
+{
+    using std::min;
+    using std::ptrdiff_t;
+    using std::size_t;
+    using std::string;
+    using std::vector;
+
+    typedef typename std::iterator_traits<
+            RandomAccessIterator2
+        >::value_type result_type;
+    typedef typename result_type::value_type Value;
+    typedef criterion_function<Burg, Value> criterion_function_type;
+    typedef online_best_model<Value> selector_type;
+
+    const typename criterion_function_type::table_type crit
+            = criterion_function_type::lookup_table(criterion, subtract_mean);
+    AR_ENSURE_MSGEXCEPT(crit, "Unknown model selection criterion",
+                        std::invalid_argument);
+    AR_ENSURE_ARG(lanes > 0);
+
+    // Every signal shares N so every thread may share one penalty table
+    // whose cost is recorded against the first signal
+    typedef typename result_type::instrumentation_type instrumentation_type;
+    const double t0 = instrumentation_type::now();
+    const size_t tabulated = N ? min(maxorder, N - 1) : 0;
+    const penalty_table<Value> table(crit, N, tabulated);
+    if (M) results[0].timing.record(arsel_penalty,
+                                    instrumentation_type::now() - t0,
+                                    tabulated + 1,
+                                    double(tabulated + 1) * sizeof(Value));
+
+    const ptrdiff_t G = (M + lanes - 1) / lanes;  // Number of groups
+#ifdef _OPENMP
+    const int T = nthreads > 0 ? nthreads : omp_get_max_threads();
+#else
+    (void) nthreads;
+#endif
+    bool   failed = false;
+    string error;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(T) if (G > 1)
+#endif
     {
-        retval = NULL;
+        // Per-thread working storage reused across groups
+        vector<Value> f, b, Ak, ac, mu(lanes);
+        basic_predictor<Value> rho;
+        selector_type prototype(NULL, N, minorder, maxorder);
+        prototype.criterion(table);
+        vector<selector_type> selectors(lanes, prototype);
+        vector<typename selector_type::params_iterator>  params_out;
+        vector<typename selector_type::sigma2e_iterator> sigma2e_out;
+        vector<typename selector_type::gain_iterator>    gain_out;
+        vector<typename selector_type::autocor_iterator> autocor_out;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (ptrdiff_t g = 0; g < G; ++g)
+        {
+            try
+            {
+                // Estimate hierarchies of models for the entire group
+                const size_t first = g*lanes, K = min(lanes, M - first);
+                params_out .clear();
+                sigma2e_out.clear();
+                gain_out   .clear();
+                autocor_out.clear();
+                for (size_t k = 0; k < K; ++k)
+                {
+                    selectors[k].reset(N, minorder);
+                    params_out .push_back(selectors[k].params());
+                    sigma2e_out.push_back(selectors[k].sigma2e());
+                    gain_out   .push_back(selectors[k].gain());
+                    autocor_out.push_back(selectors[k].autocor());
+                }
+                size_t p = maxorder;
+                const double t1 = instrumentation_type::now();
+                burg_method_lockstep(K, firsts + first, N, mu.begin(), p,
+                                     params_out.begin(), sigma2e_out.begin(),
+                                     gain_out.begin(), autocor_out.begin(),
+                                     subtract_mean, /* hierarchy? */ true,
+                                     f, b, Ak, ac);
+                const double dt = instrumentation_type::now() - t1;
+
+                // Keep only the best model from each hierarchy
+                // Loading and recursion costs are shared across the group
+                for (size_t k = 0; k < K; ++k)
+                {
+                    result_type& r = results[first + k];
+                    r.N        = N;
+                    r.maxorder = p;
+                    r.mu       = mu[k];
+                    r.timing.record(arsel_burg, dt / K, p,
+                                    burg_bytes<Value>(N, p));
+                    arsel_select(r, selectors[k], absrho, window_T0, rho);
+                }
+            }
+            catch (std::exception& e)
+            {
+#ifdef _OPENMP
+#pragma omp critical(ar_arsel_batch)
+#endif
+                if (!failed) { failed = true; error = e.what(); }
+            }
+        }
     }
 
-    return retval;
+    AR_ENSURE_MSGEXCEPT(!failed, error, std::runtime_error);
 }
 
 /**
@@ -11,6 +11,7 @@
  */
 
 #include <sys/time.h>
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
@@ -24,12 +25,13 @@
 struct Arg : public option::Arg
 {
     static option::ArgStatus IntNonNeg(const option::Option& opt, bool msg);
+    static option::ArgStatus IntPos   (const option::Option& opt, bool msg);
     static option::ArgStatus Double   (const option::Option& opt, bool msg);
 };
 
 // Command line argument declarations for optionparser.h usage
 enum OptionIndex {
-    UNKNOWN, BURN, SEED, TFINAL, HELP
+    UNKNOWN, BLOCK, BURN, SEED, TFINAL, THREADS, HELP
 };
 const option::Descriptor usage[] = {
     {UNKNOWN, 0, "", "", Arg::None,
@@ -40,12 +42,18 @@ const option::Descriptor usage[] = {
      "\n"
      "Options:" },
     {0,0,"","",Arg::None,0}, // table break
+    {BLOCK,    0, "B", "block",    Arg::IntPos,
+     "  -B \t--block=L    \t Synthesize one stationary realization in blocks of"
+     " length L generated concurrently instead of iterating serially with"
+     " burn-in.  Output depends on SEED and L but not on J" },
     {BURN,     0, "b", "burn",     Arg::IntNonNeg,
      "  -b \t--burn=BURN  \t \"Burn-in\" for 0 <= t < BURN defaulting to 500" },
     {SEED,     0, "s", "seed",     Arg::Double,
      "  -s \t--seed=SEED  \t Random seed defaulting to gettimeofday tv_usec"  },
     {TFINAL,   0, "t", "tfinal",   Arg::IntNonNeg,
      "  -t \t--tfinal=T   \t Advance time until t >= T defaulting to 3000"    },
+    {THREADS,  0, "j", "threads",  Arg::IntNonNeg,
+     "  -j \t--threads=J  \t Use J threads with --block defaulting to OpenMP's"},
     {HELP,     0, "h", "help",     Arg::None,
      "  -h \t--help       \t Display this help message and immediately exit"  },
     {0,0,0,0,0,0}
@@ -65,13 +73,21 @@ static double rand0point1() {
     return sqrt(0.1) * rand01();
 }
 
+// Functor permitting ar::basic_predictor to inline rand0point1
+struct noise {
+    double operator()() const { return rand0point1(); }
+};
+
 int main(int argc, char *argv[])
 {
     using namespace std;
 
-    long t      = 0;
-    long burn   = 500;
-    long tfinal = 3000;
+    long t       = 0;
+    long burn    = 500;
+    long tfinal  = 3000;
+    long block   = 0;
+    long threads = 0;
+    unsigned long long seed;
 
     {
         option::Stats stats(usage, argc-(argc>0), argv+(argc>0));
@@ -95,17 +111,23 @@ int main(int argc, char *argv[])
 
         // SEED must come before any other randomly-generated option
         if (opts[SEED]) {
-            srandom((unsigned) strtol(opts[SEED].last()->arg, NULL, 10));
+            seed = strtol(opts[SEED].last()->arg, NULL, 10);
+            srandom((unsigned) seed);
         } else {
             struct timeval tv;
             struct timezone tz;
             gettimeofday(&tv, &tz);
+            seed = tv.tv_usec;
             srand((unsigned) tv.tv_usec);
         }
 
         // Parse remaining options
         if (opts[BURN  ]) burn   = strtol(opts[BURN  ].last()->arg, NULL, 10);
         if (opts[TFINAL]) tfinal = strtol(opts[TFINAL].last()->arg, NULL, 10);
+        if (opts[BLOCK ]) block  = strtol(opts[BLOCK ].last()->arg, NULL, 10);
+        if (opts[THREADS]) {
+            threads = strtol(opts[THREADS].last()->arg, NULL, 10);
+        }
 
         // Warn whenever burn >= tfinal
         if (burn >= tfinal) {
@@ -123,7 +145,26 @@ int main(int argc, char *argv[])
     params.push_back(-1 * -1.0401);
     params.push_back(-1 * +0.2139);
     params.push_back(-1 * -0.0133);
-    ar::predictor<double> p(params.begin(), params.end(), rand0point1);
+    cout.precision(numeric_limits<double>::digits10 + 2);
+    cout << showpos;
+
+    // Synthesize one stationary realization generating blocks concurrently
+    if (block) {
+        double gain;
+        std::vector<double> autocor;
+        ar::model_autocorrelation(params.begin(), params.end(),
+                                  gain, back_inserter(autocor));
+        std::vector<double> x(max(0L, tfinal - burn));
+        ar::synthesize(params.begin(), params.end(), 0.1, gain,
+                       autocor.begin(), x.size(), x.begin(),
+                       seed, block, threads);
+        for (size_t i = 0; i < x.size(); ++i) {
+            cout << burn + (long) i << '\t' << x[i] << '\n';
+        }
+        return EXIT_SUCCESS;
+    }
+
+    ar::basic_predictor<double, noise, 6> p(params.begin(), params.end());
 
     std::vector<double> initial;
     for (size_t i = 0; i < params.size(); ++i) {
@@ -136,11 +177,14 @@ int main(int argc, char *argv[])
         // NOP
     }
 
-    // Output (t, x, y, z) during burn < t <= tfinal
-    cout.precision(numeric_limits<double>::digits10 + 2);
-    cout << showpos;
-    for (; t < tfinal; ++t, ++p) {
-        cout << t << '\t' << *p << '\n';
+    // Output (t, x) during burn < t <= tfinal generating blocks of x
+    std::vector<double> x(4096);
+    while (t < tfinal) {
+        const size_t n = std::min<long>(x.size(), tfinal - t);
+        p.generate(x.begin(), n);
+        for (size_t i = 0; i < n; ++i, ++t) {
+            cout << t << '\t' << x[i] << '\n';
+        }
     }
 
     return EXIT_SUCCESS;
@@ -160,6 +204,20 @@ option::ArgStatus Arg::IntNonNeg(const option::Option& opt, bool msg)
     return option::ARG_ILLEGAL;
 }
 
+option::ArgStatus Arg::IntPos(const option::Option& opt, bool msg)
+{
+    char *p = 0;
+    if (opt.arg) {
+        double v = strtol(opt.arg, &p, 10);
+        if (p != opt.arg && !*p && v > 0) return option::ARG_OK;
+    }
+    if (msg) {
+        (std::cerr << "Option ").write(opt.name, opt.namelen)
+                    << " requires a positive integer argument\n";
+    }
+    return option::ARG_ILLEGAL;
+}
+
 option::ArgStatus Arg::Double(const option::Option& opt, bool msg)
 {
     char *p = 0;
@@ -5,23 +5,28 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 /** @file
- * Estimate the best AR(p) model given data on standard input.  Illustrates
- * \ref ar::autocorrelation, \ref ar::predictor,
- * and \ref ar::decorrelation_time.
+ * Estimate the best AR(p) model given data on standard input or within a
+ * file.  Illustrates \ref ar::autocorrelation, \ref ar::predictor,
+ * \ref ar::decorrelation_time, and \ref ar::burg_method_chunked.
  */
 
 #include <algorithm>
+#include <cmath>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "ar.hpp"
 #include "optionparser.h"
 #include "real.hpp"
+#include "samples.hpp"
 
 #define STRINGIFY_HELPER(x) #x
 #define STRINGIFY(x) STRINGIFY_HELPER(x)
@@ -35,40 +40,178 @@ struct Arg : public option::Arg
 
 // Command line argument declarations for optionparser.h usage
 enum OptionIndex {
-    UNKNOWN, CRITERION, HELP, MAXORDER, MINORDER, NONABSRHO, SUBMEAN, WINT0
+    UNKNOWN, CACHE, COLUMNS, CRITERION, FORMAT, HELP, KERNEL, MAXORDER, MINORDER, NONABSRHO, OUTOFCORE, PASSORDERS, SPECTRUM, SUBMEAN, TIMING, WINT0
 };
 const option::Descriptor usage[] = {
     {UNKNOWN, 0, "", "",      option::Arg::None,
-     "Usage: arsel [OPTION]...\n"
-     "Fit an optimal autoregressive model to data from standard input ("
+     "Usage: arsel [OPTION]... [FILE]\n"
+     "Fit an optimal autoregressive model to data from FILE or standard input ("
          /* Working precision */ STRINGIFY(REAL) ").\n"
      "\n"
      "Options:" },
     {0,0,"","",Arg::None,0}, // table break
+    {PASSORDERS, 0, "b",  "orders-per-pass",   Arg::NonNegative,
+     "  -b \t--orders-per-pass=L  \tApply up to L orders per out-of-core pass (default 1); L > 1 only approximates in-core results" },
+    {CACHE,     0,  "H",  "cache",             Arg::NonEmpty,
+     "  -H \t--cache=DIR  \tReuse model hierarchies cached within DIR across runs" },
+    {COLUMNS,   0,  "C",  "columns",           Arg::None,
+     "  -C \t--columns  \tFit each whitespace-separated column of text input as a separate signal" },
     {CRITERION, 0,  "c",  "criterion",         Arg::NonEmpty,
      "  -c \t--criterion=ABBREV  \tUse the specified model selection criterion" },
+    {FORMAT,    0,  "f",  "format",            Arg::NonEmpty,
+     "  -f \t--format=FMT  \tRead 'text' (default), raw 'u8', 'f32', or 'f64', or 'npy' input" },
     {HELP,      0,  "h", "help",               Arg::None,
      "  -h \t--help   \tDisplay this help message and immediately exit" },
+    {KERNEL,    0,  "k",  "kernel",            Arg::NonEmpty,
+     "  -k \t--kernel=NAME  \tUse 'scalar' (default), 'simd', 'fused', or 'parallel' Burg kernels" },
     {MINORDER,  0,  "M",  "minorder",          Arg::NonNegative,
      "  -M \t--minorder=MIN  \tConsider only models of at least order AR(p=MIN)" },
     {MAXORDER,  0,  "m",  "maxorder",          Arg::NonNegative,
      "  -m \t--maxorder=MAX  \tConsider only models of at most order AR(p=MAX)" },
     {NONABSRHO, 0,  "n",  "non-absolute-rho",  Arg::None,
      "  -n \t--non-absolute-rho   \tUse non-absolute autocorrelation when computing T0" },
+    {OUTOFCORE, 0,  "o",  "out-of-core",       Arg::NonEmpty,
+     "  -o \t--out-of-core=DIR  \tKeep prediction errors in a temporary file within DIR" },
+    {SPECTRUM,  0,  "S",  "spectrum",          Arg::NonNegative,
+     "  -S \t--spectrum=K  \tOutput the power spectral density at K frequencies from 0 to pi" },
     {SUBMEAN,   0,  "s",  "subtract-mean",     Arg::None,
      "  -s \t--subtract-mean  \tSubtract the sample mean from the incoming data" },
+    {TIMING,    0,  "t",  "timing",            Arg::None,
+     "  -t \t--timing  \tOutput the seconds, iterations, and bytes of each phase" },
     {WINT0,   0,    "w",  "window-T0",         Arg::NonNegative,
      "  -w \t--window-T0=W  \tIntegrate T0 until W times the data length (default 1)" },
     {0,0,0,0,0,0}
 };
 
+// Signals are columns within row-major input data
+typedef ar::strided_adaptor<const real*> column_iterator;
+
+// Results record per-phase timing which is output only upon request
+typedef ar::arsel_result<real, ar::arsel_timing> result_type;
+
+// Fit, select, and characterize models for every signal using the given kernel
+template <class Kernel>
+static void fit(const Kernel&                         kernel,
+                std::vector<column_iterator>&         firsts,
+                std::vector<column_iterator>&         lasts,
+                std::vector<result_type>&             results,
+                const std::string&                    criterion,
+                const bool                            subtract_mean,
+                const bool                            absolute_rho,
+                const std::size_t                     minorder,
+                const std::size_t                     maxorder,
+                const double                          window_T0)
+{
+    ar::arsel_batch(firsts.size(), firsts.begin(), lasts.begin(),
+                    results.begin(), criterion, subtract_mean, absolute_rho,
+                    minorder, maxorder, window_T0, /* default nthreads */ 0,
+                    kernel);
+}
+
+// Fit, select, and characterize models for every signal reusing any hierarchy
+// cached within directory per samples::cache and otherwise caching a new one
+template <class Kernel>
+static void fit_cached(const Kernel&                 kernel,
+                       const char*                   directory,
+                       std::vector<column_iterator>& firsts,
+                       std::vector<column_iterator>& lasts,
+                       std::vector<result_type>&     results,
+                       const std::string&            criterion,
+                       const bool                    subtract_mean,
+                       const bool                    absolute_rho,
+                       const std::size_t             minorder,
+                       const std::size_t             maxorder,
+                       const double                  window_T0)
+{
+    typedef ar::criterion_function<ar::Burg, real> criterion_function;
+    const criterion_function::table_type crit
+            = criterion_function::lookup_table(criterion, subtract_mean);
+    const samples::cache cache(directory);
+    const std::ptrdiff_t M = firsts.size();
+    bool failed = false;
+    std::string error;
+#ifdef _OPENMP
+#pragma omp parallel if (M > 1)
+#endif
+    {
+        ar::burg_workspace<real> workspace(0, maxorder);
+        ar::burg_hierarchy<real> h;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (std::ptrdiff_t j = 0; j < M; ++j) {
+            try {
+                result_type& r = results[j];
+                double t0 = ar::arsel_timing::now(), t1;
+                samples::digest key;
+                key.update(firsts[j], lasts[j]);
+                t1 = ar::arsel_timing::now();
+                r.timing.record(ar::arsel_load, t1 - t0, key.size(),
+                                double(key.size()) * sizeof(real));
+                if (!cache.load(key, subtract_mean, maxorder, h)) {
+                    h.assign(firsts[j], lasts[j], subtract_mean, maxorder,
+                             workspace, kernel);
+                    r.timing.record(ar::arsel_burg,
+                                    ar::arsel_timing::now() - t1, h.maxorder,
+                                    ar::burg_bytes<real>(h.N, h.maxorder));
+                    cache.store(key, h);
+                }
+                ar::arsel_replay(h, r, crit, absolute_rho, minorder,
+                                 maxorder, window_T0, workspace);
+            } catch (std::exception& e) {
+#ifdef _OPENMP
+#pragma omp critical(arsel_fit_cached)
+#endif
+                if (!failed) { failed = true; error = e.what(); }
+            }
+        }
+    }
+    if (failed) throw std::runtime_error(error);
+}
+
+// Fit, select, and characterize models for every signal in turn keeping
+// prediction errors within a temporary file per ar::arsel_fit_chunked
+static void fit_chunked(const char*                   directory,
+                        const std::size_t             orders_per_pass,
+                        std::vector<column_iterator>& firsts,
+                        std::vector<column_iterator>& lasts,
+                        std::vector<result_type>&     results,
+                        const std::string&            criterion,
+                        const bool                    subtract_mean,
+                        const bool                    absolute_rho,
+                        const std::size_t             minorder,
+                        const std::size_t             maxorder,
+                        const double                  window_T0)
+{
+    typedef ar::criterion_function<ar::Burg, real> criterion_function;
+    const criterion_function::table_type crit
+            = criterion_function::lookup_table(criterion, subtract_mean);
+    samples::scratch<real> store(directory);
+    ar::burg_workspace<real> workspace(0, maxorder);
+    for (std::size_t j = 0; j < firsts.size(); ++j) {
+        ar::arsel_fit_chunked(firsts[j], lasts[j], results[j], crit,
+                              subtract_mean, absolute_rho, minorder,
+                              maxorder, window_T0, workspace, store,
+                              /* chunk */ 1048576, orders_per_pass);
+    }
+}
+
 int main(int argc, char *argv[])
 {
     using namespace std;
 
     // Parse and process any command line arguments using optionparser.h
+    bool   columns       = false;
     string criterion     = "CIC";
+    string format        = "text";
+    string kernel        = "scalar";
+    string cache;
+    string out_of_core;
+    string path;
+    size_t orders_per_pass = 1;
+    size_t spectrum      = 0;
     bool   subtract_mean = false;
+    bool   timing        = false;
     size_t minorder      = 0;
     size_t maxorder      = 512;
     bool   absolute_rho  = true;
@@ -93,9 +236,21 @@ int main(int argc, char *argv[])
             return EXIT_SUCCESS;
         }
 
+        if (options[CACHE])
+            cache = options[CACHE].last()->arg;
+
+        if (options[COLUMNS])
+            columns = true;
+
         if (options[CRITERION])
             criterion = options[CRITERION].last()->arg;
 
+        if (options[FORMAT])
+            format = options[FORMAT].last()->arg;
+
+        if (options[KERNEL])
+            kernel = options[KERNEL].last()->arg;
+
         if (options[MAXORDER])
             maxorder = (size_t) strtol(options[MAXORDER].last()->arg, NULL, 10);
 
@@ -105,84 +260,237 @@ int main(int argc, char *argv[])
         if (options[NONABSRHO])
             absolute_rho = false;
 
+        if (options[OUTOFCORE])
+            out_of_core = options[OUTOFCORE].last()->arg;
+
+        if (options[PASSORDERS])
+            orders_per_pass = (size_t) strtol(options[PASSORDERS].last()->arg, NULL, 10);
+
+        if (options[SPECTRUM])
+            spectrum = (size_t) strtol(options[SPECTRUM].last()->arg, NULL, 10);
+
         if (options[SUBMEAN])
             subtract_mean = true;
 
+        if (options[TIMING])
+            timing = true;
+
         if (options[WINT0])
             window_T0 = strtod(options[WINT0].last()->arg, NULL);
+
+        if (parse.nonOptionsCount() > 1) {
+            cerr << "At most one input FILE may be given\n";
+            return EXIT_FAILURE;
+        }
+        if (parse.nonOptionsCount())
+            path = parse.nonOption(0);
     }
 
-    // Look up desired model selection criterion using ar::best_model_function
-    // best_model_function template parameters fit ar::burg_method usage below
+    // Check desired model selection criterion using ar::best_model_function
+    // best_model_function template parameters fit ar::arsel_batch usage below
     typedef ar::best_model_function<
                 ar::Burg,size_t,size_t,vector<real>
             > best_model_function;
-    const best_model_function::type best_model
-            = best_model_function::lookup(criterion, subtract_mean);
-    if (!best_model) {
+    if (!best_model_function::lookup(criterion, subtract_mean)) {
         cerr << "Unknown model selection criterion: " << criterion << "\n";
         return EXIT_FAILURE;
     }
+    if (   kernel != "scalar" && kernel != "simd"
+        && kernel != "fused"  && kernel != "parallel") {
+        cerr << "Unknown kernel: " << kernel << "\n";
+        return EXIT_FAILURE;
+    }
+    if (!cache.empty() && !out_of_core.empty()) {
+        cerr << "Options --cache and --out-of-core are mutually exclusive\n";
+        return EXIT_FAILURE;
+    }
+    samples::format input;
+    if (!samples::parse_format(format, input)) {
+        cerr << "Unknown format: " << format << "\n";
+        return EXIT_FAILURE;
+    }
+    if (columns && input != samples::TEXT) {
+        cerr << "Option --columns applies only to text input"
+                " as two dimensional npy input supplies its own columns\n";
+        return EXIT_FAILURE;
+    }
+
+    // Read either one signal or, when requested, one signal per column
+    // Blank lines, and so lines containing only comments, are skipped
+    // Binary input is used in place while two dimensional NumPy input
+    // always provides one signal per column
+    const double read_begin = ar::arsel_timing::now();
+    vector<real> data;
+    auto_ptr<samples::source<real> > in;
+    size_t M = 1;
+    if (columns) {
+        ifstream file;
+        if (!path.empty()) {
+            file.open(path.c_str());
+            if (!file) {
+                cerr << "Unable to open " << path << "\n";
+                return EXIT_FAILURE;
+            }
+        }
+        istream& is_text = path.empty() ? cin : file;
+        M = 0;
+        string line;
+        while (getline(is_text, line)) {
+            istringstream is(line);
+            size_t k = 0;
+            for (real x; is >> x; ++k) data.push_back(x);
+            if (k == 0) continue;
+            if (M == 0) M = k;
+            if (k != M) {
+                cerr << "Expected " << M << " columns but found " << k
+                     << " on line: " << line << "\n";
+                return EXIT_FAILURE;
+            }
+        }
+        if (M == 0) M = 1;
+    } else {
+        try {
+            in.reset(path.empty()
+                     ? new samples::source<real>(input)
+                     : new samples::source<real>(input, path.c_str()));
+        } catch (std::exception& e) {
+            cerr << "Unable to read " << format << " input: " << e.what() << "\n";
+            return EXIT_FAILURE;
+        }
+        M = in->columns();
+        if (M > 1) columns = true;
+    }
+    const real *p = in.get() ? in->begin() : (data.empty() ? NULL : &data[0]);
+    const size_t N = (in.get() ? in->size() : data.size()) / M;
+    const double read_seconds = ar::arsel_timing::now() - read_begin;
+    vector<column_iterator> firsts, lasts;
+    for (size_t j = 0; j < M; ++j) {
+        firsts.push_back(column_iterator(p + j,       M));
+        lasts .push_back(column_iterator(p + j + N*M, M));
+    }
 
-    // Use burg_method to estimate a hierarchy of AR models from input data
-    real mu;
-    vector<real> params, sigma2e, gain, autocor;
-    params .reserve(maxorder*(maxorder + 1)/2);
-    sigma2e.reserve(maxorder + 1);
-    gain   .reserve(maxorder + 1);
-    autocor.reserve(maxorder + 1);
-    const size_t N = ar::burg_method(istream_iterator<real>(cin),
-                                     istream_iterator<real>(),
-                                     mu,
-                                     maxorder,
-                                     back_inserter(params),
-                                     back_inserter(sigma2e),
-                                     back_inserter(gain),
-                                     back_inserter(autocor),
-                                     subtract_mean,
-                                     /* output hierarchy? */ true);
-
-
-    // Keep only best model according to selected criterion
-    best_model(N, minorder, params, sigma2e, gain, autocor);
-
-    // Compute decorrelation time from the estimated autocorrelation model
-    const real T0 = ar::decorrelation_time(
-                static_cast<size_t>(window_T0*N),
-                ar::autocorrelation(params.begin(), params.end(),
-                                    gain[0], autocor.begin()),
-                absolute_rho);
-
-    // Compute effective variance and effective number of independent samples
-    const real eff_var  = (N*gain[0]*sigma2e[0]) / (N - T0); // Trenberth1984
-    const real eff_N    = N / T0;
-    const real mu_sigma = sqrt(eff_var / eff_N);
-
-    // Output details about the best model and derived information
+    // Use ar::arsel_batch to estimate and select best models for all signals
+    // Every signal records the time spent reading the input as a whole
+    vector<result_type> results(M);
+    for (size_t j = 0; j < M; ++j) {
+        results[j].timing.record(ar::arsel_read, read_seconds, N*M,
+                                 double(N*M) * sizeof(real));
+    }
+    if (!out_of_core.empty()) {
+        try {
+            fit_chunked(out_of_core.c_str(), orders_per_pass,
+                        firsts, lasts, results, criterion, subtract_mean,
+                        absolute_rho, minorder, maxorder, window_T0);
+        } catch (std::exception& e) {
+            cerr << "Unable to fit out of core: " << e.what() << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+    else if (!cache.empty()) {
+        try {
+            if      (kernel == "simd")     fit_cached(ar::burg_simd_kernel(),
+                                                      cache.c_str(),
+                                                      firsts, lasts, results,
+                                                      criterion, subtract_mean,
+                                                      absolute_rho, minorder,
+                                                      maxorder, window_T0);
+            else if (kernel == "fused")    fit_cached(ar::burg_fused_kernel(),
+                                                      cache.c_str(),
+                                                      firsts, lasts, results,
+                                                      criterion, subtract_mean,
+                                                      absolute_rho, minorder,
+                                                      maxorder, window_T0);
+            else if (kernel == "parallel") fit_cached(ar::burg_parallel_kernel(),
+                                                      cache.c_str(),
+                                                      firsts, lasts, results,
+                                                      criterion, subtract_mean,
+                                                      absolute_rho, minorder,
+                                                      maxorder, window_T0);
+            else                           fit_cached(ar::burg_scalar_kernel(),
+                                                      cache.c_str(),
+                                                      firsts, lasts, results,
+                                                      criterion, subtract_mean,
+                                                      absolute_rho, minorder,
+                                                      maxorder, window_T0);
+        } catch (std::exception& e) {
+            cerr << "Unable to fit using cache: " << e.what() << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+    else if (kernel == "simd")     fit(ar::burg_simd_kernel(),
+                                       firsts, lasts, results, criterion,
+                                       subtract_mean, absolute_rho,
+                                       minorder, maxorder, window_T0);
+    else if (kernel == "fused")    fit(ar::burg_fused_kernel(),
+                                       firsts, lasts, results, criterion,
+                                       subtract_mean, absolute_rho,
+                                       minorder, maxorder, window_T0);
+    else if (kernel == "parallel") fit(ar::burg_parallel_kernel(),
+                                       firsts, lasts, results, criterion,
+                                       subtract_mean, absolute_rho,
+                                       minorder, maxorder, window_T0);
+    else                           fit(ar::burg_scalar_kernel(),
+                                       firsts, lasts, results, criterion,
+                                       subtract_mean, absolute_rho,
+                                       minorder, maxorder, window_T0);
+
+    // Output details about each best model and derived information
     // Naming conventions here match the output of arsel-octfile by design
+    // Multiple columns produce blank line separated, numbered blocks
     cout.precision(numeric_limits<real>::digits10 + 2);
-    cout << boolalpha
-         <<   "# absrho    " << absolute_rho
-         << "\n# criterion " << criterion
-         << "\n# eff_N     " << eff_N
-         << "\n# eff_var   " << eff_var
-         << "\n# gain      " << gain[0]
-         << "\n# maxorder  " << maxorder
-         << "\n# minorder  " << minorder
-         << "\n# mu        " << mu
-         << "\n# mu_sigma  " << mu_sigma
-         << "\n# N         " << N
-         << "\n# AR(p)     " << params.size()
-         << "\n# sigma2eps " << sigma2e[0]
-         << "\n# sigma2x   " << gain[0]*sigma2e[0]
-         << "\n# submean   " << subtract_mean
-         << "\n# T0        " << T0
-         << "\n# window_T0 " << window_T0
-         << noboolalpha
-         << showpos                               // Line up signs
-         << '\n'             << real(1)           // Leading one coefficient
-         << '\n';
-    copy(params.begin(), params.end(), ostream_iterator<real>(cout,"\n"));
+    ar::spectrum_workspace<real> workspace;
+    for (size_t j = 0; j < M; ++j) {
+        const result_type& r = results[j];
+        if (columns) {
+            cout << (j ? "\n" : "") << "# column    " << j << '\n';
+        }
+        cout << boolalpha
+             <<   "# absrho    " << absolute_rho
+             << "\n# criterion " << criterion
+             << "\n# eff_N     " << r.eff_N
+             << "\n# eff_var   " << r.eff_var
+             << "\n# gain      " << r.gain
+             << "\n# maxorder  " << r.maxorder
+             << "\n# minorder  " << minorder
+             << "\n# mu        " << r.mu
+             << "\n# mu_sigma  " << r.mu_sigma
+             << "\n# N         " << r.N
+             << "\n# AR(p)     " << r.AR.size()
+             << "\n# sigma2eps " << r.sigma2eps
+             << "\n# sigma2x   " << r.sigma2x
+             << "\n# submean   " << subtract_mean
+             << "\n# T0        " << r.T0
+             << "\n# window_T0 " << window_T0;
+        for (int k = 0; timing && k < ar::arsel_phases; ++k) {
+            const ar::arsel_phase phase = static_cast<ar::arsel_phase>(k);
+            const string name = ar::arsel_timing::name(phase);
+            cout << "\n# timing_" << name << ' '
+                 << r.timing.seconds(phase)
+                 << "\n# timing_" << name << "_iterations "
+                 << r.timing.iterations(phase)
+                 << "\n# timing_" << name << "_bytes "
+                 << r.timing.bytes(phase);
+        }
+        cout << noboolalpha
+             << showpos                               // Line up signs
+             << '\n'             << real(1)           // Leading one coefficient
+             << '\n';
+        copy(r.AR.begin(), r.AR.end(), ostream_iterator<real>(cout,"\n"));
+        cout << noshowpos;
+
+        // Angular frequencies in radians per sample paired with densities
+        if (spectrum) {
+            vector<real> S(spectrum);
+            ar::spectrum_uniform(r.AR.begin(), r.AR.end(), r.sigma2eps,
+                                 spectrum, S.begin(), workspace);
+            cout << "# omega density\n";
+            const real pi = 4*atan(real(1));
+            for (size_t k = 0; k < spectrum; ++k) {
+                const real omega = spectrum > 1 ? pi*k/(spectrum - 1) : 0;
+                cout << omega << '\t' << S[k] << '\n';
+            }
+        }
+    }
     cout.flush();
 
     return EXIT_SUCCESS;
@@ -0,0 +1,478 @@
+// Copyright (C) 2013 Rhys Ulerich
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/** @file
+ * Benchmark \ref ar::burg_method against the reference implementations
+ * \ref faber1986 and \ref BurgAlgorithm as well as \ref
+ * ar::decorrelation_time.  Sample counts sweep decades and model orders
+ * sweep powers of four with \ref ar::burg_method run in float, double, and
+ * long double precision both with and without a hierarchy.  Reference
+ * implementations run in the working precision.
+ *
+ * Each measurement is one tab-separated record whose columns are named by a
+ * leading comment line.  Timings are the best of enough repetitions to span
+ * the requested minimum time.  Bandwidth is the nominal traffic of reading
+ * and writing the forward and backward prediction errors once per order.
+ * Synthetic data comes from a known AR(2) process so the maximum parameter
+ * error can be reported for every fit.  Coefficient and data file pairs
+ * named on the command line, for example \c test0.coeff and \c test0.dat,
+ * are additionally fit to the order of their known coefficients.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "ar.hpp"
+#include "collomb2009.hpp"
+#include "faber1986.hpp"
+#include "optionparser.h"
+#include "real.hpp"
+#include "samples.hpp"
+
+#define STRINGIFY_HELPER(x) #x
+#define STRINGIFY(x) STRINGIFY_HELPER(x)
+
+// Forward declarations for argument checking logic
+struct Arg : public option::Arg
+{
+    static option::ArgStatus NonNegative(const option::Option& opt, bool msg);
+};
+
+// Command line argument declarations for optionparser.h usage
+enum OptionIndex {
+    UNKNOWN, HELP, MAXORDER, MAXSAMPLES, MAXWORK, MINSAMPLES, MINTIME
+};
+const option::Descriptor usage[] = {
+    {UNKNOWN, 0, "", "",      option::Arg::None,
+     "Usage: bench [OPTION]... [COEFF DATA]...\n"
+     "Benchmark Burg implementations emitting tab-separated records ("
+         /* Working precision */ STRINGIFY(REAL) ").\n"
+     "\n"
+     "Options:" },
+    {0,0,"","",Arg::None,0}, // table break
+    {HELP,       0, "h", "help",        Arg::None,
+     "  -h \t--help   \tDisplay this help message and immediately exit" },
+    {MAXORDER,   0, "m", "max-order",   Arg::NonNegative,
+     "  -m \t--max-order=P  \tSweep model orders 1, 4, 16, ... through P (default 1024)" },
+    {MAXSAMPLES, 0, "N", "max-samples", Arg::NonNegative,
+     "  -N \t--max-samples=N  \tSweep sample counts by decades through N (default 1e6)" },
+    {MINSAMPLES, 0, "n", "min-samples", Arg::NonNegative,
+     "  -n \t--min-samples=N  \tSweep sample counts by decades from N (default 1e3)" },
+    {MAXWORK,    0, "w", "max-work",    Arg::NonNegative,
+     "  -w \t--max-work=W  \tSkip sweeps where samples times order exceeds W (default 1e8)" },
+    {MINTIME,    0, "t", "min-time",    Arg::NonNegative,
+     "  -t \t--min-time=T  \tRepeat each measurement for at least T seconds (default 0.1)" },
+    {0,0,0,0,0,0}
+};
+
+// Wall clock time in seconds
+static double now()
+{
+#ifdef _OPENMP
+    return omp_get_wtime();
+#else
+    return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+// Whitespace-free names for each precision
+template <typename Value> const char* precision();
+template <> const char* precision<float      >() { return "float";       }
+template <> const char* precision<double     >() { return "double";      }
+template <> const char* precision<long double>() { return "long_double"; }
+
+// Record characterizing one measurement
+struct record
+{
+    std::string method;
+    const char* type;
+    std::size_t N;
+    std::size_t p;
+    bool        hierarchy;
+    std::size_t reps;
+    double      seconds;
+    double      bytes;
+    double      error;
+};
+
+static void print_header()
+{
+    std::cout << "# method\treal\tN\tp\thierarchy\treps\tseconds"
+                 "\tns_per_sample_order\tGB_per_s\tmax_abs_error\n";
+}
+
+static void print(const record& r)
+{
+    const double NaN = std::numeric_limits<double>::quiet_NaN();
+    std::cout << r.method
+              << '\t' << r.type
+              << '\t' << r.N
+              << '\t' << r.p
+              << '\t' << r.hierarchy
+              << '\t' << r.reps
+              << '\t' << r.seconds
+              << '\t' << r.seconds * 1e9 / (double(r.N) * r.p)
+              << '\t' << (r.bytes > 0 ? r.bytes / r.seconds / 1e9 : NaN)
+              << '\t' << r.error
+              << std::endl;
+}
+
+// Best time of invoking job() repeatedly until min_time elapses
+template <class Job>
+static double best_time(Job& job, const double min_time, std::size_t& reps)
+{
+    double best = std::numeric_limits<double>::max(), total = 0;
+    reps = 0;
+    do {
+        const double t0 = now();
+        job();
+        const double dt = now() - t0;
+        best   = std::min(best, dt);
+        total += dt;
+        ++reps;
+    } while (total < min_time);
+    return best;
+}
+
+// Maximum absolute difference between last p estimates and exact values
+// Not-a-number indicates no exact values are known
+template <class Vector>
+static double max_error(const Vector& est, const std::vector<real>& exact)
+{
+    using std::abs;
+    if (exact.empty()) return std::numeric_limits<double>::quiet_NaN();
+    double err = 0;
+    const std::size_t p = exact.size(), off = est.size() - p;
+    for (std::size_t i = 0; i < p; ++i) {
+        err = std::max(err, double(abs(est[off + i] - exact[i])));
+    }
+    return err;
+}
+
+// Fit AR(p) via ar::burg_method reusing working storage across invocations
+template <typename Value>
+struct burg_job
+{
+    burg_job(const std::vector<Value>& x, std::size_t p, bool hierarchy)
+        : x(x), p(p), hierarchy(hierarchy),
+          params(hierarchy ? p*(p+1)/2 : p),
+          sigma2e(p+1), gain(p+1), autocor(p+1)
+    {}
+
+    void operator()()
+    {
+        std::size_t maxorder = p;
+        Value mean;
+        ar::burg_method(x.begin(), x.end(), mean, maxorder,
+                        params.begin(), sigma2e.begin(), gain.begin(),
+                        autocor.begin(), false, hierarchy, f, b, Ak, ac);
+    }
+
+    const std::vector<Value>& x;
+    std::size_t p;
+    bool hierarchy;
+    std::vector<Value> params, sigma2e, gain, autocor, f, b, Ak, ac;
+};
+
+// Compute decorrelation_time across N lags from an already fit model
+template <typename Value>
+struct decorrelation_job
+{
+    decorrelation_job(const burg_job<Value>& fit, std::size_t N)
+        : fit(fit), N(N), T0(0)
+    {}
+
+    void operator()()
+    {
+        T0 = ar::decorrelation_time(N, ar::autocorrelation(
+                    fit.params.begin(), fit.params.end(),
+                    fit.gain[0], fit.autocor.begin()), true);
+    }
+
+    const burg_job<Value>& fit;
+    std::size_t N;
+    Value T0;
+};
+
+// Forecast many channels sharing an already fit model as on every tick
+template <typename Value>
+struct forecast_job
+{
+    forecast_job(const burg_job<Value>& fit, std::size_t M, std::size_t H)
+        : H(H), bf(M, fit.p), forecasts(M*H), variances(M*H)
+    {
+        for (std::size_t i = 0; i < M; ++i) {
+            bf.model(i, fit.params.begin(), fit.params.end(), 0, 1);
+        }
+        for (std::size_t n = fit.x.size() - fit.p; n < fit.x.size(); ++n) {
+            bf.observe(std::vector<Value>(M, fit.x[n]).begin());
+        }
+    }
+
+    void operator()() { bf.forecast(H, &forecasts[0], &variances[0]); }
+
+    std::size_t H;
+    ar::batch_forecaster<Value> bf;
+    std::vector<Value> forecasts, variances;
+};
+
+// Fit AR(p) using faber1986 from a private, mutable copy of the data
+struct faber1986_job
+{
+    faber1986_job(const std::vector<real>& x, std::size_t p)
+        : x(x), p(p), k(p+1), a(p+1), err(p+1)
+    {}
+
+    void operator()()
+    {
+        faber1986(&x[0], x.size(), &k[0], &a[0], &err[0], p);
+    }
+
+    std::vector<real> x;
+    int p;
+    std::vector<real> k, a, err;
+};
+
+// Fit AR(p) using Collomb's BurgAlgorithm
+struct collomb2009_job
+{
+    collomb2009_job(const std::vector<real>& x, std::size_t p)
+        : x(x), coeffs(p)
+    {}
+
+    void operator()() { BurgAlgorithm(coeffs, x); }
+
+    const std::vector<real>& x;
+    std::vector<real> coeffs;
+};
+
+// Benchmark ar::burg_method and ar::decorrelation_time in precision Value
+template <typename Value>
+static void bench_burg(const std::vector<real>& data,
+                       const std::size_t        p,
+                       const std::vector<real>& exact,
+                       const double             min_time,
+                       const bool               sweep)
+{
+    const std::vector<Value> x(data.begin(), data.end());
+    const std::size_t N = x.size();
+    for (int h = 0; h < 2; ++h) {
+        record r;
+        burg_job<Value> job(x, p, h);
+        r.method    = "burg_method";
+        r.type      = precision<Value>();
+        r.N         = N;
+        r.p         = p;
+        r.hierarchy = h;
+        r.seconds   = best_time(job, min_time, r.reps);
+        r.bytes     = 4.0 * N * p * sizeof(Value);
+        r.error     = max_error(job.params, exact);
+        print(r);
+
+        // Decorrelation time depends only upon the final model
+        if (h || !sweep) continue;
+        decorrelation_job<Value> dt(job, N);
+        r.method    = "decorrelation_time";
+        r.seconds   = best_time(dt, min_time, r.reps);
+        r.bytes     = 0;
+        r.error     = std::numeric_limits<double>::quiet_NaN();
+        print(r);
+
+        // Forecasting reports samples as channels times horizons
+        const std::size_t M = 10000, H = 16;
+        forecast_job<Value> fj(job, M, H);
+        r.method    = "forecast_batch";
+        r.N         = M * H;
+        r.seconds   = best_time(fj, min_time, r.reps);
+        r.bytes     = 2.0 * M * (p + H) * sizeof(Value);
+        print(r);
+    }
+}
+
+// Benchmark the reference implementations in the working precision
+static void bench_reference(const std::vector<real>& data,
+                            const std::size_t        p,
+                            const std::vector<real>& exact,
+                            const double             min_time)
+{
+    const std::size_t N = data.size();
+    record r;
+    r.type      = precision<real>();
+    r.N         = N;
+    r.p         = p;
+    r.hierarchy = false;
+    r.bytes     = 4.0 * N * p * sizeof(real);
+
+    if (N <= MAXSIZE && p <= MAXORD) {
+        faber1986_job job(data, p);
+        r.method  = "faber1986";
+        r.seconds = best_time(job, min_time, r.reps);
+        r.error   = max_error(std::vector<real>(job.a.begin() + 1,
+                                                job.a.end()), exact);
+        print(r);
+    }
+
+    collomb2009_job job(data, p);
+    r.method  = "collomb2009";
+    r.seconds = best_time(job, min_time, r.reps);
+    r.error   = max_error(job.coeffs, exact);
+    print(r);
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace std;
+
+    // Parse and process any command line arguments using optionparser.h
+    size_t maxorder = 1024;
+    size_t maxN     = 1000000;
+    size_t minN     = 1000;
+    double maxwork  = 1e8;
+    double min_time = 0.1;
+    vector<string> files;
+    {
+        option::Stats stats(usage, argc-(argc>0), argv+(argc>0));
+
+        vector<option::Option> options(stats.options_max + stats.buffer_max);
+
+        option::Parser parse(usage, argc-(argc>0), argv+(argc>0),
+                             &options[0], &options[stats.options_max]);
+
+        if (parse.error() || options[UNKNOWN]) {
+            for (option::Option* o = options[UNKNOWN]; o; o = o->next()) {
+                cerr << "Unknown option: " << o->name << "\n";
+            }
+            return EXIT_FAILURE;
+        }
+
+        if (options[HELP]) {
+            printUsage(cout, usage);
+            return EXIT_SUCCESS;
+        }
+
+        if (options[MAXORDER])
+            maxorder = (size_t) strtod(options[MAXORDER].last()->arg, NULL);
+
+        if (options[MAXSAMPLES])
+            maxN = (size_t) strtod(options[MAXSAMPLES].last()->arg, NULL);
+
+        if (options[MINSAMPLES])
+            minN = (size_t) strtod(options[MINSAMPLES].last()->arg, NULL);
+
+        if (options[MAXWORK])
+            maxwork = strtod(options[MAXWORK].last()->arg, NULL);
+
+        if (options[MINTIME])
+            min_time = strtod(options[MINTIME].last()->arg, NULL);
+
+        if (parse.nonOptionsCount() % 2) {
+            cerr << "Expected COEFF and DATA filename pairs\n";
+            return EXIT_FAILURE;
+        }
+        for (int i = 0; i < parse.nonOptionsCount(); ++i) {
+            files.push_back(parse.nonOption(i));
+        }
+    }
+
+    cout.precision(6);
+    cout << "# real      " << STRINGIFY(REAL)
+         << "\n# max_work  " << maxwork
+         << "\n# min_time  " << min_time
+         << '\n';
+    print_header();
+
+    // Fit known coefficients from each file pair at their exact order
+    for (size_t i = 0; i < files.size(); i += 2) {
+        vector<real> exact, data;
+        try {
+            ifstream f;
+            f.exceptions(ifstream::badbit);
+            f.open(files[i].c_str());
+            copy(istream_iterator<real>(f), istream_iterator<real>(),
+                 back_inserter(exact));
+            samples::source<real> in(samples::TEXT, files[i+1].c_str());
+            data.assign(in.begin(), in.end());
+        } catch (std::exception& e) {
+            cerr << "Unable to read " << files[i] << " and " << files[i+1]
+                 << ": " << e.what() << "\n";
+            return EXIT_FAILURE;
+        }
+        if (exact.empty() || data.size() <= exact.size()) {
+            cerr << "Too few samples in " << files[i+1] << "\n";
+            return EXIT_FAILURE;
+        }
+        const size_t p = exact.size();
+        bench_burg<float      >(data, p, exact, min_time, false);
+        bench_burg<double     >(data, p, exact, min_time, false);
+        bench_burg<long double>(data, p, exact, min_time, false);
+        bench_reference(data, p, exact, min_time);
+    }
+
+    // Synthesize the largest sample from a known, stationary AR(2) process
+    vector<real> exact(2), data;
+    exact[0] = -0.75;
+    exact[1] =  0.5;
+    if (minN > 0 && minN <= maxN) {
+        ar::counter_normal<double> w(/* seed */ 1234);
+        data.resize(maxN);
+        double x1 = 0, x2 = 0;
+        for (size_t n = 0; n < maxN; ++n) {
+            const double x = w() - exact[0]*x1 - exact[1]*x2;
+            data[n] = x;
+            x2 = x1;
+            x1 = x;
+        }
+    }
+
+    // Sweep prefixes of the synthetic data across sample counts and orders
+    for (size_t N = minN; N > 0 && N <= maxN; N *= 10) {
+        const vector<real> x(data.begin(), data.begin() + N);
+        for (size_t p = 1; p <= maxorder && p < N; p *= 4) {
+            if (double(N) * p > maxwork) break;
+            vector<real> e;
+            if (p >= exact.size()) {
+                e = exact;
+                e.resize(p, 0);
+            }
+            bench_burg<float      >(x, p, e, min_time, true);
+            bench_burg<double     >(x, p, e, min_time, true);
+            bench_burg<long double>(x, p, e, min_time, true);
+            bench_reference(x, p, e, min_time);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// Argument checking logic based upon optionparser.h example routines
+option::ArgStatus Arg::NonNegative(const option::Option& opt, bool msg)
+{
+    char *p = 0;
+    if (opt.arg) {
+        double v = strtod(opt.arg, &p);
+        if (p != opt.arg && !*p && v >= 0) {
+            return option::ARG_OK;
+        }
+    }
+
+    if (msg) {
+        (std::cerr << "Option ").write(opt.name, opt.namelen)
+                    << " requires a nonnegative numeric argument\n";
+    }
+    return option::ARG_ILLEGAL;
+}
@@ -4,7 +4,9 @@
 #include <limits>
 #include <vector>
 
+#include "collomb2009.hpp"
 #include "real.hpp"
+#include "samples.hpp"
 
 using namespace std;
 
@@ -15,69 +17,6 @@ using namespace std;
  * November 2009 available at http://www.emptyloop.com/technotes/.
  */
 
-/**
- * Returns in vector coefficients calculated using Burg algorithm applied to
- * the input source data x
- */
-static void BurgAlgorithm( vector<real>& coeffs, const vector<real>& x )
-{
-    // GET SIZE FROM INPUT VECTORS
-    size_t N = x.size() - 1;
-    size_t m = coeffs.size();
-
-    // INITIALIZE Ak
-    vector<real> Ak( m + 1, 0.0 );
-    Ak[ 0 ] = 1.0;
-
-    // INITIALIZE f and b
-    vector<real> f( x );
-    vector<real> b( x );
-
-    // INITIALIZE Dk
-    real Dk = 0.0;
-    for ( size_t j = 0; j <= N; j++ )
-    {
-        Dk += 2.0 * f[ j ] * f[ j ];
-    }
-    Dk -= f[ 0 ] * f[ 0 ] + b[ N ] * b[ N ];
-
-    // BURG RECURSION
-    for ( size_t k = 0; k < m; k++ )
-    {
-        // COMPUTE MU
-        real mu = 0.0;
-        for ( size_t n = 0; n <= N - k - 1; n++ )
-        {
-            mu += f[ n + k + 1 ] * b[ n ];
-        }
-        mu *= -2.0 / Dk;
-
-        // UPDATE Ak
-        for ( size_t n = 0; n <= ( k + 1 ) / 2; n++ )
-        {
-            real t1 = Ak[ n ] + mu * Ak[ k + 1 - n ];
-            real t2 = Ak[ k + 1 - n ] + mu * Ak[ n ];
-            Ak[ n ] = t1;
-            Ak[ k + 1 - n ] = t2;
-        }
-
-        // UPDATE f and b
-        for ( size_t n = 0; n <= N - k - 1; n++ )
-        {
-            real t1 = f[ n + k + 1 ] + mu * b[ n ];
-            real t2 = b[ n ] + mu * f[ n + k + 1 ];
-            f[ n + k + 1 ] = t1;
-            b[ n ] = t2;
-        }
-
-        // UPDATE Dk
-        Dk = ( 1.0 - mu * mu ) * Dk - f[ k + 1 ] * f[ k + 1 ] - b[ N - k - 1 ] * b[ N - k - 1 ];
-    }
-
-    // ASSIGN COEFFICIENTS
-    coeffs.assign( ++Ak.begin(), Ak.end() );
-}
-
 /** Fit data from standard input using \ref BurgAlgorithm. */
 int main( int argc, char* argv[] )
 {
@@ -88,9 +27,17 @@ int main( int argc, char* argv[] )
     }
     order = atoi(argv[1]);
 
-    // Load data from cin
+    // Load data from cin in the optionally specified format
+    samples::format format = samples::TEXT;
+    if (argc > 2 && !samples::parse_format(argv[2], format)) {
+        cerr << "Unknown format: " << argv[2] << endl;
+        return 1;
+    }
     vector<real> data;
-    copy(istream_iterator<real>(cin), istream_iterator<real>(), back_inserter(data));
+    {
+        samples::source<real> in(format);
+        data.assign(in.begin(), in.end());
+    }
 
     // Compute AR model of given order
     vector<real> coeffs( order );
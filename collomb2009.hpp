@@ -0,0 +1,85 @@
+// Copyright (C) 2012, 2013 Rhys Ulerich
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef COLLOMB2009_HPP
+#define COLLOMB2009_HPP
+
+/** @file
+ * Cedrick Collomb's Burg algorithm variant.
+ *
+ * Taken from Cedrick Collomb. "Burg's method, algorithm, and recursion",
+ * November 2009 available at http://www.emptyloop.com/technotes/.
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include "real.hpp"
+
+/**
+ * Returns in vector coefficients calculated using Burg algorithm applied to
+ * the input source data x
+ */
+inline void BurgAlgorithm( std::vector<real>& coeffs, const std::vector<real>& x )
+{
+    // GET SIZE FROM INPUT VECTORS
+    std::size_t N = x.size() - 1;
+    std::size_t m = coeffs.size();
+
+    // INITIALIZE Ak
+    std::vector<real> Ak( m + 1, 0.0 );
+    Ak[ 0 ] = 1.0;
+
+    // INITIALIZE f and b
+    std::vector<real> f( x );
+    std::vector<real> b( x );
+
+    // INITIALIZE Dk
+    real Dk = 0.0;
+    for ( std::size_t j = 0; j <= N; j++ )
+    {
+        Dk += 2.0 * f[ j ] * f[ j ];
+    }
+    Dk -= f[ 0 ] * f[ 0 ] + b[ N ] * b[ N ];
+
+    // BURG RECURSION
+    for ( std::size_t k = 0; k < m; k++ )
+    {
+        // COMPUTE MU
+        real mu = 0.0;
+        for ( std::size_t n = 0; n <= N - k - 1; n++ )
+        {
+            mu += f[ n + k + 1 ] * b[ n ];
+        }
+        mu *= -2.0 / Dk;
+
+        // UPDATE Ak
+        for ( std::size_t n = 0; n <= ( k + 1 ) / 2; n++ )
+        {
+            real t1 = Ak[ n ] + mu * Ak[ k + 1 - n ];
+            real t2 = Ak[ k + 1 - n ] + mu * Ak[ n ];
+            Ak[ n ] = t1;
+            Ak[ k + 1 - n ] = t2;
+        }
+
+        // UPDATE f and b
+        for ( std::size_t n = 0; n <= N - k - 1; n++ )
+        {
+            real t1 = f[ n + k + 1 ] + mu * b[ n ];
+            real t2 = b[ n ] + mu * f[ n + k + 1 ];
+            f[ n + k + 1 ] = t1;
+            b[ n ] = t2;
+        }
+
+        // UPDATE Dk
+        Dk = ( 1.0 - mu * mu ) * Dk - f[ k + 1 ] * f[ k + 1 ] - b[ N - k - 1 ] * b[ N - k - 1 ];
+    }
+
+    // ASSIGN COEFFICIENTS
+    coeffs.assign( ++Ak.begin(), Ak.end() );
+}
+
+#endif /* COLLOMB2009_HPP */
@@ -0,0 +1,901 @@
+// Copyright (C) 2013 Rhys Ulerich
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SAMPLES_HPP
+#define SAMPLES_HPP
+
+/** @file
+ * Reads samples for utility programs from text, raw little-endian binary, or
+ * NumPy <tt>.npy</tt> files.  Regular files are memory-mapped when possible
+ * and binary samples matching the working precision are used in place.
+ * Also provides temporary file storage for out-of-core computations and an
+ * on-disk cache of model hierarchies keyed by a digest of the data.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cfloat>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__unix) || defined(__APPLE__)
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+# define SAMPLES_POSIX 1
+#endif
+
+/** Reading samples from standard input or files in several formats. */
+namespace samples {
+
+/** Supported input formats. */
+enum format {
+    TEXT, /**< Whitespace-separated decimal text        */
+    U8,   /**< Raw unsigned bytes                       */
+    F32,  /**< Raw little-endian IEEE single precision  */
+    F64,  /**< Raw little-endian IEEE double precision  */
+    NPY   /**< NumPy .npy holding one or two dimensions */
+};
+
+/**
+ * Look up a \ref format by its name, one of "text", "u8", "f32", "f64", or
+ * "npy".  Returns false whenever \c name is unknown.
+ */
+inline bool parse_format(const std::string& name, format& f)
+{
+    if      (name == "text") f = TEXT;
+    else if (name == "u8"  ) f = U8;
+    else if (name == "f32" ) f = F32;
+    else if (name == "f64" ) f = F64;
+    else if (name == "npy" ) f = NPY;
+    else return false;
+    return true;
+}
+
+/**
+ * The bytes readable from a file descriptor.  Regular files are mapped into
+ * memory while pipes and terminals are read fully into a buffer.  A trailing
+ * NUL not counted by \ref size() is guaranteed whenever \c terminate is true
+ * so that text may be parsed using <tt>strtod</tt>.
+ */
+class bytes
+{
+public:
+
+    /** Read the already open file descriptor \c fd. */
+    bytes(const int fd, const bool terminate)
+        : map(0), len(0), buf()
+    {
+#ifdef SAMPLES_POSIX
+        load(fd, terminate);
+#else
+        (void) fd;
+        load(stdin, terminate);
+#endif
+    }
+
+    /** Read the file named by \c path. */
+    bytes(const char *path, const bool terminate)
+        : map(0), len(0), buf()
+    {
+        const std::string what = std::string("Unable to open ") + path;
+#ifdef SAMPLES_POSIX
+        const int fd = ::open(path, O_RDONLY);
+        if (fd < 0) throw std::runtime_error(what);
+        try {
+            load(fd, terminate);
+        } catch (...) {
+            ::close(fd);
+            throw;
+        }
+        ::close(fd);  // Any mapping remains valid
+#else
+        FILE *f = std::fopen(path, "rb");
+        if (!f) throw std::runtime_error(what);
+        load(f, terminate);
+        std::fclose(f);
+#endif
+    }
+
+    ~bytes()
+    {
+#ifdef SAMPLES_POSIX
+        if (map) munmap(map, len);
+#endif
+    }
+
+    /** Beginning of the bytes. */
+    const char* data() const
+    {
+        return map ? static_cast<const char*>(map)
+                   : (buf.empty() ? "" : &buf[0]);
+    }
+
+    /** Number of bytes. */
+    std::size_t size() const
+    {
+        return len;
+    }
+
+private:
+
+#ifdef SAMPLES_POSIX
+    void load(const int fd, const bool terminate)
+    {
+        struct stat st;
+        if (!terminate && fstat(fd, &st) == 0 && S_ISREG(st.st_mode)
+                && st.st_size > 0 && lseek(fd, 0, SEEK_CUR) == 0) {
+            void *p = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                map = p;
+                len = st.st_size;
+                return;
+            }
+        }
+        char chunk[65536];
+        for (;;) {
+            const ssize_t n = ::read(fd, chunk, sizeof(chunk));
+            if (n > 0) {
+                buf.insert(buf.end(), chunk, chunk + n);
+            } else if (n == 0) {
+                break;
+            } else if (errno != EINTR) {
+                throw std::runtime_error(std::strerror(errno));
+            }
+        }
+        len = buf.size();
+        if (terminate) buf.push_back('\0');
+    }
+#else
+    void load(FILE *f, const bool terminate)
+    {
+        char chunk[65536];
+        std::size_t n;
+        while ((n = std::fread(chunk, 1, sizeof(chunk), f)) > 0) {
+            buf.insert(buf.end(), chunk, chunk + n);
+        }
+        len = buf.size();
+        if (terminate) buf.push_back('\0');
+    }
+#endif
+
+    bytes(const bytes&);            // Noncopyable
+    bytes& operator=(const bytes&); // Noncopyable
+
+    void*             map;
+    std::size_t       len;
+    std::vector<char> buf;
+};
+
+/**
+ * Parse one decimal floating point value at \c p, advancing \c p past it,
+ * in the manner of <tt>std::from_chars</tt>.  Leading whitespace is skipped.
+ * Values having at most 19 significant digits whose exact decimal mantissa
+ * and power of ten are representable are computed with a single correctly
+ * rounded operation per Clinger 1990.  All other input, including infinities
+ * and NaNs, is deferred to <tt>strtod</tt>, <tt>strtof</tt>, or <tt>strtold</tt>
+ * so that results always match the C library.  The input must be NUL-terminated.
+ *
+ * @return False if no value could be parsed.
+ */
+template <class Real>
+bool parse(const char*& p, Real& x);
+
+namespace detail {
+
+template <class Real> struct fast_path;
+
+template <> struct fast_path<double>
+{
+    static double strto(const char *s, char **e) { return std::strtod(s, e); }
+    static const unsigned long long max_mantissa = 1ULL << 53;
+    enum { max_exponent = 22 };
+};
+
+template <> struct fast_path<float>
+{
+    static float strto(const char *s, char **e) { return strtof(s, e); }
+    static const unsigned long long max_mantissa = 1ULL << 24;
+    enum { max_exponent = 10 };
+};
+
+// Limits for double are exact in every long double format
+template <> struct fast_path<long double>
+{
+    static long double strto(const char *s, char **e) { return strtold(s, e); }
+    static const unsigned long long max_mantissa = 1ULL << 53;
+    enum { max_exponent = 22 };
+};
+
+inline bool is_space(const char c)
+{
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r'
+        || c == '\v' || c == '\f';
+}
+
+inline bool is_digit(const char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+}
+
+template <class Real>
+bool parse(const char*& p, Real& x)
+{
+    using detail::is_digit;
+    typedef detail::fast_path<Real> traits;
+
+    while (detail::is_space(*p)) ++p;
+
+    // Clinger's fast path requires intermediate results in working precision
+#if    (defined(FLT_EVAL_METHOD)     && FLT_EVAL_METHOD     == 0) \
+    || (defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ == 0)
+    const char *s = p;
+    bool negative = false;
+    if (*s == '-' || *s == '+') negative = (*s++ == '-');
+
+    unsigned long long m = 0;
+    int digits = 0, scale = 0;
+    bool any = false;
+    while (*s == '0') { ++s; any = true; }
+    for (; is_digit(*s); ++s, any = true) {
+        if (++digits <= 19) m = 10*m + (*s - '0'); else ++scale;
+    }
+    if (*s == '.') {
+        ++s;
+        if (!digits) for (; *s == '0'; ++s, any = true) --scale;
+        for (; is_digit(*s); ++s, any = true) {
+            if (++digits <= 19) { m = 10*m + (*s - '0'); --scale; }
+        }
+    }
+    if (any && (*s == 'e' || *s == 'E')) {
+        const char *t = s + 1;
+        bool eneg = false;
+        if (*t == '-' || *t == '+') eneg = (*t++ == '-');
+        if (is_digit(*t)) {
+            int e = 0;
+            for (; is_digit(*t); ++t) if (e < 100000) e = 10*e + (*t - '0');
+            scale += eneg ? -e : e;
+            s = t;
+        }
+    }
+    if (any && digits <= 19 && m <= traits::max_mantissa
+            && *s != 'x' && *s != 'X'
+            && scale >= -traits::max_exponent
+            && scale <= +traits::max_exponent) {
+        static const Real pow10[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,
+            1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+            1e20, 1e21, 1e22
+        };
+        Real v = static_cast<Real>(m);
+        v = scale < 0 ? v / pow10[-scale] : v * pow10[scale];
+        x = negative ? -v : v;
+        p = s;
+        return true;
+    }
+#endif
+
+    // Otherwise defer to the C library
+    char *e;
+    x = traits::strto(p, &e);
+    if (e == p) return false;
+    p = e;
+    return true;
+}
+
+/**
+ * Samples from standard input or a file in some \ref format presented as a
+ * contiguous range of <tt>Real</tt>.  Raw binary or NumPy samples stored in
+ * precision \c Real are used directly from the memory mapping whenever the
+ * host is little-endian.  All other input is converted.  Text parsing stops,
+ * like <tt>std::istream_iterator</tt>, at the first token that is not a
+ * number.  A NumPy file holding a C-ordered two dimensional array reports
+ * its second dimension as \ref columns() so that each column may be treated
+ * as a separate signal.
+ *
+ * @throws std::runtime_error on I/O errors or malformed binary input.
+ */
+template <class Real>
+class source
+{
+public:
+
+    /** Read standard input. */
+    explicit source(const format f)
+        : in(0, f == TEXT), storage(), first(0), last(0), cols(1)
+    {
+        load(f);
+    }
+
+    /** Read the file named by \c path. */
+    source(const format f, const char *path)
+        : in(path, f == TEXT), storage(), first(0), last(0), cols(1)
+    {
+        load(f);
+    }
+
+    /** Beginning of the samples. */
+    const Real* begin() const { return first; }
+
+    /** Exclusive end of the samples. */
+    const Real* end() const { return last; }
+
+    /** Number of samples. */
+    std::size_t size() const { return last - first; }
+
+    /** Number of interleaved columns, which is one except for NumPy. */
+    std::size_t columns() const { return cols; }
+
+private:
+
+    bytes             in;
+    std::vector<Real> storage;
+    const Real*       first;
+    const Real*       last;
+    std::size_t       cols;
+
+    static bool little_endian()
+    {
+        const unsigned short one = 1;
+        return *reinterpret_cast<const unsigned char*>(&one) == 1;
+    }
+
+    void finish()
+    {
+        first = storage.empty() ? 0 : &storage[0];
+        last  = first + storage.size();
+    }
+
+    template <class Stored>
+    void adopt(const char *p, const std::size_t n)
+    {
+        // Use the mapping in place whenever possible...
+        if (   sizeof(Stored) == sizeof(Real) && little_endian()
+            && std::numeric_limits<Stored>::digits
+                    == std::numeric_limits<Real>::digits
+            && reinterpret_cast<std::size_t>(p) % sizeof(Real) == 0) {
+            first = reinterpret_cast<const Real*>(p);
+            last  = first + n;
+            return;
+        }
+
+        // ...otherwise copy, correcting byte order as required
+        storage.resize(n);
+        for (std::size_t i = 0; i < n; ++i, p += sizeof(Stored)) {
+            unsigned char b[sizeof(Stored)];
+            std::memcpy(b, p, sizeof(Stored));
+            if (!little_endian()) {
+                for (std::size_t j = 0; j < sizeof(Stored)/2; ++j) {
+                    std::swap(b[j], b[sizeof(Stored) - 1 - j]);
+                }
+            }
+            Stored v;
+            std::memcpy(&v, b, sizeof(Stored));
+            storage[i] = static_cast<Real>(v);
+        }
+        finish();
+    }
+
+    void load(const format f)
+    {
+        const char *p = in.data();
+        const std::size_t n = in.size();
+        switch (f) {
+        case TEXT:
+            for (Real x; parse(p, x);) storage.push_back(x);
+            finish();
+            break;
+        case U8:
+            storage.assign(reinterpret_cast<const unsigned char*>(p),
+                           reinterpret_cast<const unsigned char*>(p) + n);
+            finish();
+            break;
+        case F32:
+            if (n % 4) throw std::runtime_error("Input not a multiple of 4 bytes");
+            adopt<float>(p, n / 4);
+            break;
+        case F64:
+            if (n % 8) throw std::runtime_error("Input not a multiple of 8 bytes");
+            adopt<double>(p, n / 8);
+            break;
+        case NPY:
+            load_npy(p, n);
+            break;
+        }
+    }
+
+    // Per https://numpy.org/doc/stable/reference/generated/numpy.lib.format.html
+    void load_npy(const char *p, const std::size_t n)
+    {
+        using std::string;
+
+        if (n < 10 || std::memcmp(p, "\x93NUMPY", 6) != 0) {
+            throw std::runtime_error("Input is not a NumPy .npy file");
+        }
+        const unsigned char *u = reinterpret_cast<const unsigned char*>(p);
+        std::size_t hlen, offset;
+        if (u[6] == 1) {
+            hlen   = u[8] | (u[9] << 8);
+            offset = 10;
+        } else if (n >= 12) {
+            hlen   = u[8] | (u[9] << 8) | (u[10] << 16)
+                   | (static_cast<std::size_t>(u[11]) << 24);
+            offset = 12;
+        } else {
+            throw std::runtime_error("Truncated NumPy header");
+        }
+        if (offset + hlen > n) {
+            throw std::runtime_error("Truncated NumPy header");
+        }
+        const string h(p + offset, hlen);
+        offset += hlen;
+
+        // Parse dictionary entries 'descr', 'fortran_order', and 'shape'
+        // rejecting any header whose punctuation is missing
+        const string::size_type npos = string::npos;
+        string::size_type i = h.find("'descr'"), j = npos;
+        if (i == npos) throw std::runtime_error("NumPy header lacks descr");
+        if ((i = h.find(':', i)) != npos && (i = h.find('\'', i)) != npos) {
+            j = h.find('\'', i + 1);
+        }
+        if (j == npos) throw std::runtime_error("Malformed NumPy descr");
+        const string descr = h.substr(i + 1, j - i - 1);
+        i = h.find("'fortran_order'");
+        if (i == npos || h.find("True", i) < h.find(',', i)) {
+            throw std::runtime_error("NumPy input must be C-ordered");
+        }
+        i = h.find("'shape'");
+        if (i == npos) throw std::runtime_error("NumPy header lacks shape");
+        const string::size_type open = h.find('(', i), close = h.find(')', i);
+        if (open == npos || close == npos || close < open) {
+            throw std::runtime_error("Malformed NumPy shape");
+        }
+        std::vector<std::size_t> shape;
+        for (const char *s = h.c_str() + open + 1,
+                        *t = h.c_str() + close; s < t;) {
+            char *e;
+            const unsigned long d = std::strtoul(s, &e, 10);
+            if (e == s) { ++s; continue; }
+            shape.push_back(d);
+            s = e;
+        }
+        if (shape.size() > 2) {
+            throw std::runtime_error("NumPy input must have at most two dimensions");
+        }
+        cols = shape.size() == 2 ? shape[1] : 1;
+        if (cols == 0) {
+            throw std::runtime_error("NumPy input must have at least one column");
+        }
+
+        const std::size_t width = descr == "<f8" ? 8
+                                : descr == "<f4" ? 4
+                                : descr == "|u1" ? 1 : 0;
+        if (!width) {
+            throw std::runtime_error("NumPy dtype must be <f8, <f4, or |u1");
+        }
+
+        // Guard the element count and byte length against overflow
+        const std::size_t most = std::numeric_limits<std::size_t>::max();
+        std::size_t count = 1;
+        for (std::size_t k = 0; k < shape.size(); ++k) {
+            if (shape[k] && count > most / shape[k]) {
+                throw std::runtime_error("NumPy shape is too large");
+            }
+            count *= shape[k];
+        }
+        if (count > (n - offset) / width) {
+            throw std::runtime_error("Truncated NumPy data");
+        }
+        p += offset;
+        if (width == 8) {
+            adopt<double>(p, count);
+        } else if (width == 4) {
+            adopt<float>(p, count);
+        } else {
+            storage.assign(reinterpret_cast<const unsigned char*>(p),
+                           reinterpret_cast<const unsigned char*>(p) + count);
+            finish();
+        }
+    }
+};
+
+/**
+ * Temporary file storage for values of type \c Real suitable as the \c Store
+ * of \ref ar::burg_method_chunked.  The file is created in \c dir, when
+ * given, or otherwise in \c TMPDIR or <tt>/tmp</tt> and is removed at once
+ * so that nothing remains should the program exit abnormally.  Values are
+ * kept in native byte order.  On POSIX hosts reads and writes use
+ * <tt>pread</tt> and <tt>pwrite</tt> and so may proceed concurrently.
+ *
+ * @throws std::runtime_error on I/O errors.
+ */
+template <class Real>
+class scratch
+{
+public:
+
+    /** Create an empty temporary file within \c dir. */
+    explicit scratch(const char *dir = 0)
+#ifdef SAMPLES_POSIX
+        : fd(-1)
+#else
+        : f(0)
+#endif
+    {
+#ifdef SAMPLES_POSIX
+        if (!dir || !*dir) dir = std::getenv("TMPDIR");
+        if (!dir || !*dir) dir = "/tmp";
+        std::string path = std::string(dir) + "/ar-scratch-XXXXXX";
+        std::vector<char> name(path.begin(), path.end());
+        name.push_back('\0');
+        fd = mkstemp(&name[0]);
+        if (fd < 0) {
+            throw std::runtime_error(std::string("Unable to create scratch in ")
+                                     + dir + ": " + std::strerror(errno));
+        }
+        ::unlink(&name[0]);
+#else
+        (void) dir;
+        f = std::tmpfile();
+        if (!f) throw std::runtime_error("Unable to create scratch file");
+#endif
+    }
+
+    ~scratch()
+    {
+#ifdef SAMPLES_POSIX
+        ::close(fd);
+#else
+        std::fclose(f);
+#endif
+    }
+
+    /** Copy \c count values beginning at offset \c first into \c out. */
+    void read(const std::size_t first, const std::size_t count, Real *out)
+    {
+        char *p = reinterpret_cast<char*>(out);
+        std::size_t n = count * sizeof(Real);
+#ifdef SAMPLES_POSIX
+        off_t at = static_cast<off_t>(first) * sizeof(Real);
+        while (n) {
+            const ssize_t r = ::pread(fd, p, n, at);
+            if (r > 0) {
+                p += r; n -= r; at += r;
+            } else if (r == 0) {
+                throw std::runtime_error("Unexpected end of scratch file");
+            } else if (errno != EINTR) {
+                throw std::runtime_error(std::strerror(errno));
+            }
+        }
+#else
+        bool ok;
+#ifdef _OPENMP
+#pragma omp critical(samples_scratch)
+#endif
+        ok = std::fseek(f, static_cast<long>(first * sizeof(Real)), SEEK_SET) == 0
+          && std::fread(p, 1, n, f) == n;
+        if (!ok) throw std::runtime_error("Unable to read scratch file");
+#endif
+    }
+
+    /** Copy \c count values from \c in to offsets beginning at \c first. */
+    void write(const std::size_t first, const std::size_t count, const Real *in)
+    {
+        const char *p = reinterpret_cast<const char*>(in);
+        std::size_t n = count * sizeof(Real);
+#ifdef SAMPLES_POSIX
+        off_t at = static_cast<off_t>(first) * sizeof(Real);
+        while (n) {
+            const ssize_t w = ::pwrite(fd, p, n, at);
+            if (w >= 0) {
+                p += w; n -= w; at += w;
+            } else if (errno != EINTR) {
+                throw std::runtime_error(std::strerror(errno));
+            }
+        }
+#else
+        bool ok;
+#ifdef _OPENMP
+#pragma omp critical(samples_scratch)
+#endif
+        ok = std::fseek(f, static_cast<long>(first * sizeof(Real)), SEEK_SET) == 0
+          && std::fwrite(p, 1, n, f) == n;
+        if (!ok) throw std::runtime_error("Unable to write scratch file");
+#endif
+    }
+
+private:
+
+    scratch(const scratch&);            // Noncopyable
+    scratch& operator=(const scratch&); // Noncopyable
+
+#ifdef SAMPLES_POSIX
+    int   fd;
+#else
+    FILE *f;
+#endif
+};
+
+/**
+ * A fast, non-cryptographic 64-bit digest of a sequence of samples suitable
+ * for keying a \ref cache.  The bit pattern of each value is mixed in turn
+ * so that values differing in any bit, including the sign of zero, and
+ * sequences differing in length produce distinct digests with overwhelming
+ * probability.
+ */
+class digest
+{
+public:
+
+    /** Begin digesting an empty sequence. */
+    digest() : h(prime5), n(0) {}
+
+    /**
+     * Mix in one more value.  Only bytes holding the value are mixed as
+     * padding, for example within an 80-bit <tt>long double</tt>, is
+     * unspecified.  Sign and exponent occupy at most 16 bits beyond the
+     * mantissa in every supported format.
+     */
+    template <class Real>
+    void update(const Real& x)
+    {
+        const std::size_t bits  = std::numeric_limits<Real>::digits + 16;
+        const std::size_t bytes = std::min(sizeof(Real), (bits + 7) / 8);
+        const unsigned char *b = reinterpret_cast<const unsigned char*>(&x);
+        for (std::size_t i = 0; i < bytes; i += sizeof(unsigned long long)) {
+            unsigned long long v = 0;
+            std::memcpy(&v, b + i, std::min(sizeof(v), bytes - i));
+            h ^= rotl(v * prime2, 31) * prime1;
+            h  = rotl(h, 27) * prime1 + prime4;
+        }
+        ++n;
+    }
+
+    /** Mix in every value within <tt>[first, last)</tt>. */
+    template <class InputIterator>
+    digest& update(InputIterator first, InputIterator last)
+    {
+        for (; first != last; ++first) update(*first);
+        return *this;
+    }
+
+    /** Number of values mixed in thus far. */
+    unsigned long long size() const { return n; }
+
+    /** The digest of all values mixed in thus far. */
+    unsigned long long value() const
+    {
+        unsigned long long z = h + n * prime3;
+        z = (z ^ (z >> 33)) * prime2;
+        z = (z ^ (z >> 29)) * prime3;
+        return z ^ (z >> 32);
+    }
+
+    /** The \ref value() as sixteen lowercase hexadecimal digits. */
+    std::string hex() const
+    {
+        static const char digits[] = "0123456789abcdef";
+        const unsigned long long v = value();
+        std::string s(16, '0');
+        for (int i = 0; i < 16; ++i) s[15 - i] = digits[(v >> 4*i) & 0xf];
+        return s;
+    }
+
+private:
+
+    static unsigned long long rotl(const unsigned long long x, const int r)
+    {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    static const unsigned long long prime1 = 0x9E3779B185EBCA87ULL;
+    static const unsigned long long prime2 = 0xC2B2AE3D27D4EB4FULL;
+    static const unsigned long long prime3 = 0x165667B19E3779F9ULL;
+    static const unsigned long long prime4 = 0x85EBCA77C2B2AE63ULL;
+    static const unsigned long long prime5 = 0x27D4EB2F165667C5ULL;
+
+    unsigned long long h;
+    unsigned long long n;
+};
+
+/**
+ * An on-disk cache of model hierarchies, for example \ref ar::burg_hierarchy,
+ * keyed by a \ref digest of the data, whether the mean was subtracted, and
+ * the working precision.  One file per key within directory \c dir holds
+ * the deepest hierarchy stored so that requests through any lesser maximum
+ * order are answered by that file.  Files are written in native byte order
+ * to a temporary name and then renamed so that concurrent readers never see
+ * a partial file.  A \c Hierarchy provides \c value_type along with public
+ * members \c N, \c maxorder, \c subtract_mean, \c mu, \c params, \c
+ * sigma2e, \c gain, \c autocor, and \c covers(maxorder) mirroring \ref
+ * ar::burg_hierarchy.
+ */
+class cache
+{
+public:
+
+    /** Use files within directory \c dir, which must already exist. */
+    explicit cache(const std::string& dir) : dir(dir) {}
+
+    /** The file holding any hierarchy for the given key. */
+    template <class Real>
+    std::string path(const digest& key, const bool subtract_mean) const
+    {
+        std::ostringstream os;
+        os << (dir.empty() ? std::string(".") : dir) << "/ar-" << key.hex()
+           << (subtract_mean ? "-s-" : "-r-") << 8*sizeof(Real)
+           << ".hierarchy";
+        return os.str();
+    }
+
+    /**
+     * Load into \c h any hierarchy stored for \c key and \c subtract_mean
+     * reaching \c maxorder.  Missing, unreadable, mismatched, or too shallow
+     * files are all reported as misses after which \c h is unspecified.
+     *
+     * @returns true if \c h was loaded.
+     */
+    template <class Hierarchy>
+    bool load(const digest&     key,
+              const bool        subtract_mean,
+              const std::size_t maxorder,
+              Hierarchy&        h) const
+    {
+        typedef typename Hierarchy::value_type value_type;
+
+        const std::string name = path<value_type>(key, subtract_mean);
+        FILE *f = std::fopen(name.c_str(), "rb");
+        if (!f) return false;
+        unsigned long long w[5];
+        value_type mu;
+        bool ok = header(f, sizeof(value_type), key, subtract_mean, w)
+               && std::fread(&mu, sizeof(mu), 1, f) == 1;
+        if (ok) {
+            const std::size_t p = w[3];
+            h.N             = w[2];
+            h.maxorder      = p;
+            h.subtract_mean = subtract_mean;
+            h.mu            = mu;
+            ok = h.covers(maxorder)
+              && read(f, p*(p + 1)/2, h.params)
+              && read(f, p + 1,       h.sigma2e)
+              && read(f, p + 1,       h.gain)
+              && read(f, p + 1,       h.autocor);
+        }
+        std::fclose(f);
+        return ok;
+    }
+
+    /**
+     * Store \c h under \c key unless a hierarchy at least as deep is
+     * already stored, in which case that hierarchy is kept.
+     *
+     * @throws std::runtime_error on I/O errors.
+     */
+    template <class Hierarchy>
+    void store(const digest& key, const Hierarchy& h) const
+    {
+        typedef typename Hierarchy::value_type value_type;
+
+        const std::string name = path<value_type>(key, h.subtract_mean);
+        std::string temp = name + ".XXXXXX";
+#ifdef SAMPLES_POSIX
+        std::vector<char> buf(temp.begin(), temp.end());
+        buf.push_back('\0');
+        const int fd = mkstemp(&buf[0]);
+        temp = &buf[0];
+        FILE *f = fd < 0 ? 0 : fdopen(fd, "wb");
+        if (!f && fd >= 0) ::close(fd);
+#else
+        temp = name + ".tmp";
+        FILE *f = std::fopen(temp.c_str(), "wb");
+#endif
+        if (!f) {
+            throw std::runtime_error("Unable to create " + temp + ": "
+                                     + std::strerror(errno));
+        }
+        const unsigned long long w[5] = {
+            sizeof(value_type), key.value(), key.size(),
+            h.maxorder, static_cast<unsigned long long>(h.subtract_mean)
+        };
+        bool ok = std::fwrite(magic(), 1, magic_size, f) == magic_size
+               && std::fwrite(w, sizeof(w[0]), 5, f) == 5
+               && std::fwrite(&h.mu, sizeof(h.mu), 1, f) == 1
+               && write(f, h.params)
+               && write(f, h.sigma2e)
+               && write(f, h.gain)
+               && write(f, h.autocor);
+        ok = (std::fclose(f) == 0) && ok;
+
+        // A concurrent store may have finished a deeper hierarchy meanwhile
+        if (ok && holds<value_type>(key, h.subtract_mean, h.maxorder)) {
+            std::remove(temp.c_str());
+            return;
+        }
+#ifndef SAMPLES_POSIX
+        if (ok) std::remove(name.c_str());
+#endif
+        if (!ok || std::rename(temp.c_str(), name.c_str()) != 0) {
+            const std::string what = std::strerror(errno);
+            std::remove(temp.c_str());
+            throw std::runtime_error("Unable to write " + name + ": " + what);
+        }
+    }
+
+private:
+
+    /**
+     * Read and check the header of \c f against the key, leaving the words
+     * following the magic in \c w.  Maximum orders unreachable from the
+     * stored sample count mark corrupt or foreign files.
+     */
+    static bool header(FILE               *f,
+                       const std::size_t  size,
+                       const digest&      key,
+                       const bool         subtract_mean,
+                       unsigned long long w[5])
+    {
+        char m[magic_size];
+        return std::fread(m, 1, sizeof(m), f) == sizeof(m)
+            && std::memcmp(m, magic(), sizeof(m)) == 0
+            && std::fread(w, sizeof(w[0]), 5, f) == 5
+            && w[0] == size
+            && w[1] == key.value()
+            && w[2] == key.size()
+            && w[3] <  std::max(w[2], 1ULL)
+            && w[4] == static_cast<unsigned long long>(subtract_mean);
+    }
+
+    /** Is a hierarchy through at least \c maxorder stored for the key? */
+    template <class Real>
+    bool holds(const digest&     key,
+               const bool        subtract_mean,
+               const std::size_t maxorder) const
+    {
+        const std::string name = path<Real>(key, subtract_mean);
+        FILE *f = std::fopen(name.c_str(), "rb");
+        if (!f) return false;
+        unsigned long long w[5];
+        const bool ok = header(f, sizeof(Real), key, subtract_mean, w)
+                     && w[3] >= maxorder;
+        std::fclose(f);
+        return ok;
+    }
+
+    template <class Vector>
+    static bool read(FILE *f, const std::size_t count, Vector& v)
+    {
+        v.resize(count);
+        return count == 0
+            || std::fread(&v[0], sizeof(v[0]), count, f) == count;
+    }
+
+    template <class Vector>
+    static bool write(FILE *f, const Vector& v)
+    {
+        return v.empty()
+            || std::fwrite(&v[0], sizeof(v[0]), v.size(), f) == v.size();
+    }
+
+    // Identifies cache files and their layout version
+    enum { magic_size = 8 };
+    static const char* magic() { return "arhier01"; }
+
+    std::string dir;
+};
+
+} // namespace samples
+
+#endif /* SAMPLES_HPP */
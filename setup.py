@@ -1,7 +1,11 @@
 """Setuptools for building the extension package"""
+import sys
 from setuptools import setup, Extension
 import numpy.distutils.misc_util
 
+# OpenMP permits ar.arsel to process many signals concurrently
+OPENMP = [] if sys.platform in ('darwin', 'win32') else ['-fopenmp']
+
 PACKAGE_NAME = 'ar'
 
 setup(
@@ -20,6 +24,8 @@ setup(
             depends=['ar.hpp'],
             sources=['ar-python.cpp'],
             include_dirs=numpy.distutils.misc_util.get_numpy_include_dirs(),
+            extra_compile_args=OPENMP,
+            extra_link_args=OPENMP,
         )
     ],
 )
@@ -9,22 +9,26 @@
  */
 
 #include <algorithm>
+#include <cstdio>
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <iterator>
+#include <limits>
+#include <stdexcept>
 #include <vector>
 
 #include "ar.hpp"
 #include "optionparser.h"
 #include "real.hpp"
+#include "samples.hpp"
 
 #define STRINGIFY_HELPER(x) #x
 #define STRINGIFY(x) STRINGIFY_HELPER(x)
 
 // Command line argument declarations for optionparser.h usage
 enum OptionIndex {
-    UNKNOWN, HELP, SUBMEAN
+    UNKNOWN, FORMAT, FUSED, HELP, INPLACE, LOCKSTEP, PARALLEL, SIMD, SUBMEAN
 };
 const option::Descriptor usage[] = {
     {UNKNOWN, 0, "", "",      option::Arg::None,
@@ -34,8 +38,20 @@ const option::Descriptor usage[] = {
      "\n"
      "Options:" },
     {0,0,"","",option::Arg::None,0}, // table break
+    {FORMAT,  0,  "F", "format",        option::Arg::Optional,
+     "  -F \t--format=FMT  \tRead DATA as 'text' (default), 'u8', 'f32', 'f64', or 'npy'" },
+    {FUSED,   0,  "f", "fused",         option::Arg::None,
+     "  -f \t--fused  \tFit using ar::burg_fused_kernel and compare" },
     {HELP,    0,  "h", "help",          option::Arg::None,
      "  -h \t--help   \tDisplay this help message and immediately exit" },
+    {INPLACE, 0,  "i", "inplace",       option::Arg::None,
+     "  -i \t--inplace  \tFit using ar::burg_method_inplace and compare" },
+    {LOCKSTEP,0,  "l", "lockstep",      option::Arg::None,
+     "  -l \t--lockstep  \tFit using ar::burg_method_lockstep and compare" },
+    {PARALLEL,0,  "p", "parallel",      option::Arg::None,
+     "  -p \t--parallel  \tFit using ar::burg_parallel_kernel and compare" },
+    {SIMD,    0,  "v", "simd",          option::Arg::None,
+     "  -v \t--simd  \tFit using ar::burg_simd_kernel and compare" },
     {SUBMEAN, 0,  "s", "subtract-mean", option::Arg::None,
      "  -s \t--subtract-mean  \tSubtract the sample mean from the incoming data" },
     {0,0,0,0,0,0}
@@ -44,10 +60,37 @@ const option::Descriptor usage[] = {
 // Computes percent difference of \c b against theoretical result \c a.
 template<typename FPT> FPT pdiff(FPT a, FPT b) { return (b - a) / a * 100; }
 
+// Are \c a and \c b equal to within tolerance \c tol relative to max(1,|a|,|b|)?
+template<typename FPT> bool close(FPT a, FPT b, FPT tol) {
+    using std::abs; using std::max;
+    return a == b || abs(a - b) <= tol * max(FPT(1), max(abs(a), abs(b)));
+}
+
+template<typename T> struct close_to : public std::binary_function<T,T,bool> {
+    T tol;
+    close_to(T tol) : tol(tol) {}
+    bool operator() (T a, T b) const { return close(a, b, tol); }
+};
+
+// Are \c a and \c b identical, counting two NaNs as identical?
+template<typename FPT> bool same_or_nan(FPT a, FPT b) {
+    return a == b || (a != a && b != b);
+}
+
 template<typename T> struct sum_error : public std::binary_function<T,T,T> {
     T operator() (T a, T b) {using std::abs; return a + abs(b);}
 };
 
+// Iterates over a tabulated autocorrelation for decorrelation_time
+struct tabulated_autocorrelation {
+    typedef real value_type;
+    const real *r;
+    std::size_t p;
+    std::size_t order() const { return p; }
+    real operator*() const { return *r; }
+    tabulated_autocorrelation& operator++() { ++r; return *this; }
+};
+
 // Test burg_method against synthetic data
 int main(int argc, char *argv[])
 {
@@ -55,7 +98,13 @@ int main(int argc, char *argv[])
     using namespace std;
 
     string filename_coeffs, filename_data;
+    samples::format format = samples::TEXT;
     bool subtract_mean = false;
+    bool fused         = false;
+    bool inplace       = false;
+    bool lockstep      = false;
+    bool parallel      = false;
+    bool simd          = false;
     {
         option::Stats stats(usage, argc-(argc>0), argv+(argc>0));
 
@@ -76,6 +125,29 @@ int main(int argc, char *argv[])
             return EXIT_SUCCESS;
         }
 
+        if (options[FORMAT]) {
+            const char *name = options[FORMAT].last()->arg;
+            if (!name || !samples::parse_format(name, format)) {
+                cerr << "Unknown format: " << (name ? name : "") << "\n";
+                return EXIT_FAILURE;
+            }
+        }
+
+        if (options[FUSED])
+            fused = true;
+
+        if (options[INPLACE])
+            inplace = true;
+
+        if (options[LOCKSTEP])
+            lockstep = true;
+
+        if (options[PARALLEL])
+            parallel = true;
+
+        if (options[SIMD])
+            simd = true;
+
         if (options[SUBMEAN])
             subtract_mean = true;
 
@@ -99,19 +171,902 @@ int main(int argc, char *argv[])
     vector<real> est(exact.size()), cor(exact.size() + 1);
 
     // Read time series data
-    ifstream f;
-    f.exceptions(ifstream::badbit);
-    f.open(filename_data.c_str());
+    vector<real> data;
+    {
+        samples::source<real> in(format, filename_data.c_str());
+        data.assign(in.begin(), in.end());
+    }
 
     // Use burg_method to fit an AR model and characterize it completely
     size_t maxorder = exact.size();
     real mean, sigma2e, gain;
-    burg_method(istream_iterator<real>(f), istream_iterator<real>(),
-                mean, maxorder, est.begin(), &sigma2e, &gain, cor.begin(),
+    burg_method(data.begin(), data.end(), mean, maxorder,
+                est.begin(), &sigma2e, &gain, cor.begin(),
                 subtract_mean, false);
 
-    // Close input file
-    f.close();
+    // When requested, check a variant reproduces burg_method bit-for-bit
+    if (inplace) {
+        size_t maxorder2 = exact.size();
+        real mean2, sigma2e2, gain2;
+        vector<real> est2(est.size()), cor2(cor.size()), scratch(data.size());
+        vector<real> work(data);  // Later checks require the original data
+        burg_method_inplace(work.begin(), work.end(), mean2, maxorder2,
+                            est2.begin(), &sigma2e2, &gain2, cor2.begin(),
+                            subtract_mean, false, scratch.begin());
+        if (   maxorder2 != maxorder || mean2 != mean
+            || sigma2e2 != sigma2e   || gain2 != gain
+            || !equal(est.begin(), est.end(), est2.begin())
+            || !equal(cor.begin(), cor.end(), cor2.begin())) {
+            cerr << "burg_method_inplace differs from burg_method\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // When requested, check the single pass kernels reproduce bit-for-bit
+    if (fused) {
+        size_t maxorder2 = exact.size();
+        real mean2, sigma2e2, gain2;
+        vector<real> est2(est.size()), cor2(cor.size()), f, b, Ak, ac;
+        burg_method(data.begin(), data.end(), mean2, maxorder2,
+                    est2.begin(), &sigma2e2, &gain2, cor2.begin(),
+                    subtract_mean, false, f, b, Ak, ac, burg_fused_kernel());
+        if (   maxorder2 != maxorder || mean2 != mean
+            || sigma2e2 != sigma2e   || gain2 != gain
+            || !equal(est.begin(), est.end(), est2.begin())
+            || !equal(cor.begin(), cor.end(), cor2.begin())) {
+            cerr << "burg_fused_kernel differs from burg_scalar_kernel\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // When requested, check the vectorized kernels agree to within tolerance
+    // as their summation order necessarily differs from the scalar reference
+    if (simd) {
+        size_t maxorder2 = exact.size();
+        real mean2, sigma2e2, gain2;
+        vector<real> est2(est.size()), cor2(cor.size()), f, b, Ak, ac;
+        burg_method(data.begin(), data.end(), mean2, maxorder2,
+                    est2.begin(), &sigma2e2, &gain2, cor2.begin(),
+                    subtract_mean, false, f, b, Ak, ac, burg_simd_kernel());
+        const real tol = 1000*numeric_limits<real>::epsilon();
+        if (   maxorder2 != maxorder || mean2 != mean
+            || !close(sigma2e, sigma2e2, tol) || !close(gain, gain2, tol)
+            || !equal(est.begin(), est.end(), est2.begin(), close_to<real>(tol))
+            || !equal(cor.begin(), cor.end(), cor2.begin(), close_to<real>(tol))) {
+            cerr << "burg_simd_kernel differs from burg_scalar_kernel\n";
+            return EXIT_FAILURE;
+        }
+
+        // Prediction error updates must match the scalar kernel bit-for-bit
+        // whatever instruction set is selected, so apply one to the data
+        vector<real> f1(data), b1(data), f2(data), b2(data);
+        const real mu = -2*burg_scalar_kernel()
+            .negative_half_reflection_coefficient<real>(
+                f1.begin() + 1, f1.end(), b1.begin());
+        const real r1 = burg_scalar_kernel().update_and_reflect(
+                f1.begin() + 1, f1.end(), b1.begin(), mu);
+        const real r2 = burg_simd_kernel().update_and_reflect(
+                f2.begin() + 1, f2.end(), b2.begin(), mu);
+        if (f1 != f2 || b1 != b2 || !close(r1, r2, tol)) {
+            cerr << "burg_simd_kernel update differs from burg_scalar_kernel\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // When requested, check lockstep fitting of the data, the reversed data,
+    // and then the data again reproduces burg_method bit-for-bit in lanes
+    // zero and two.  Lane one confirms that lanes do not interfere.
+    if (lockstep) {
+        vector<real> reversed(data.rbegin(), data.rend());
+        vector<vector<real>::iterator> firsts;
+        firsts.push_back(data.begin());
+        firsts.push_back(reversed.begin());
+        firsts.push_back(data.begin());
+        vector<vector<real> > est2(3, est), cor2(3, cor);
+        vector<vector<real>::iterator> est2_out, cor2_out;
+        vector<real*> sigma2e2_out, gain2_out;
+        real mean2[3], sigma2e2[3], gain2[3];
+        for (size_t k = 0; k < 3; ++k) {
+            est2_out.push_back(est2[k].begin());
+            cor2_out.push_back(cor2[k].begin());
+            sigma2e2_out.push_back(&sigma2e2[k]);
+            gain2_out   .push_back(&gain2[k]);
+        }
+        size_t maxorder2 = exact.size();
+        vector<real> f, b, Ak, ac;
+        burg_method_lockstep(3, firsts.begin(), data.size(), mean2, maxorder2,
+                             est2_out.begin(), sigma2e2_out.begin(),
+                             gain2_out.begin(), cor2_out.begin(),
+                             subtract_mean, false, f, b, Ak, ac);
+        for (size_t k = 0; k < 3; k += 2) {
+            if (   maxorder2 != maxorder || mean2[k] != mean
+                || sigma2e2[k] != sigma2e || gain2[k] != gain
+                || est2[k] != est         || cor2[k] != cor) {
+                cerr << "burg_method_lockstep differs from burg_method\n";
+                return EXIT_FAILURE;
+            }
+        }
+
+        // Signals given as strided rows of a column-major array must be
+        // gathered to reproduce the contiguous results bit-for-bit
+        const size_t N = data.size();
+        vector<real> colmajor(3*N);
+        for (size_t n = 0; n < N; ++n) {
+            for (size_t k = 0; k < 3; ++k) colmajor[3*n + k] = firsts[k][n];
+        }
+        vector<strided_adaptor<real*> > strided;
+        for (size_t k = 0; k < 3; ++k) {
+            strided.push_back(strided_adaptor<real*>(&colmajor[k], 3));
+        }
+        vector<vector<real> > est3(3, est), cor3(3, cor);
+        real mean3[3], sigma2e3[3], gain3[3];
+        for (size_t k = 0; k < 3; ++k) {
+            est2_out[k]     = est3[k].begin();
+            cor2_out[k]     = cor3[k].begin();
+            sigma2e2_out[k] = &sigma2e3[k];
+            gain2_out[k]    = &gain3[k];
+        }
+        size_t maxorder3 = exact.size();
+        burg_method_lockstep(3, strided.begin(), N, mean3, maxorder3,
+                             est2_out.begin(), sigma2e2_out.begin(),
+                             gain2_out.begin(), cor2_out.begin(),
+                             subtract_mean, false, f, b, Ak, ac);
+        for (size_t k = 0; k < 3; ++k) {
+            if (   maxorder3 != maxorder2 || mean3[k] != mean2[k]
+                || sigma2e3[k] != sigma2e2[k] || gain3[k] != gain2[k]
+                || est3[k] != est2[k]         || cor3[k] != cor2[k]) {
+                cerr << "burg_method_lockstep differs given strided rows\n";
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    // When requested, check the multithreaded kernels agree to within
+    // tolerance and reproduce themselves bit-for-bit on repeated invocation.
+    // A tiny grain forces splitting even these short test signals.
+    // Means are merged across chunks so they too agree only to tolerance.
+    if (parallel) {
+        const burg_parallel_kernel kernel(4, 1);
+        size_t maxorder2 = exact.size(), maxorder3 = exact.size();
+        real mean2, sigma2e2, gain2, mean3, sigma2e3, gain3;
+        vector<real> est2(est.size()), cor2(cor.size()), f, b, Ak, ac;
+        vector<real> est3(est.size()), cor3(cor.size());
+        burg_method(data.begin(), data.end(), mean2, maxorder2,
+                    est2.begin(), &sigma2e2, &gain2, cor2.begin(),
+                    subtract_mean, false, f, b, Ak, ac, kernel);
+        burg_method(data.begin(), data.end(), mean3, maxorder3,
+                    est3.begin(), &sigma2e3, &gain3, cor3.begin(),
+                    subtract_mean, false, f, b, Ak, ac, kernel);
+        const real tol = 1000*numeric_limits<real>::epsilon();
+        if (   maxorder2 != maxorder || !close(mean, mean2, tol)
+            || !close(sigma2e, sigma2e2, tol) || !close(gain, gain2, tol)
+            || !equal(est.begin(), est.end(), est2.begin(), close_to<real>(tol))
+            || !equal(cor.begin(), cor.end(), cor2.begin(), close_to<real>(tol))) {
+            cerr << "burg_parallel_kernel differs from burg_scalar_kernel\n";
+            return EXIT_FAILURE;
+        }
+        if (   maxorder3 != maxorder2 || mean3 != mean2
+            || sigma2e3 != sigma2e2   || gain3 != gain2
+            || !equal(est2.begin(), est2.end(), est3.begin())
+            || !equal(cor2.begin(), cor2.end(), cor3.begin())) {
+            cerr << "burg_parallel_kernel is not reproducible\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Check welford_nvariance_merge combining uneven pieces pairwise, some
+    // possibly empty, recovers the statistics of the whole sample
+    {
+        const size_t N = data.size(), cut[] = { 0, N/7, N/7, N/2, N };
+        real m[4], nv[4], mw, nvw;
+        size_t n[4];
+        for (int i = 0; i < 4; ++i)
+            n[i] = welford_nvariance(data.begin() + cut[i],
+                                     data.begin() + cut[i + 1], m[i], nv[i]);
+        welford_nvariance(data.begin(), data.end(), mw, nvw);
+        const size_t n01 = welford_nvariance_merge(n[0], m[0], nv[0],
+                                                   n[1], m[1], nv[1]);
+        const size_t n23 = welford_nvariance_merge(n[2], m[2], nv[2],
+                                                   n[3], m[3], nv[3]);
+        const size_t nall = welford_nvariance_merge(n01, m[0], nv[0],
+                                                    n23, m[2], nv[2]);
+        const real tol = 100*numeric_limits<real>::epsilon();
+        if (nall != N || !close(m[0], mw, tol) || !close(nv[0], nvw, tol)) {
+            cerr << "welford_nvariance_merge differs from welford_nvariance\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Check truncating decorrelation_time does not perceptibly change T0
+    for (int absrho = 0; absrho < 2; ++absrho) {
+        const real eps = numeric_limits<real>::epsilon();
+        real T0  = decorrelation_time(data.size(),
+                       autocorrelation(est.begin(), est.end(),
+                                       gain, cor.begin()), absrho != 0);
+        real T0t = decorrelation_time(data.size(),
+                       autocorrelation(est.begin(), est.end(),
+                                       gain, cor.begin()), absrho != 0, eps);
+        if (!close(T0, T0t, 10*eps)) {
+            cerr << "truncated decorrelation_time differs: "
+                 << T0t << " versus " << T0 << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Check two-process decorrelation_time sums past a block of zero
+    // products when neither autocorrelation is identically zero
+    {
+        const real r1[] = { 1, 0, 0.5, 0, 0.25, 0, 0.125, 0, 0.0625 };
+        const real r2[] = { 1, -0.5, 0, 0.25, 0.25, 0.125, 0.125, 0.0625,
+                            0.0625 };
+        const size_t N = sizeof(r1)/sizeof(r1[0]) - 1;
+        real T0 = 1;
+        for (size_t i = 1; i <= N; ++i) {
+            T0 += 2 * (1 - real(i) / N) * r1[i] * r2[i];
+        }
+        const tabulated_autocorrelation rho1 = { r1, 2 }, rho2 = { r2, 2 };
+        const real T0t = decorrelation_time(N, rho1, rho2);
+        if (!close(T0, T0t, 10*numeric_limits<real>::epsilon())) {
+            cerr << "two-process decorrelation_time truncated early: "
+                 << T0t << " versus " << T0 << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Check basic_predictor::generate reproduces predictor bit-for-bit
+    {
+        predictor<real> p = autocorrelation(est.begin(), est.end(),
+                                            gain, cor.begin());
+        basic_predictor<real> q(est.begin(), est.end());
+        q.initial_conditions(++cor.begin(), 1 / gain);
+        vector<real> x(data.size()), y;
+        q.generate(x.begin(), x.size());
+        for (size_t i = 0; i < x.size(); ++i) y.push_back(*p++);
+        if (x != y || *q != *p) {
+            cerr << "basic_predictor differs from predictor\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Check batch_forecaster across several blocks of series, each using a
+    // truncation of est and sometimes a mean, against basic_predictor fed
+    // the same tail of data.  Zero-mean forecasts must match bit-for-bit.
+    // Variances must accumulate the impulse response of each model, which
+    // also propagates the rounding from centering forecasts about a mean.
+    if (data.size() > est.size()) {
+        const size_t p = est.size(), M = 131, H = 20;
+        batch_forecaster<real> bf(M, p);
+        for (size_t i = 0; i < M; ++i) {
+            bf.model(i, est.begin(), est.begin() + i % (p + 1),
+                     i % 2 ? mean : real(0), sigma2e);
+        }
+        for (size_t n = data.size() - p; n < data.size(); ++n) {
+            vector<real> row(M, data[n]);
+            bf.observe(row.begin());
+        }
+        vector<real> F(H*M), V(H*M);
+        bf.forecast(H, &F[0], &V[0]);
+
+        const real tol = 100*numeric_limits<real>::epsilon();
+        for (size_t i = 0; i < M; ++i) {
+            const size_t q  = i % (p + 1);
+            const real   mu = i % 2 ? mean : real(0);
+            vector<real> tail;
+            for (size_t k = 1; k <= q; ++k)
+                tail.push_back(data[data.size() - k] - mu);
+            basic_predictor<real> x(est.begin(), est.begin() + q);
+            basic_predictor<real> psi(est.begin(), est.begin() + q);
+            x.initial_conditions(tail.begin());
+            psi.initial_conditions(vector<real>(q).begin(), 1);
+            real sum = 0, l1 = 0;
+            for (size_t h = 0; h < H; ++h, ++x, ++psi) {
+                sum += *psi * *psi;
+                l1  += abs(*psi);
+                const real f = F[h*M + i], v = V[h*M + i];
+                if (mu ? !close(f, *x + mu, tol*l1*(1 + abs(mu))) : f != *x) {
+                    cerr << "batch_forecaster series " << i << " forecast "
+                         << f << " differs from " << *x + mu << "\n";
+                    return EXIT_FAILURE;
+                }
+                if (!close(v, sigma2e*sum, tol)) {
+                    cerr << "batch_forecaster series " << i << " variance "
+                         << v << " differs from " << sigma2e*sum << "\n";
+                    return EXIT_FAILURE;
+                }
+            }
+        }
+    }
+
+    // Check burg_method_fixed, which burg_method uses for small orders,
+    // matches the generic recursion and autocorrelation<P> bit-for-bit
+    if (data.size() > 4) {
+        const size_t P = 4;
+        size_t p = P;
+        real m1, m2;
+        vector<real> a1, s1, g1, r1, a2, s2, g2, r2, f, b, Ak, ac;
+        burg_method_fixed<P>(data.begin(), data.end(), m1,
+                             back_inserter(a1), back_inserter(s1),
+                             back_inserter(g1), back_inserter(r1),
+                             subtract_mean, /* hierarchy? */ true);
+        burg_method(data.begin(), data.end(), m2, p,
+                    back_inserter(a2), back_inserter(s2),
+                    back_inserter(g2), back_inserter(r2),
+                    subtract_mean, /* hierarchy? */ true, f, b, Ak, ac,
+                    burg_scalar_kernel(), burg_reflection_stop<real>(0));
+        if (   p != P || m1 != m2 || a1 != a2
+            || s1 != s2 || g1 != g2 || r1 != r2) {
+            cerr << "burg_method_fixed differs from burg_recursion\n";
+            return EXIT_FAILURE;
+        }
+        predictor<real> u = autocorrelation(a1.end() - P, a1.end(),
+                                            g1.back(), r1.begin());
+        basic_predictor<real, zero_noise<real>, P> v
+                = autocorrelation<P>(a1.end() - P, g1.back(), r1.begin());
+        for (size_t i = 0; i < 4*P; ++i) {
+            if (*u++ != *v++) {
+                cerr << "autocorrelation<P> differs from autocorrelation\n";
+                return EXIT_FAILURE;
+            }
+        }
+        bool rejected = false;
+        try {
+            v.assign(a1.end() - P, a1.end() - 1);
+        } catch (const std::invalid_argument&) {
+            rejected = true;
+        }
+        if (!rejected) {
+            cerr << "basic_predictor accepted a mismatched order\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Check online_best_model selects the same model as best_model
+    {
+        const size_t maxorder = est.size();
+        vector<real> params, sigma2e, gain, autocor;
+        size_t p1 = maxorder, p2 = maxorder;
+        real m;
+        burg_method(data.begin(), data.end(), m, p1,
+                    back_inserter(params), back_inserter(sigma2e),
+                    back_inserter(gain), back_inserter(autocor),
+                    subtract_mean, /* hierarchy? */ true);
+        best_model_function<
+                Burg, size_t, size_t, vector<real>
+            >::lookup("CIC", subtract_mean)(
+                data.size(), 0, params, sigma2e, gain, autocor);
+        online_best_model<real> s(criterion_function<Burg, real>::lookup(
+                                  "CIC", subtract_mean), data.size(), 0);
+        burg_method(data.begin(), data.end(), m, p2,
+                    s.params(), s.sigma2e(), s.gain(), s.autocor(),
+                    subtract_mean, /* hierarchy? */ true);
+        if (   !s.selected() || s.order() != params.size()
+            || s.best_params() != params || s.best_autocor() != autocor
+            || s.best_sigma2e() != sigma2e[0] || s.best_gain() != gain[0]) {
+            cerr << "online_best_model differs from best_model\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Check best_models selects every criterion's model in one sweep exactly
+    // as best_model does given its own copy of the hierarchy
+    {
+        const char* abbrev[] = { "AIC", "AICC", "BIC", "CIC",
+                                 "FIC", "FSIC", "GIC", "MCC" };
+        const size_t K = sizeof(abbrev)/sizeof(abbrev[0]);
+        const size_t maxorder = est.size() + 5;
+        vector<real> params, sigma2e, gain, autocor;
+        size_t p = maxorder;
+        real m;
+        burg_method(data.begin(), data.end(), m, p,
+                    back_inserter(params), back_inserter(sigma2e),
+                    back_inserter(gain), back_inserter(autocor),
+                    subtract_mean, /* hierarchy? */ true);
+        for (size_t minorder = 0; minorder <= 2 && minorder <= p; minorder += 2) {
+            best_models<real> s;
+            for (size_t i = 0; i < K; ++i) {
+                s.add(criterion_function<Burg, real>::lookup_table(
+                        abbrev[i], subtract_mean));
+            }
+            s.evaluate(data.size(), minorder, sigma2e);
+            for (size_t i = 0; i < K; ++i) {
+                vector<real> params2(params), sigma2e2(sigma2e),
+                             gain2(gain), autocor2(autocor);
+                best_model_function<
+                        Burg, size_t, size_t, vector<real>
+                    >::lookup(abbrev[i], subtract_mean)(
+                        data.size(), minorder,
+                        params2, sigma2e2, gain2, autocor2);
+                const size_t q = s.order(i);
+                if (   q != params2.size()
+                    || !equal(params2.begin(), params2.end(),
+                              s.params(i, params.begin()))
+                    || sigma2e[q] != sigma2e2[0] || gain[q] != gain2[0]
+                    || !equal(autocor2.begin(), autocor2.end(),
+                              autocor.begin())) {
+                    cerr << "best_models differs from best_model for "
+                         << abbrev[i] << "\n";
+                    return EXIT_FAILURE;
+                }
+            }
+        }
+    }
+
+    // Check every tabulated criterion matches evaluate bit-for-bit
+    {
+        const char* abbrev[] = { "AIC", "AICC", "BIC", "CIC",
+                                 "FIC", "FSIC", "GIC", "MCC" };
+        const size_t N = data.size(), maxorder = N - 1;
+        for (size_t i = 0; i < sizeof(abbrev)/sizeof(abbrev[0]); ++i) {
+            penalty_table<real> table(
+                    criterion_function<Burg, real>::lookup_table(
+                        abbrev[i], subtract_mean), N, maxorder);
+            criterion_function<Burg, real>::type f
+                = criterion_function<Burg, real>::lookup(
+                        abbrev[i], subtract_mean);
+            for (size_t p = 0; p <= maxorder; ++p) {
+                const real t = table(sigma2e, p), e = f(sigma2e, N, p);
+                if (t != e && (t == t || e == e)) {  // Both NaN is a match
+                    cerr << "penalty_table differs from evaluate for "
+                         << abbrev[i] << " at order " << p << "\n";
+                    return EXIT_FAILURE;
+                }
+            }
+        }
+    }
+
+    // Check stopping policies end the recursion where expected and that the
+    // truncated hierarchy is otherwise identical to the complete one
+    {
+        const size_t maxorder = est.size();
+        vector<real> params, sigma2e, gain, autocor;
+        vector<real> f, b, Ak, ac;
+        size_t p = maxorder;
+        real m;
+        burg_method(data.begin(), data.end(), m, p,
+                    back_inserter(params), back_inserter(sigma2e),
+                    back_inserter(gain), back_inserter(autocor),
+                    subtract_mean, /* hierarchy? */ true);
+
+        // Expect a stop at the first order whose |k| is below 1/10
+        size_t expected = 1;
+        while (expected < p && !(abs(params[expected*(expected+1)/2 - 1])
+                                 < real(1)/10))
+            ++expected;
+        expected = min(expected, p);
+
+        for (int policy = 0; policy < 2; ++policy) {
+            vector<real> params2, sigma2e2, gain2, autocor2;
+            size_t q = maxorder;
+            if (policy == 0) {
+                burg_method(data.begin(), data.end(), m, q,
+                            back_inserter(params2), back_inserter(sigma2e2),
+                            back_inserter(gain2), back_inserter(autocor2),
+                            subtract_mean, /* hierarchy? */ true,
+                            f, b, Ak, ac, burg_scalar_kernel(),
+                            burg_reflection_stop<real>(real(1)/10));
+            } else {
+                burg_method(data.begin(), data.end(), m, q,
+                            back_inserter(params2), back_inserter(sigma2e2),
+                            back_inserter(gain2), back_inserter(autocor2),
+                            subtract_mean, /* hierarchy? */ true,
+                            f, b, Ak, ac, burg_scalar_kernel(),
+                            burg_criterion_stop<real>(
+                                criterion_function<Burg, real>::lookup(
+                                    "CIC", subtract_mean),
+                                data.size(), 0, 2));
+            }
+            if (   q > p || (policy == 0 && p && q != expected)
+                || params2.size() != q*(q+1)/2 || sigma2e2.size() != q+1
+                || gain2.size() != q+1 || autocor2.size() != q+1
+                || !equal(params2 .begin(), params2 .end(), params .begin())
+                || !equal(sigma2e2.begin(), sigma2e2.end(), sigma2e.begin())
+                || !equal(gain2   .begin(), gain2   .end(), gain   .begin())
+                || !equal(autocor2.begin(), autocor2.end(), autocor.begin())) {
+                cerr << "stopped burg_method differs from complete\n";
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    // Check arsel_fit matches arsel_batch and, once warm, that refitting
+    // through the same burg_workspace reallocates none of its buffers
+    {
+        const criterion_function<Burg, real>::table_type crit
+                = criterion_function<Burg, real>::lookup_table(
+                    "CIC", subtract_mean);
+        const size_t maxorder = est.size();
+        vector<real>::const_iterator first = data.begin(), last = data.end();
+        arsel_result<real> r1, r2;
+        arsel_batch(1, &first, &last, &r1, "CIC",
+                    subtract_mean, true, 0, maxorder);
+        burg_workspace<real> w;
+        arsel_fit(data.begin(), data.end(), r2, crit,
+                  subtract_mean, true, 0, maxorder, 1, w);
+        const real *f = &w.f[0];
+        const size_t capacity = w.selector.best_params().capacity();
+        arsel_fit(data.begin(), data.end(), r2, crit,
+                  subtract_mean, true, 0, maxorder, 1, w);
+        if (   r1.AR != r2.AR || r1.autocor != r2.autocor
+            || r1.sigma2eps != r2.sigma2eps || r1.T0 != r2.T0) {
+            cerr << "arsel_fit differs from arsel_batch\n";
+            return EXIT_FAILURE;
+        }
+        if (f != &w.f[0] || capacity != w.selector.best_params().capacity()) {
+            cerr << "arsel_fit reallocated its burg_workspace\n";
+            return EXIT_FAILURE;
+        }
+
+        // Instrumentation must not perturb results and must count the work
+        // with penalties tabulated only by the first fit through a workspace
+        arsel_result<real, arsel_timing> r3;
+        arsel_fit(data.begin(), data.end(), r3, crit,
+                  subtract_mean, true, 0, maxorder, 1, w);
+        if (   r1.AR != r3.AR || r1.autocor != r3.autocor
+            || r1.sigma2eps != r3.sigma2eps || r1.T0 != r3.T0) {
+            cerr << "instrumented arsel_fit differs from arsel_batch\n";
+            return EXIT_FAILURE;
+        }
+        if (   r3.timing.iterations(arsel_load)    != data.size()
+            || r3.timing.iterations(arsel_penalty) != 0
+            || r3.timing.iterations(arsel_burg)    != r3.maxorder
+            || r3.timing.iterations(arsel_T0)      == 0
+            || r3.timing.seconds(arsel_burg)       <  0) {
+            cerr << "arsel_timing miscounted arsel_fit phases\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Check samples::digest tells apart sequences differing only in scale or
+    // sign, which are distinguished solely by sign and exponent bits
+    {
+        const real a[] = { 1, 3, 5 }, b[] = { 2, 6, 10 }, c[] = { -1, -3, -5 };
+        samples::digest da, db, dc;
+        da.update(a, a + 3);
+        db.update(b, b + 3);
+        dc.update(c, c + 3);
+        if (   da.value() == db.value() || da.value() == dc.value()
+            || db.value() == dc.value()) {
+            cerr << "samples::digest ignores sign or exponent bits\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Check replaying a cached burg_hierarchy matches arsel_fit both through
+    // the maximum order fit and through a lesser one
+    {
+        const criterion_function<Burg, real>::table_type crit
+                = criterion_function<Burg, real>::lookup_table(
+                    "CIC", subtract_mean);
+        const size_t maxorder = est.size() + 3;
+        burg_workspace<real> w;
+        burg_hierarchy<real> h, g, s;
+        h.assign(data.begin(), data.end(), subtract_mean, maxorder, w,
+                 burg_scalar_kernel());
+        s.assign(data.begin(), data.end(), subtract_mean, maxorder / 2, w,
+                 burg_scalar_kernel());
+        const char *tmpdir = getenv("TMPDIR");
+        const samples::cache cache(tmpdir && *tmpdir ? tmpdir : "/tmp");
+        samples::digest key;
+        key.update(data.begin(), data.end());
+        cache.store(key, h);
+        cache.store(key, s);  // Shallower so h must be kept
+        const bool deeper  = cache.load(key, subtract_mean, maxorder + 1, g);
+        const bool loaded  = cache.load(key, subtract_mean, maxorder, g);
+        remove(cache.path<real>(key, subtract_mean).c_str());
+        const bool removed = !cache.load(key, subtract_mean, maxorder, h);
+        if (deeper != (maxorder + 1 >= data.size()) || !loaded || !removed) {
+            cerr << "samples::cache failed to round trip a burg_hierarchy\n";
+            return EXIT_FAILURE;
+        }
+        const size_t orders[] = { maxorder, maxorder / 2 };
+        for (size_t i = 0; i < sizeof(orders)/sizeof(orders[0]); ++i) {
+            const size_t m = orders[i];
+            arsel_result<real> r1, r2;
+            arsel_fit(data.begin(), data.end(), r1, crit,
+                      subtract_mean, true, 0, m, 1, w);
+            arsel_replay(g, r2, crit, true, 0, m, 1, w);
+            if (   r1.AR != r2.AR || r1.autocor != r2.autocor
+                || r1.sigma2eps != r2.sigma2eps || r1.T0 != r2.T0
+                || r1.mu != r2.mu || r1.N != r2.N
+                || r1.maxorder != r2.maxorder) {
+                cerr << "arsel_replay through " << m
+                     << " differs from arsel_fit\n";
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    // Check synthesize produces one continuous realization across blocks by
+    // recovering every block's innovations from its counter_normal stream.
+    // Models with infinite gain have no stationary distribution to sample.
+    if (gain < numeric_limits<real>::max()) {
+        const size_t p = est.size(), block = max<size_t>(p, 100), N = 4096;
+        vector<real> x(N);
+        synthesize(est.begin(), est.end(), sigma2e, gain, cor.begin(),
+                   N, x.begin(), 5551212, block);
+        // Recovering residuals sums p + 1 terms as large as |a_i| sigma_x
+        real scale = 1;
+        for (size_t i = 0; i < p; ++i) scale += abs(est[i]);
+        const real tol = sqrt(numeric_limits<real>::epsilon())
+                       * sqrt(gain * sigma2e) * scale;
+        counter_normal<real> eps;
+        for (size_t n = 0; n < N; ++n) {
+            if (n % block == 0) {
+                eps = counter_normal<real>(5551212, n / block + 1,
+                                           sqrt(sigma2e));
+            }
+            const real e = eps();
+            if (n < p) continue;
+            real r = x[n];
+            for (size_t i = 0; i < p; ++i) r += est[i] * x[n - 1 - i];
+            if (!close(r, e, tol)) {
+                cerr << "synthesize residual " << r << " at " << n
+                     << " differs from innovation " << e << "\n";
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    // Check a sliding yule_walker_accumulator matches one fed only the final
+    // window and that its Levinson-Durbin solution agrees with Zohar's
+    {
+        const size_t p = est.size(), W = data.size() / 2;
+        yule_walker_accumulator<real> slide(p, W), fresh(p);
+        slide.push(data.begin(), data.end());
+        fresh.push(data.end() - W, data.end());
+        size_t p1 = p, p2 = p;
+        real m1, m2, s1, s2, g1, g2;
+        vector<real> a1(p), a2(p), r1(p + 1), r2(p + 1);
+        slide.fit(m1, p1, a1.begin(), &s1, &g1, r1.begin(), subtract_mean);
+        fresh.fit(m2, p2, a2.begin(), &s2, &g2, r2.begin(), subtract_mean);
+        // Summation orders differ and solving Yule-Walker amplifies that
+        // rounding by up to the conditioning of the Toeplitz system, which
+        // the gain bounds, so scale the tolerance on parameters accordingly
+        const real tol = sqrt(numeric_limits<real>::epsilon());
+        if (   p1 != p2 || !close(m1, m2, tol) || !close(s1, s2, tol)
+            || !equal(a1.begin(), a1.end(), a2.begin(),
+                      close_to<real>(tol * max(real(1), g2)))
+            || !equal(r1.begin(), r1.end(), r2.begin(), close_to<real>(tol))) {
+            cerr << "sliding yule_walker_accumulator differs from fresh\n";
+            return EXIT_FAILURE;
+        }
+        vector<real> neg(++r2.begin(), r2.end());
+        zohar_linear_solve(++r2.begin(), --r2.end(), neg.begin());
+        transform(neg.begin(), neg.end(), neg.begin(), negate<real>());
+        if (!equal(neg.begin(), neg.end(), a2.begin(),
+                   close_to<real>(tol * max(real(1), g2)))) {
+            cerr << "levinson_durbin differs from zohar_linear_solve\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Check FFT-based autocovariance against direct summation on a series
+    // long enough to take the FFT path, then check yule_walker_method
+    // agrees with levinson_durbin applied to directly summed lags
+    {
+        vector<real> x(data);
+        while (x.size() < 4096) x.insert(x.end(), data.begin(), data.end());
+        const size_t N = x.size();
+        real m = 0, v = 0;
+        welford_variance_population(x.begin(), x.end(), m, v);
+        vector<real> naive(N, 0);
+        for (size_t k = 0; k < N; ++k) {
+            for (size_t n = 0; n + k < N; ++n) {
+                naive[k] += (x[n] - m) * (x[n + k] - m);
+            }
+            naive[k] /= N;
+        }
+        size_t maxlag = N;
+        real mf;
+        vector<real> fast;
+        autocovariance(x.begin(), x.end(), mf, maxlag,
+                       back_inserter(fast), /* subtract_mean */ true);
+        const real tol = sqrt(numeric_limits<real>::epsilon()) * naive[0];
+        if (maxlag != N - 1 || fast.size() != N || !close(mf, m, tol)) {
+            cerr << "autocovariance returned unexpected extents\n";
+            return EXIT_FAILURE;
+        }
+        for (size_t k = 0; k < N; ++k) {
+            if (fabs(fast[k] - naive[k]) > tol) {
+                cerr << "autocovariance differs at lag " << k << '\n';
+                return EXIT_FAILURE;
+            }
+        }
+
+        size_t p1 = est.size(), p2 = est.size();
+        real my, s1, s2, g1, g2;
+        vector<real> a1(p1), a2(p2), r1(p1 + 1), r2(p2 + 1);
+        yule_walker_method(x.begin(), x.end(), my, p1, a1.begin(), &s1,
+                           &g1, r1.begin(), /* subtract_mean */ true);
+        levinson_durbin(p2, naive.begin(), a2.begin(), &s2, &g2, r2.begin());
+        const real rtol = sqrt(numeric_limits<real>::epsilon());
+        if (   p1 != p2 || !close(s1, s2, rtol)
+            || !equal(a1.begin(), a1.end(), a2.begin(), close_to<real>(rtol))) {
+            cerr << "yule_walker_method differs from levinson_durbin\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Check storing prediction errors in float while accumulating in real
+    // precision recovers the reference coefficients to within float rounding
+    {
+        size_t p = est.size();
+        real m, s2e, g;
+        vector<float> f, b;
+        vector<real> Ak, ac, a(p), r(p + 1);
+        burg_method(data.begin(), data.end(), m, p, a.begin(), &s2e, &g,
+                    r.begin(), subtract_mean, false, f, b, Ak, ac);
+        const real tol = 10 * numeric_limits<float>::epsilon();
+        if (   p != est.size() || !close(s2e, sigma2e, tol)
+            || !equal(a.begin(), a.end(), est.begin(), close_to<real>(tol))) {
+            cerr << "float storage with real accumulation differs\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Check float storage of a long signal still accumulates its mean and
+    // variance in double so neither drifts by the storage precision
+    {
+        const size_t N = size_t(1) << 22;
+        counter_normal<double> eps(8675309);
+        vector<double> x(N);
+        for (size_t n = 0; n < N; ++n) x[n] = eps();
+        size_t p1 = 1, p2 = 1;
+        double m1, m2, s1, s2, a1, a2, g1, g2, r1[2], r2[2];
+        vector<float>  f1, b1;
+        vector<double> f2, b2, Ak, ac;
+        burg_method(x.begin(), x.end(), m1, p1, &a1, &s1, &g1, r1,
+                    true, false, f1, b1, Ak, ac);
+        burg_method(x.begin(), x.end(), m2, p2, &a2, &s2, &g2, r2,
+                    true, false, f2, b2, Ak, ac);
+        const double tol = 10 * numeric_limits<float>::epsilon();
+        if (!close(m1, m2, tol) || !close(s1, s2, tol)) {
+            cerr << "long float storage mean " << m1 << " or sigma2e " << s1
+                 << " differs from double storage " << m2 << " " << s2 << '\n';
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Check burg_method_chunked reproduces burg_method bit-for-bit through a
+    // scratch file given one order per pass and otherwise within tolerance.
+    // Predicted coefficients deviate by up to sqrt(epsilon) which products
+    // like sigma2e and gain amplify somewhat on ill-conditioned data.
+    // Tiny chunks force carrying backward errors across many boundaries.
+    {
+        samples::scratch<real> store;
+        for (size_t L = 1; L <= 4; L += 3) {
+            size_t p = exact.size();
+            real m, s2e, g;
+            vector<real> a(p), r(p + 1);
+            burg_method_chunked(data.begin(), data.end(), m, p, a.begin(),
+                                &s2e, &g, r.begin(), subtract_mean, false,
+                                store, 64, L);
+            const real tol = L == 1 ? 0
+                           : 10 * sqrt(numeric_limits<real>::epsilon());
+            if (   p != maxorder || m != mean
+                || !close(s2e, sigma2e, tol) || !close(g, gain, tol)
+                || !equal(a.begin(), a.end(), est.begin(), close_to<real>(tol))
+                || !equal(r.begin(), r.end(), cor.begin(), close_to<real>(tol))) {
+                cerr << "burg_method_chunked with " << L
+                     << " orders per pass differs from burg_method\n";
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    // Check nuttall_strand_method reduces to burg_method for one channel.
+    // It stops early on singular covariances where burg_method pads zeros.
+    {
+        size_t p = est.size();
+        real m, tol = sqrt(numeric_limits<real>::epsilon());
+        vector<real> a, s2e;
+        nuttall_strand_method(data.begin(), data.end(), 1, &m, p,
+                              back_inserter(a), back_inserter(s2e),
+                              subtract_mean);
+        if (   p > est.size() || !close(m, mean, tol)
+            || !close(s2e[0], sigma2e, tol)
+            || !equal(a.begin(), a.end(), est.begin(), close_to<real>(tol))
+            || count(est.begin() + p, est.end(), real(0))
+                    != static_cast<ptrdiff_t>(est.size() - p)) {
+            cerr << "nuttall_strand_method differs from burg_method\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Check nuttall_strand_method recovers a coupled VAR(1) process and
+    // that best_vector_model selects it from a hierarchy
+    {
+        const size_t d = 2, N = 20000;
+        const real Phi[] = { real(0.5), real(0.3), real(-0.2), real(0.4) };
+        counter_normal<real> eps(5551212);
+        vector<real> x(N*d);
+        real x0 = 0, x1 = 0;
+        for (size_t n = 0; n < N; ++n) {
+            const real y0 = Phi[0]*x0 + Phi[1]*x1 + eps();
+            const real y1 = Phi[2]*x0 + Phi[3]*x1 + eps();
+            x[n*d] = x0 = y0;
+            x[n*d + 1] = x1 = y1;
+        }
+        size_t p = 6;
+        real m[d];
+        vector<real> A, S;
+        nuttall_strand_method(x.begin(), x.end(), d, m, p,
+                              back_inserter(A), back_inserter(S),
+                              true, true);
+        const size_t best = best_vector_model<AIC>(N, d, 0u, A, S);
+        if (p != 6 || best != 1 || A.size() != d*d || S.size() != d*d) {
+            cerr << "best_vector_model selected order " << best << "\n";
+            return EXIT_FAILURE;
+        }
+        for (size_t i = 0; i < d*d; ++i) {
+            const real sigma = (i % (d + 1)) ? 0 : 1;
+            if (!close(A[i], -Phi[i], real(0.05))
+                    || !close(S[i], sigma, real(0.05))) {
+                cerr << "nuttall_strand_method failed to recover VAR(1)\n";
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    // Check spectrum_uniform agrees with spectrum on a grid taking the FFT
+    // path and on one that does not, that the batch variants reproduce them
+    // bit-for-bit, and that the density averages to sigma2x.  Comparisons
+    // use |A|^2 = sigma2e / S whose rounding scales like (1 + sum |a_k|)^2.
+    if (!est.empty()) {
+        const real eps = numeric_limits<real>::epsilon();
+        const real pi  = 4*atan(real(1));
+        real l1 = 1;
+        for (size_t i = 0; i < est.size(); ++i) l1 += abs(est[i]);
+        const real tol = 100*eps*l1*l1;
+        const size_t Ks[] = {
+            1 + (size_t(1) << (min(est.size(), size_t(11)) - 1)),  // FFT
+            101                                                    // Horner
+        };
+        for (size_t k = 0; k < sizeof(Ks)/sizeof(Ks[0]); ++k) {
+            const size_t K = Ks[k];
+            vector<real> omega(K), S(K), D(K), B(K);
+            for (size_t j = 0; j < K; ++j) omega[j] = pi*j/(K - 1);
+            spectrum_uniform(est.begin(), est.end(), sigma2e, K, S.begin());
+            spectrum(est.begin(), est.end(), sigma2e,
+                     omega.begin(), omega.end(), D.begin());
+            for (size_t j = 0; j < K; ++j) {
+                if (abs(sigma2e/S[j] - sigma2e/D[j]) > tol) {
+                    cerr << "spectrum_uniform differs from spectrum at K="
+                         << K << ", omega=" << omega[j] << "\n";
+                    return EXIT_FAILURE;
+                }
+            }
+            vector<real>::iterator firsts[] = { est.begin() },
+                                   lasts[]  = { est.end()   };
+            real*                  outs[]   = { &B[0] };
+            spectrum_uniform_batch(1, firsts, lasts, &sigma2e, K, outs);
+            if (!equal(S.begin(), S.end(), B.begin(), same_or_nan<real>)) {
+                cerr << "spectrum_uniform_batch differs at K=" << K << "\n";
+                return EXIT_FAILURE;
+            }
+            spectrum_batch(1, firsts, lasts, &sigma2e,
+                           omega.begin(), omega.end(), outs);
+            if (!equal(D.begin(), D.end(), B.begin(), same_or_nan<real>)) {
+                cerr << "spectrum_batch differs at K=" << K << "\n";
+                return EXIT_FAILURE;
+            }
+        }
+
+        // The trapezoidal rule converges geometrically for periodic S
+        // but models with infinite gain have no finite variance to match
+        const size_t K = 16385;
+        vector<real> S(K);
+        spectrum_uniform(est.begin(), est.end(), sigma2e, K, S.begin());
+        real avg = (S.front() + S.back()) / 2;
+        for (size_t j = 1; j + 1 < K; ++j) avg += S[j];
+        avg /= K - 1;
+        if (   gain <= numeric_limits<real>::max()
+            && !close(avg, gain*sigma2e, real(1e3)*eps*l1)) {
+            cerr << "spectrum averages " << avg
+                 << " rather than sigma2x " << gain*sigma2e << "\n";
+            return EXIT_FAILURE;
+        }
+    }
 
     // Solve Yule-Walker equations using Zohar's algorithm as consistency check
     // Given right hand side containing rho_1, ..., rho_p the solution should
@@ -101,5 +101,29 @@ int main()
     for (size_t i = 0; i < exp.size(); ++i) abserr += std::abs(err[i]);
     cout << "Sum of the absolute errors is:\n\t" << abserr << endl;
 
+    // Solving for several right hand sides at once, including the original,
+    // must reproduce single solves without reallocating the workspace
+    const size_t k = 3, n1 = exp.size();
+    vector<real> rhs, batch(k*n1), single(n1);
+    for (size_t m = 0; m < k; ++m) {
+        for (size_t i = 0; i < n1; ++i) rhs.push_back(real(i + 1) + m*i*i);
+    }
+    zohar_workspace<real> w(a.size(), k);
+    const size_t capacity = w.s.capacity();
+    zohar_linear_solve(a.begin(), a.end(), r.begin(),
+                       k, rhs.begin(), batch.begin(), w);
+    for (size_t m = 0; m < k; ++m) {
+        zohar_linear_solve(a.begin(), a.end(), r.begin(),
+                           rhs.begin() + m*n1, single.begin(), w);
+        if (!equal(single.begin(), single.end(), batch.begin() + m*n1)) {
+            cout << "Batch solution " << m << " differs from single solve\n";
+            return EXIT_FAILURE;
+        }
+    }
+    if (w.s.capacity() != capacity) {
+        cout << "zohar_workspace reallocated its storage" << endl;
+        return EXIT_FAILURE;
+    }
+
     return EXIT_SUCCESS;
 }